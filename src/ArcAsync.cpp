@@ -0,0 +1,391 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ArcAsync.h"
+#include "zlib/zlib.h"
+
+
+// Entries this close together in the archive are read with one read. The
+// gap between them is read and thrown away.
+#define COALESCE_GAP        (64 * 1024)
+
+// Reads are merged up to this size. A bigger entry is read on its own.
+#define COALESCE_MAX        (1024 * 1024)
+
+
+// Seeks with 64 bit offsets, as entries can lie beyond 2GB.
+#if defined(_MSC_VER)
+#define ARC_FSEEK(fp, offset)       _fseeki64((fp), (offset), SEEK_SET)
+#else
+#define ARC_FSEEK(fp, offset)       fseeko((fp), (off_t)(offset), SEEK_SET)
+#endif
+
+
+namespace
+{
+    // A request with its entry looked up and its range checked.
+    typedef struct QueueItem
+    {
+        ArcRequest      request;                // The caller's request
+        const ArcEntry *pEntry;                 // The entry, or NULL if the request fails
+        u32             size;                   // The number of bytes to read
+
+    } QueueItem;
+
+
+    // Requests whose data is read with one read.
+    typedef struct QueueJob
+    {
+        u32                     start;          // The offset of the read in the archive
+        u32                     size;           // The number of bytes to read
+        std::vector<QueueItem>  items;          // The requests, in data order
+
+    } QueueJob;
+}
+
+
+// Shared state for the worker threads.
+struct ArcQueue
+{
+    const ArcArchive           *archive;        // The archive
+    std::string                 arcFilename;    // The archive data file
+    std::vector<std::thread>    threads;        // The worker threads
+    std::deque<QueueJob>        jobs;           // Reads waiting for a worker
+    std::mutex                  lock;           // Guards everything below
+    std::condition_variable     wake;           // Signalled when jobs are queued, or the queue closes
+    std::condition_variable     idle;           // Signalled when the last job is done
+    u32                         pending;        // Jobs queued or being worked on
+    bool                        closing;        // Should the workers stop?
+};
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Orders requests by the position of their data. Failed requests go
+    // first, so they make a job of their own.
+    // ------------------------------------------------------------------------
+    bool ItemOffsetLess(const QueueItem &lhs, const QueueItem &rhs)
+    {
+        if (lhs.pEntry == NULL || rhs.pEntry == NULL)
+            return lhs.pEntry == NULL && rhs.pEntry != NULL;
+
+        return lhs.pEntry->offset < rhs.pEntry->offset;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Decodes a range of an entry's data from its stored data. A compressed
+    // entry is only inflated as far as the end of the range.
+    // ------------------------------------------------------------------------
+    bool DecodeRange(const ArcArchive &archive, const ArcEntry *pEntry, const u8 *stored, u32 offset, u32 size, u8 *out, std::vector<u8> &scratch)
+    {
+        bool whole = offset == 0 && size == pEntry->filesize;
+
+        if (!pEntry->compressed)
+        {
+            memcpy(out, stored + offset, size);
+        }
+        else if (whole)
+        {
+            if (!ArcDecode(pEntry, stored, out))
+                return false;
+        }
+        else
+        {
+            scratch.resize(offset + size);
+
+            z_stream stream;
+            memset(&stream, 0, sizeof(stream));
+            stream.next_in   = (Bytef*)stored;
+            stream.avail_in  = pEntry->compressedSize;
+            stream.next_out  = &scratch[0];
+            stream.avail_out = offset + size;
+
+            if (inflateInit(&stream) != Z_OK)
+                return false;
+
+            int status = Z_OK;
+            while (stream.avail_out > 0 && status == Z_OK)
+            {
+                status = inflate(&stream, Z_NO_FLUSH);
+            }
+
+            inflateEnd(&stream);
+
+            if (stream.avail_out > 0)
+                return false;
+
+            memcpy(out, &scratch[offset], size);
+        }
+
+        // Only whole entries can be checked.
+        return !whole || !archive.verifyOnRead || ArcVerify(archive, pEntry, out);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Finishes a request and calls it back. stored is the entry's stored
+    // data, or NULL if the read failed.
+    // ------------------------------------------------------------------------
+    void Complete(const ArcArchive &archive, const QueueItem &item, const u8 *stored, std::vector<u8> &scratch)
+    {
+        const ArcRequest &request = item.request;
+        u8               *out     = (u8*)request.buffer;
+        bool              ok      = item.pEntry != NULL && stored != NULL;
+
+        if (ok && out == NULL)
+        {
+            out = (u8*)malloc(item.size ? item.size : 1);
+            ok  = out != NULL;
+        }
+
+        ok = ok && DecodeRange(archive, item.pEntry, stored, request.offset, item.size, out, scratch);
+
+        if (!ok && request.buffer == NULL)
+        {
+            free(out);
+        }
+
+        request.callback(request, ok ? out : NULL, ok ? item.size : 0, ok);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Takes jobs until the queue closes. Each worker has its own file handle
+    // and buffers, which grow to the largest read seen.
+    // ------------------------------------------------------------------------
+    void Worker(ArcQueue *queue)
+    {
+        FILE *fp = fopen(queue->arcFilename.c_str(), "rb");
+
+        std::vector<u8> stored;
+        std::vector<u8> scratch;
+
+        for (;;)
+        {
+            QueueJob job;
+            {
+                std::unique_lock<std::mutex> guard(queue->lock);
+                while (queue->jobs.empty() && !queue->closing)
+                {
+                    queue->wake.wait(guard);
+                }
+
+                if (queue->jobs.empty())
+                    break;
+
+                job.start = queue->jobs.front().start;
+                job.size  = queue->jobs.front().size;
+                job.items.swap(queue->jobs.front().items);
+                queue->jobs.pop_front();
+            }
+
+            stored.resize(job.size + 1);
+
+            bool read = job.items[0].pEntry != NULL && fp != NULL &&
+                        ARC_FSEEK(fp, job.start) == 0 &&
+                        fread(&stored[0], 1, job.size, fp) == job.size;
+
+            for (size_t i=0; i<job.items.size(); i++)
+            {
+                const QueueItem &item = job.items[i];
+
+                Complete(*queue->archive, item, read ? &stored[item.pEntry->offset - job.start] : NULL, scratch);
+            }
+
+            {
+                std::lock_guard<std::mutex> guard(queue->lock);
+                if (--queue->pending == 0)
+                {
+                    queue->idle.notify_all();
+                }
+            }
+        }
+
+        if (fp)
+        {
+            fclose(fp);
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Starts the worker threads.
+// ----------------------------------------------------------------------------
+ArcQueue *ArcQueueOpen(const ArcArchive &archive, const char *arcFilename, u32 threadCount)
+{
+    if (threadCount == 0)
+    {
+        threadCount = std::thread::hardware_concurrency();
+        if (threadCount == 0)
+            threadCount = 1;
+    }
+
+    // Check the workers will be able to open the data file.
+    FILE *fp = fopen(arcFilename, "rb");
+    if (fp == NULL)
+        return NULL;
+
+    fclose(fp);
+
+    ArcQueue *queue = new ArcQueue;
+    queue->archive     = &archive;
+    queue->arcFilename = arcFilename;
+    queue->pending     = 0;
+    queue->closing     = false;
+
+    for (u32 t=0; t<threadCount; t++)
+    {
+        queue->threads.push_back(std::thread(Worker, queue));
+    }
+
+    return queue;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finishes the outstanding requests and stops the worker threads.
+// ----------------------------------------------------------------------------
+void ArcQueueClose(ArcQueue *queue)
+{
+    if (queue == NULL)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(queue->lock);
+        queue->closing = true;
+    }
+
+    queue->wake.notify_all();
+
+    for (size_t t=0; t<queue->threads.size(); t++)
+    {
+        queue->threads[t].join();
+    }
+
+    delete queue;
+}
+
+
+// ----------------------------------------------------------------------------
+// Queues a batch of requests.
+//
+// The batch is sorted by data offset, and runs of entries with gaps of up to
+// COALESCE_GAP between them become one job, read with one read.
+// ----------------------------------------------------------------------------
+void ArcQueueSubmit(ArcQueue *queue, const ArcRequest *requests, u32 count)
+{
+    const ArcArchive &archive = *queue->archive;
+
+    std::vector<QueueItem> items(count);
+    for (u32 i=0; i<count; i++)
+    {
+        QueueItem &item = items[i];
+
+        item.request = requests[i];
+        item.pEntry  = requests[i].name ? ArcFindName(archive, requests[i].name) : ArcFind(archive, requests[i].hash);
+        item.size    = 0;
+
+        if (item.pEntry && (item.pEntry->flags & ENTRY_FLAG_TOMBSTONE))
+        {
+            item.pEntry = NULL;
+        }
+
+        // Check the range.
+        if (item.pEntry)
+        {
+            u32 filesize = item.pEntry->filesize;
+            u32 offset   = item.request.offset;
+
+            item.size = item.request.size ? item.request.size : filesize - offset;
+
+            if (offset > filesize || item.size > filesize - offset)
+            {
+                item.pEntry = NULL;
+            }
+        }
+    }
+
+    std::sort(items.begin(), items.end(), ItemOffsetLess);
+
+    std::vector<QueueJob> jobs;
+    for (size_t i=0; i<items.size(); i++)
+    {
+        const QueueItem &item = items[i];
+        u32              start = item.pEntry ? item.pEntry->offset : 0;
+        u32              end   = start + (item.pEntry ? ArcStoredSize(item.pEntry) : 0);
+
+        bool join = !jobs.empty() &&
+                    (jobs.back().items[0].pEntry == NULL) == (item.pEntry == NULL) &&
+                    start <= jobs.back().start + jobs.back().size + COALESCE_GAP &&
+                    end - jobs.back().start <= COALESCE_MAX;
+
+        if (!join)
+        {
+            jobs.push_back(QueueJob());
+            jobs.back().start = start;
+            jobs.back().size  = 0;
+        }
+
+        QueueJob &job = jobs.back();
+        job.size = std::max(job.size, end - job.start);
+        job.items.push_back(item);
+    }
+
+    {
+        std::lock_guard<std::mutex> guard(queue->lock);
+
+        for (size_t j=0; j<jobs.size(); j++)
+        {
+            queue->jobs.push_back(QueueJob());
+            queue->jobs.back().start = jobs[j].start;
+            queue->jobs.back().size  = jobs[j].size;
+            queue->jobs.back().items.swap(jobs[j].items);
+        }
+
+        queue->pending += (u32)jobs.size();
+    }
+
+    queue->wake.notify_all();
+}
+
+
+// ----------------------------------------------------------------------------
+// Waits until every queued request has had its callback.
+// ----------------------------------------------------------------------------
+void ArcQueueWait(ArcQueue *queue)
+{
+    std::unique_lock<std::mutex> guard(queue->lock);
+
+    while (queue->pending > 0)
+    {
+        queue->idle.wait(guard);
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include "ArcReader.h"
+
+
+// Asynchronous reads for streaming. Requests are handed over in batches.
+// Each batch is sorted by offset, and entries that are next to each other
+// in the archive are read with one read. Worker threads, each with their own
+// handle on the archive data file, do the reads and inflates and call back
+// when each request is done. The caller never waits on I/O or zlib.
+typedef struct ArcQueue ArcQueue;
+typedef struct ArcRequest ArcRequest;
+
+
+// Called on a worker thread when a request is done. data holds size bytes:
+// the request's buffer, or if that was NULL, a buffer from malloc() that the
+// callback owns. On failure data is NULL and size is 0.
+typedef void (*ArcCallback)(const ArcRequest &request, void *data, u32 size, bool ok);
+
+
+// A read of one entry, or of a byte range of its uncompressed data.
+struct ArcRequest
+{
+    const char     *name;                   // The entry name, or NULL to use the hash
+    u32             hash;                   // The entry hash, when there's no name
+    u32             offset;                 // The first byte to read
+    u32             size;                   // The number of bytes to read, or 0 for the rest
+    void           *buffer;                 // Where to read to, or NULL to allocate it
+    ArcCallback     callback;               // Called when the read is done
+    void           *user;                   // Free for the caller's use
+};
+
+
+// Starts the worker threads. Each opens the archive data file itself. The
+// archive must stay open until the queue is closed. Pass 0 threads for one
+// per core. Returns NULL on failure.
+ArcQueue   *ArcQueueOpen(const ArcArchive &archive, const char *arcFilename, u32 threadCount = 0);
+
+// Finishes the outstanding requests and stops the worker threads.
+void        ArcQueueClose(ArcQueue *queue);
+
+// Queues a batch of requests. The requests are copied, and names are looked
+// up before this returns, so neither has to outlive the call. Every request
+// gets its callback, including those for missing entries and bad ranges.
+void        ArcQueueSubmit(ArcQueue *queue, const ArcRequest *requests, u32 count);
+
+// Waits until every queued request has had its callback.
+void        ArcQueueWait(ArcQueue *queue);
+
+
+// With C++20 coroutines, a single read can be awaited:
+//
+//     ArcReadResult result = co_await ArcAwaitRead(queue, "textures/logo.png");
+//
+// The coroutine carries on on the worker thread that did the read.
+#if defined(__cpp_impl_coroutine)
+
+#include <coroutine>
+
+
+// The outcome of an awaited read, as passed to an ArcCallback.
+typedef struct ArcReadResult
+{
+    void           *data;                   // The data, or NULL on failure
+    u32             size;                   // The number of bytes read
+    bool            ok;                     // Did the read work?
+
+} ArcReadResult;
+
+
+// Suspends a coroutine until its read is done.
+struct ArcReadAwaitable
+{
+    ArcQueue                   *queue;
+    ArcRequest                  request;
+    ArcReadResult               result;
+    std::coroutine_handle<>     handle;
+
+    bool await_ready() const
+    {
+        return false;
+    }
+
+    // Nothing may touch the awaitable after the submit, as the read can
+    // finish and resume the coroutine before it returns.
+    void await_suspend(std::coroutine_handle<> suspended)
+    {
+        handle       = suspended;
+        request.user = this;
+        ArcQueueSubmit(queue, &request, 1);
+    }
+
+    ArcReadResult await_resume() const
+    {
+        return result;
+    }
+
+    static void Resume(const ArcRequest &request, void *data, u32 size, bool ok)
+    {
+        ArcReadAwaitable *awaitable = (ArcReadAwaitable*)request.user;
+
+        awaitable->result.data = data;
+        awaitable->result.size = size;
+        awaitable->result.ok   = ok;
+        awaitable->handle.resume();
+    }
+};
+
+
+// Makes an awaitable read of a named entry. buffer is as for ArcRequest.
+inline ArcReadAwaitable ArcAwaitRead(ArcQueue *queue, const char *name, void *buffer = NULL, u32 offset = 0, u32 size = 0)
+{
+    ArcReadAwaitable awaitable = {};
+
+    awaitable.queue            = queue;
+    awaitable.request.name     = name;
+    awaitable.request.offset   = offset;
+    awaitable.request.size     = size;
+    awaitable.request.buffer   = buffer;
+    awaitable.request.callback = ArcReadAwaitable::Resume;
+
+    return awaitable;
+}
+
+#endif
@@ -0,0 +1,392 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <mutex>
+#include <unordered_map>
+#include "ArcCache.h"
+#include "ArcHash.h"
+#include "ArcPrefetch.h"
+
+
+// The number of shards, when the caller doesn't choose.
+#define CACHE_SHARDS        16
+
+
+// Seeks with 64 bit offsets, as entries can lie beyond 2GB.
+#if defined(_MSC_VER)
+#define ARC_FSEEK(fp, offset)       _fseeki64((fp), (offset), SEEK_SET)
+#else
+#define ARC_FSEEK(fp, offset)       fseeko((fp), (off_t)(offset), SEEK_SET)
+#endif
+
+
+namespace
+{
+    // A cached entry. The handle comes first, so a handle is also the item.
+    typedef struct CacheItem
+    {
+        ArcCached       cached;                 // The handle given out
+        const ArcEntry *pEntry;                 // The entry
+        CacheItem      *prev;                   // The more recently used item
+        CacheItem      *next;                   // The less recently used item
+        u32             refs;                   // The number of handles out
+        bool            resident;               // Held by the cache, not just by its handle
+
+    } CacheItem;
+
+
+    // A part of the cache, chosen by entry hash.
+    typedef struct CacheShard
+    {
+        std::mutex                                          lock;       // Guards the shard
+        std::unordered_map<const ArcEntry*, CacheItem*>     items;      // The cached items
+        CacheItem                                          *head;       // The most recently used item
+        CacheItem                                          *tail;       // The least recently used item
+        u64                                                 bytes;      // Bytes of data held
+        u64                                                 hits;
+        u64                                                 misses;
+        u64                                                 evictions;
+
+    } CacheShard;
+}
+
+
+// The shards, and the lock on the archive's file.
+struct ArcCache
+{
+    const ArcArchive   *archive;                // The archive
+    std::mutex          io;                     // Guards archive.arc
+    CacheShard         *shards;                 // The shards
+    u32                 shardCount;             // The number of shards
+    u64                 shardBudget;            // The bytes each shard may hold
+};
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Puts an item at the head of its shard's list.
+    // ------------------------------------------------------------------------
+    void LinkHead(CacheShard &shard, CacheItem *item)
+    {
+        item->prev = NULL;
+        item->next = shard.head;
+
+        if (shard.head)
+            shard.head->prev = item;
+        else
+            shard.tail = item;
+
+        shard.head = item;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Takes an item out of its shard's list.
+    // ------------------------------------------------------------------------
+    void Unlink(CacheShard &shard, CacheItem *item)
+    {
+        if (item->prev)
+            item->prev->next = item->next;
+        else
+            shard.head = item->next;
+
+        if (item->next)
+            item->next->prev = item->prev;
+        else
+            shard.tail = item->prev;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets an entry's shard. StringHash() clusters badly, so it is mixed first.
+    // ------------------------------------------------------------------------
+    CacheShard &ShardOf(ArcCache *cache, const ArcEntry *pEntry)
+    {
+        return cache->shards[HashMix64(pEntry->hash) % cache->shardCount];
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Frees an item and its data.
+    // ------------------------------------------------------------------------
+    void FreeItem(CacheItem *item)
+    {
+        free((void*)item->cached.data);
+        delete item;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Evicts the least recently used items until the shard is in budget.
+    // Items with handles out are passed over.
+    // ------------------------------------------------------------------------
+    void Trim(CacheShard &shard, u64 budget)
+    {
+        CacheItem *item = shard.tail;
+
+        while (shard.bytes > budget && item)
+        {
+            CacheItem *prev = item->prev;
+
+            if (item->refs == 0)
+            {
+                Unlink(shard, item);
+                shard.items.erase(item->pEntry);
+                shard.bytes -= item->cached.size;
+                shard.evictions++;
+                FreeItem(item);
+            }
+
+            item = prev;
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Reads and decodes an entry. Only the file read holds the lock, so
+    // entries are inflated in parallel.
+    // ------------------------------------------------------------------------
+    void *Load(ArcCache *cache, const ArcEntry *pEntry)
+    {
+        const ArcArchive &archive = *cache->archive;
+
+        u8 *data   = (u8*)malloc(pEntry->filesize ? pEntry->filesize : 1);
+        u8 *packed = pEntry->compressed ? (u8*)malloc(pEntry->compressedSize) : data;
+        u32 stored = ArcStoredSize(pEntry);
+
+        bool result = data != NULL && packed != NULL;
+
+        if (archive.prefetcher)
+        {
+            ArcPrefetchNote(archive.prefetcher, pEntry);
+        }
+
+        if (result)
+        {
+            std::lock_guard<std::mutex> guard(cache->io);
+
+            result = ARC_FSEEK(archive.arc, pEntry->offset) == 0 &&
+                     fread(packed, 1, stored, archive.arc) == stored;
+        }
+
+        if (result && pEntry->compressed)
+        {
+            result = ArcDecode(pEntry, packed, data);
+        }
+
+        result = result && (!archive.verifyOnRead || ArcVerify(archive, pEntry, data));
+
+        if (packed != data)
+        {
+            free(packed);
+        }
+
+        if (!result)
+        {
+            free(data);
+            return NULL;
+        }
+
+        return data;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Makes a cache for an open archive.
+// ----------------------------------------------------------------------------
+ArcCache *ArcCacheCreate(const ArcArchive &archive, u64 budget, u32 shardCount)
+{
+    if (shardCount == 0)
+        shardCount = CACHE_SHARDS;
+
+    ArcCache *cache = new ArcCache;
+    cache->archive     = &archive;
+    cache->shards      = new CacheShard[shardCount];
+    cache->shardCount  = shardCount;
+    cache->shardBudget = budget / shardCount;
+
+    for (u32 s=0; s<shardCount; s++)
+    {
+        CacheShard &shard = cache->shards[s];
+
+        shard.head      = NULL;
+        shard.tail      = NULL;
+        shard.bytes     = 0;
+        shard.hits      = 0;
+        shard.misses    = 0;
+        shard.evictions = 0;
+    }
+
+    return cache;
+}
+
+
+// ----------------------------------------------------------------------------
+// Frees a cache and everything in it.
+// ----------------------------------------------------------------------------
+void ArcCacheDestroy(ArcCache *cache)
+{
+    if (cache == NULL)
+        return;
+
+    for (u32 s=0; s<cache->shardCount; s++)
+    {
+        CacheItem *item = cache->shards[s].head;
+
+        while (item)
+        {
+            CacheItem *next = item->next;
+            FreeItem(item);
+            item = next;
+        }
+    }
+
+    delete [] cache->shards;
+    delete cache;
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets a handle on an entry's data.
+//
+// The shard lock isn't held during a miss's read. If two threads miss on the
+// same entry, both read it, and the second to finish uses the first's copy.
+// ----------------------------------------------------------------------------
+const ArcCached *ArcCacheGet(ArcCache *cache, const ArcEntry *pEntry)
+{
+    if (cache->archive->arc == NULL || pEntry == NULL || (pEntry->flags & ENTRY_FLAG_TOMBSTONE))
+        return NULL;
+
+    CacheShard &shard = ShardOf(cache, pEntry);
+
+    {
+        std::lock_guard<std::mutex> guard(shard.lock);
+
+        std::unordered_map<const ArcEntry*, CacheItem*>::iterator found = shard.items.find(pEntry);
+        if (found != shard.items.end())
+        {
+            CacheItem *item = found->second;
+
+            Unlink(shard, item);
+            LinkHead(shard, item);
+            item->refs++;
+            shard.hits++;
+
+            return &item->cached;
+        }
+
+        shard.misses++;
+    }
+
+    void *data = Load(cache, pEntry);
+    if (data == NULL)
+        return NULL;
+
+    CacheItem *item = new CacheItem;
+    item->cached.data = data;
+    item->cached.size = pEntry->filesize;
+    item->pEntry      = pEntry;
+    item->prev        = NULL;
+    item->next        = NULL;
+    item->refs        = 1;
+    item->resident    = pEntry->filesize <= cache->shardBudget;
+
+    if (!item->resident)
+        return &item->cached;
+
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    std::unordered_map<const ArcEntry*, CacheItem*>::iterator found = shard.items.find(pEntry);
+    if (found != shard.items.end())
+    {
+        FreeItem(item);
+
+        item = found->second;
+        item->refs++;
+        Unlink(shard, item);
+        LinkHead(shard, item);
+
+        return &item->cached;
+    }
+
+    shard.items[pEntry] = item;
+    shard.bytes += item->cached.size;
+    LinkHead(shard, item);
+    Trim(shard, cache->shardBudget);
+
+    return &item->cached;
+}
+
+
+// ----------------------------------------------------------------------------
+// Releases a handle.
+// ----------------------------------------------------------------------------
+void ArcCacheRelease(ArcCache *cache, const ArcCached *cached)
+{
+    if (cached == NULL)
+        return;
+
+    CacheItem *item = (CacheItem*)cached;
+
+    if (!item->resident)
+    {
+        FreeItem(item);
+        return;
+    }
+
+    CacheShard &shard = ShardOf(cache, item->pEntry);
+
+    std::lock_guard<std::mutex> guard(shard.lock);
+
+    // The shard can be over budget if every item had handles out when the
+    // last one was added.
+    if (--item->refs == 0)
+    {
+        Trim(shard, cache->shardBudget);
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets the cache counters.
+// ----------------------------------------------------------------------------
+void ArcCacheGetStats(ArcCache *cache, ArcCacheStats &stats)
+{
+    stats.hits      = 0;
+    stats.misses    = 0;
+    stats.evictions = 0;
+    stats.bytes     = 0;
+    stats.count     = 0;
+
+    for (u32 s=0; s<cache->shardCount; s++)
+    {
+        CacheShard &shard = cache->shards[s];
+
+        std::lock_guard<std::mutex> guard(shard.lock);
+
+        stats.hits      += shard.hits;
+        stats.misses    += shard.misses;
+        stats.evictions += shard.evictions;
+        stats.bytes     += shard.bytes;
+        stats.count     += (u32)shard.items.size();
+    }
+}
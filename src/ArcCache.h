@@ -0,0 +1,72 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include "ArcReader.h"
+
+
+// A cache of decoded entries, for entries that are loaded again and again,
+// such as UI atlases and shared shaders. Entries are held in shards, each
+// with its own lock and least recently used list, and the cache is kept
+// under a memory budget. A hit returns a handle to the cached data, so it
+// is not read, inflated or copied again.
+typedef struct ArcCache ArcCache;
+
+
+// A handle on a cached entry's data. It stays valid, and the data stays in
+// the cache, until it is released.
+typedef struct ArcCached
+{
+    const void *data;                       // The uncompressed data
+    u32         size;                       // The number of bytes of data
+
+} ArcCached;
+
+
+// Cache counters, summed over the shards.
+typedef struct ArcCacheStats
+{
+    u64         hits;                       // Gets that found the entry cached
+    u64         misses;                     // Gets that read the entry
+    u64         evictions;                  // Entries dropped to stay in budget
+    u64         bytes;                      // Bytes of data cached
+    u32         count;                      // Entries cached
+
+} ArcCacheStats;
+
+
+// Makes a cache holding up to budget bytes of an open archive's entries.
+// The archive must stay open until the cache is destroyed. Pass 0 shards for
+// the default.
+ArcCache       *ArcCacheCreate(const ArcArchive &archive, u64 budget, u32 shardCount = 0);
+
+// Frees a cache. Every handle must have been released.
+void            ArcCacheDestroy(ArcCache *cache);
+
+// Gets a handle on an entry's data, reading it on a miss. Returns NULL if
+// the entry can't be read. Entries too big for a shard's budget are read
+// for the handle but not kept. Safe to call from any thread.
+const ArcCached *ArcCacheGet(ArcCache *cache, const ArcEntry *pEntry);
+
+// Releases a handle. Entries with no handles left can be evicted.
+void            ArcCacheRelease(ArcCache *cache, const ArcCached *cached);
+
+// Gets the cache counters.
+void            ArcCacheGetStats(ArcCache *cache, ArcCacheStats &stats);
@@ -0,0 +1,73 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include <stddef.h>
+#include "ArcEntry.h"
+
+
+// Compile time name hashing for game code. Header only, and needs C++14
+// (VS2017 or later). The tool itself doesn't use it.
+//
+//     ArcEntry *pEntry = ArcFind(archive, "textures/logo.png"_pat);
+//
+// The name must be written as the archive stores it: in its case with -lc or
+// -uc, and in NFC, which is how editors save nearly all text. ArcFind() takes
+// the hash as it is, so a name in another form is simply not found.
+//
+// With C++20 _pat is consteval, so it's always worked out when compiling.
+// Before that a compiler may leave a _pat in an ordinary expression until run
+// time. Initialising a constexpr variable makes sure it doesn't:
+//
+//     constexpr u32 logo = "textures/logo.png"_pat;
+
+
+#if defined(__cpp_consteval)
+#define ARC_CONST_EVAL consteval
+#else
+#define ARC_CONST_EVAL constexpr
+#endif
+
+
+// ----------------------------------------------------------------------------
+// The same hash as StringHash(), bytes taken as signed. A loop rather than
+// recursion, so any length of name is within the compiler's limits.
+// ----------------------------------------------------------------------------
+constexpr u32 ArcConstHash(const char *string)
+{
+    u32 hash = 0;
+
+    while (*string)
+    {
+        hash += (u32)(s32)(s8)*string;
+        hash *= (u32)(s32)(s8)*string++;
+    }
+
+    return hash;
+}
+
+
+// ----------------------------------------------------------------------------
+// "name"_pat is the name's hash, worked out when compiling.
+// ----------------------------------------------------------------------------
+ARC_CONST_EVAL u32 operator"" _pat(const char *string, size_t)
+{
+    return ArcConstHash(string);
+}
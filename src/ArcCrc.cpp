@@ -0,0 +1,326 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <string.h>
+#include "ArcCrc.h"
+
+
+// The CRC-32C polynomial, reflected.
+#define CRC32C_POLY             0x82f63b78
+
+// Stream lengths for the interleaved hardware loop. The crc32 instruction
+// takes three cycles but can start one per cycle, so three streams are run
+// side by side and joined with the zero shift tables.
+#define CRC_LONG                8192
+#define CRC_SHORT               256
+
+
+// The SSE4.2 crc32 instruction.
+#if defined(_M_X64) || defined(__x86_64__)
+#define CRC_HARDWARE
+#define CRC_WORD                u64
+#define CRC_WORD_STEP(crc, p)   (u32)_mm_crc32_u64((crc), *(const u64*)(p))
+#elif defined(_M_IX86) || defined(__i386__)
+#define CRC_HARDWARE
+#define CRC_WORD                u32
+#define CRC_WORD_STEP(crc, p)   _mm_crc32_u32((crc), *(const u32*)(p))
+#endif
+
+#if defined(CRC_HARDWARE)
+#include <nmmintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define CRC_TARGET
+#else
+#include <cpuid.h>
+#define CRC_TARGET              __attribute__((target("sse4.2")))
+#endif
+#endif
+
+
+namespace
+{
+    // Tables built on first use.
+    struct CrcTables
+    {
+        u32     slice[8][256];              // Slicing by 8 tables
+        u32     longShift[4][256];          // Appends CRC_LONG zero bytes to a CRC
+        u32     shortShift[4][256];         // Appends CRC_SHORT zero bytes to a CRC
+        bool    hardware;                   // Can we use the crc32 instruction?
+
+        CrcTables();
+    };
+
+
+    // ------------------------------------------------------------------------
+    // Multiplies a vector by a GF(2) matrix.
+    // ------------------------------------------------------------------------
+    u32 Gf2Times(const u32 *matrix, u32 vector)
+    {
+        u32 sum = 0;
+
+        while (vector)
+        {
+            if (vector & 1)
+                sum ^= *matrix;
+
+            vector >>= 1;
+            matrix++;
+        }
+
+        return sum;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Squares a GF(2) matrix.
+    // ------------------------------------------------------------------------
+    void Gf2Square(u32 *square, const u32 *matrix)
+    {
+        for (u32 n=0; n<32; n++)
+        {
+            square[n] = Gf2Times(matrix, matrix[n]);
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Builds the tables that append length zero bytes to a CRC. The length
+    // must be a power of two.
+    // ------------------------------------------------------------------------
+    void BuildShift(u32 shift[4][256], u32 length)
+    {
+        u32 even[32];
+        u32 odd[32];
+
+        // The operator for one zero bit.
+        odd[0] = CRC32C_POLY;
+        for (u32 n=1; n<32; n++)
+        {
+            odd[n] = 1u << (n - 1);
+        }
+
+        // Square up to one zero byte, then once per bit of the length.
+        Gf2Square(even, odd);
+        Gf2Square(odd, even);
+
+        const u32 *op = odd;
+        for (;;)
+        {
+            Gf2Square(even, odd);
+            length >>= 1;
+            if (length == 0)
+            {
+                op = even;
+                break;
+            }
+
+            Gf2Square(odd, even);
+            length >>= 1;
+            if (length == 0)
+            {
+                op = odd;
+                break;
+            }
+        }
+
+        for (u32 n=0; n<256; n++)
+        {
+            shift[0][n] = Gf2Times(op, n);
+            shift[1][n] = Gf2Times(op, n << 8);
+            shift[2][n] = Gf2Times(op, n << 16);
+            shift[3][n] = Gf2Times(op, n << 24);
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Checks for SSE4.2.
+    // ------------------------------------------------------------------------
+    bool HasSse42()
+    {
+    #if defined(CRC_HARDWARE) && defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 1);
+        return (info[2] & (1 << 20)) != 0;
+    #elif defined(CRC_HARDWARE)
+        unsigned int eax, ebx, ecx, edx;
+        return __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1 << 20)) != 0;
+    #else
+        return false;
+    #endif
+    }
+
+
+    CrcTables::CrcTables()
+    {
+        for (u32 n=0; n<256; n++)
+        {
+            u32 crc = n;
+            for (u32 k=0; k<8; k++)
+            {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+            }
+            slice[0][n] = crc;
+        }
+
+        for (u32 n=0; n<256; n++)
+        {
+            u32 crc = slice[0][n];
+            for (u32 k=1; k<8; k++)
+            {
+                crc = slice[0][crc & 0xff] ^ (crc >> 8);
+                slice[k][n] = crc;
+            }
+        }
+
+        BuildShift(longShift,  CRC_LONG);
+        BuildShift(shortShift, CRC_SHORT);
+
+        hardware = HasSse42();
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the tables. Built once, thread safe.
+    // ------------------------------------------------------------------------
+    const CrcTables &Tables()
+    {
+        static const CrcTables tables;
+        return tables;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Appends zero bytes to a CRC using a shift table.
+    // ------------------------------------------------------------------------
+    inline u32 Shift(const u32 shift[4][256], u32 crc)
+    {
+        return shift[0][crc & 0xff] ^ shift[1][(crc >> 8) & 0xff] ^ shift[2][(crc >> 16) & 0xff] ^ shift[3][crc >> 24];
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Table driven CRC, eight bytes a step. The crc is not inverted.
+    // ------------------------------------------------------------------------
+    u32 Crc32cSoftware(const CrcTables &tables, u32 crc, const u8 *next, size_t size)
+    {
+        while (size >= 8)
+        {
+            u32 lo = crc ^ (next[0] | (next[1] << 8) | (next[2] << 16) | ((u32)next[3] << 24));
+            u32 hi =        next[4] | (next[5] << 8) | (next[6] << 16) | ((u32)next[7] << 24);
+
+            crc = tables.slice[7][lo & 0xff] ^ tables.slice[6][(lo >> 8) & 0xff] ^
+                  tables.slice[5][(lo >> 16) & 0xff] ^ tables.slice[4][lo >> 24] ^
+                  tables.slice[3][hi & 0xff] ^ tables.slice[2][(hi >> 8) & 0xff] ^
+                  tables.slice[1][(hi >> 16) & 0xff] ^ tables.slice[0][hi >> 24];
+
+            next += 8;
+            size -= 8;
+        }
+
+        while (size--)
+        {
+            crc = tables.slice[0][(crc ^ *next++) & 0xff] ^ (crc >> 8);
+        }
+
+        return crc;
+    }
+
+
+#if defined(CRC_HARDWARE)
+    // ------------------------------------------------------------------------
+    // Runs three streams of stride bytes side by side, then joins them.
+    // ------------------------------------------------------------------------
+    CRC_TARGET inline u32 Crc32cStreams(const u32 shift[4][256], u32 crc, const u8 *&next, size_t &size, size_t stride)
+    {
+        while (size >= stride * 3)
+        {
+            u32       crc1 = 0;
+            u32       crc2 = 0;
+            const u8 *end  = next + stride;
+
+            do
+            {
+                crc  = CRC_WORD_STEP(crc,  next);
+                crc1 = CRC_WORD_STEP(crc1, next + stride);
+                crc2 = CRC_WORD_STEP(crc2, next + stride * 2);
+                next += sizeof(CRC_WORD);
+            }
+            while (next < end);
+
+            crc   = Shift(shift, crc) ^ crc1;
+            crc   = Shift(shift, crc) ^ crc2;
+            next += stride * 2;
+            size -= stride * 3;
+        }
+
+        return crc;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // SSE4.2 CRC. The crc is not inverted.
+    // ------------------------------------------------------------------------
+    CRC_TARGET u32 Crc32cHardware(const CrcTables &tables, u32 crc, const u8 *next, size_t size)
+    {
+        // Align to a word.
+        while (size > 0 && ((size_t)next & (sizeof(CRC_WORD) - 1)) != 0)
+        {
+            crc = _mm_crc32_u8(crc, *next++);
+            size--;
+        }
+
+        crc = Crc32cStreams(tables.longShift,  crc, next, size, CRC_LONG);
+        crc = Crc32cStreams(tables.shortShift, crc, next, size, CRC_SHORT);
+
+        while (size >= sizeof(CRC_WORD))
+        {
+            crc   = CRC_WORD_STEP(crc, next);
+            next += sizeof(CRC_WORD);
+            size -= sizeof(CRC_WORD);
+        }
+
+        while (size--)
+        {
+            crc = _mm_crc32_u8(crc, *next++);
+        }
+
+        return crc;
+    }
+#endif
+}
+
+
+// ----------------------------------------------------------------------------
+// Computes the CRC-32C of a block of data.
+// ----------------------------------------------------------------------------
+u32 Crc32c(u32 crc, const void *data, size_t size)
+{
+    const CrcTables &tables = Tables();
+    const u8        *next   = (const u8*)data;
+
+    crc = ~crc;
+
+#if defined(CRC_HARDWARE)
+    if (tables.hardware)
+    {
+        return ~Crc32cHardware(tables, crc, next, size);
+    }
+#endif
+
+    return ~Crc32cSoftware(tables, crc, next, size);
+}
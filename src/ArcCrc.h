@@ -0,0 +1,27 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+
+#include <stddef.h>
+#include "ArcEntry.h"
+
+
+// Computes the CRC-32C (Castagnoli) of a block of data. Pass 0 to start, or a
+// previous result to continue it. Uses the SSE4.2 crc32 instruction when the
+// CPU has it, and a slicing by 8 table otherwise.
+u32 Crc32c(u32 crc, const void *data, size_t size);
@@ -54,9 +54,18 @@ typedef struct FatHeader
 
 // Used to uniquely identify an engine file.
 #define MAGIC1              MAKE4('p', 'r', 'o', 't')
-#define MAGIC2              MAKE4('a', 'r', 'c', 'h')
+#define MAGIC2              MAKE4('a', 'r', 'c', 'h')      // Fixed size names (ArcEntryV1)
+#define MAGIC2_V2           MAKE4('a', 'r', 'c', '2')      // Pooled names (ArcEntry)
 
-// Each archive entry is store as this block of data
+// ArcEntry flags
+enum
+{
+    ENTRY_FLAG_TOMBSTONE    = 0x01,         // Patch entry. The file is deleted from lower layers
+};
+
+
+// Each archive entry is store as this block of data. The name is held in the
+// FAT_SECTION_NAMES pool, so names have no length limit.
 typedef struct ArcEntry
 {
     u32     hash;                           // The hashed filename of the entry
@@ -65,14 +74,131 @@ typedef struct ArcEntry
     u32     compressedSize;                 // The compressed filesize of the entry
     u8      compressed;                     // 0 == uncompressed 1 == compressed
     u8      compressionType;                // COMPRESSION_TYPE_NONE or COMPRESSION_TYPE_ZLIB
-    u8      exp0;                           // Expansion purposes (Free to use)
+    u8      flags;                          // ENTRY_FLAG_xxx
+    u8      exp1;                           // Expansion purposes (Free to use)
+    u32     name;                           // Offset of the filename in the name pool
+
+} ArcEntry;
+
+
+// The entry of the first format (MAGIC2), with the name held in a fixed
+// buffer. Still read, and written by -v1 for older readers.
+typedef struct ArcEntryV1
+{
+    u32     hash;                           // The hashed filename of the entry
+    u32     offset;                         // Offset into the archive
+    u32     filesize;                       // The uncompressed filesize of the entry
+    u32     compressedSize;                 // The compressed filesize of the entry
+    u8      compressed;                     // 0 == uncompressed 1 == compressed
+    u8      compressionType;                // COMPRESSION_TYPE_NONE or COMPRESSION_TYPE_ZLIB
+    u8      flags;                          // ENTRY_FLAG_xxx
     u8      exp1;                           // Expansion purposes (Free to use)
     char    filename[260];                  // The filename
 
+} ArcEntryV1;
 
-    bool operator < (const ArcEntry& rhs)
-    {
-        return hash < rhs.hash;
-    }
 
-} ArcEntry;
+// Optional FAT sections.
+//
+// Sections follow the entry table and run to the end of the FAT, as given by
+// FatHeader::size. Each starts with a FatSection and is padded to 8 bytes.
+// Readers skip sections they don't understand, so older readers still work.
+typedef struct FatSection
+{
+    u32 type;                               // FAT_SECTION_xxx
+    u32 size;                               // The size of the section data (Excluding this header)
+
+} FatSection;
+
+
+enum
+{
+    FAT_SECTION_MPH_V2      = MAKE4('m', 'p', 'h', '1'),    // Perfect hash index over the distinct hashes
+    FAT_SECTION_EYTZINGER   = MAKE4('e', 'y', 't', '0'),    // Eytzinger ordered search keys
+    FAT_SECTION_BLOOM       = MAKE4('b', 'l', 'm', '0'),    // Blocked bloom filter
+    FAT_SECTION_CRC         = MAKE4('c', 'r', 'c', '0'),    // Entry checksums
+    FAT_SECTION_NAMES       = MAKE4('n', 'a', 'm', '0'),    // Entry names (Required by MAGIC2_V2)
+    FAT_SECTION_NAME_FORM   = MAKE4('n', 'f', 'm', '0'),    // The form the names are stored in
+    FAT_SECTION_PATHS       = MAKE4('p', 't', 'h', '0'),    // Entry indexes in name order
+};
+
+
+// Name forms. (FAT_SECTION_NAME_FORM)
+enum
+{
+    NAME_FORM_NFC           = 0x01,         // UTF-8, Unicode normalisation form C
+    NAME_FORM_LOWER         = 0x02,         // Simple case folding (Lower case, for nearly all letters)
+    NAME_FORM_UPPER         = 0x04,         // Simple upper case mapping
+};
+
+
+// Perfect hash index. (FAT_SECTION_MPH_V2)
+//
+// Maps every distinct entry hash to a unique slot. Followed by
+// u32 pilots[buckets] and u32 slotEntry[slots], which gives the index of the
+// first entry with the hash for each slot. Entries sharing a hash are found
+// by walking on from there. There are spare slots, which makes the build
+// quick however many entries there are.
+typedef struct FatMphHeader
+{
+    u32 buckets;                            // The number of pilot buckets
+    u32 slots;                              // The number of slots
+    u32 seed;                               // The seed mixed into each key
+    u32 reserved;                           // Currently unused
+
+} FatMphHeader;
+
+
+// Eytzinger ordered search table. (FAT_SECTION_EYTZINGER)
+//
+// The entry hashes stored in breadth first (binary heap) order, so a search
+// walks down the array and the next four levels share a cache line. keys[0]
+// is unused, keys[1] is the root. The key array starts keyOffset bytes into
+// the section data, which places it on a 64 byte boundary in the FAT. It is
+// followed by u32 keyEntry[count + 1] giving the entry index for each key.
+typedef struct FatEytzingerHeader
+{
+    u32 count;                              // The number of keys (Same as the entry count)
+    u32 keyOffset;                          // Offset from the section data to keys[0]
+
+} FatEytzingerHeader;
+
+
+// Blocked bloom filter over the entry hashes. (FAT_SECTION_BLOOM)
+//
+// Each hash sets one bit in each word of a single 256 bit block, so a test
+// reads one cache line. The blocks start blockOffset bytes into the section
+// data, which places them on a 64 byte boundary in the FAT.
+typedef struct FatBloomHeader
+{
+    u32 blocks;                             // The number of 256 bit blocks
+    u32 blockOffset;                        // Offset from the section data to the first block
+
+} FatBloomHeader;
+
+
+// Entry checksums. (FAT_SECTION_CRC)
+//
+// u32 crc[entries], in entry table order. Each is the CRC-32C of the entry's
+// uncompressed data, so it checks both the stored bytes and the inflate.
+// Tombstones have a checksum of 0.
+
+
+// Entry names. (FAT_SECTION_NAMES)
+//
+// The NUL terminated entry names, one after another. ArcEntry::name is the
+// offset of an entry's name from the start of the section data.
+
+
+// Name form. (FAT_SECTION_NAME_FORM)
+//
+// u32 form, holding NAME_FORM_xxx flags. The names are stored in this form
+// and hashed as stored, so readers put a name in the same form before they
+// hash it. FATs without the section have names stored as they were given.
+
+
+// Entry indexes in name order. (FAT_SECTION_PATHS)
+//
+// u32 entry[entries], the entry table indexes sorted by name, comparing the
+// names' bytes as unsigned (strcmp() order). The names under a prefix, such
+// as a directory, are then a run found with two binary searches.
@@ -0,0 +1,55 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include "ArcHash.h"
+
+
+// ----------------------------------------------------------------------------
+// Turns a string into a number.
+//
+// Bytes are taken as signed, as MSVC's char is, so UTF-8 names hash the same
+// where char is unsigned. ArcConstHash() must stay in step with this.
+// ----------------------------------------------------------------------------
+u32 StringHash(const char* string)
+{
+    u32 hash = 0;
+
+    while(*string)
+    {
+        hash += (s8)*string;
+        hash *= (s8)*string++;
+    }
+
+    return hash;
+}
+
+
+// ----------------------------------------------------------------------------
+// Scrambles a hash into 64 well mixed bits. (The splitmix64 finaliser)
+//
+// StringHash() clusters badly, so the indexes never use its bits directly.
+// ----------------------------------------------------------------------------
+u64 HashMix64(u64 value)
+{
+    value ^= value >> 30;
+    value *= 0xbf58476d1ce4e5b9ULL;
+    value ^= value >> 27;
+    value *= 0x94d049bb133111ebULL;
+    value ^= value >> 31;
+
+    return value;
+}
@@ -0,0 +1,29 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include "ArcEntry.h"
+
+
+// Turns a string into a number. This is the hash stored in ArcEntry::hash.
+// ArcConstHash.h has a compile time version.
+u32 StringHash(const char* string);
+
+// Scrambles a hash into 64 well mixed bits. Used by the FAT indexes.
+u64 HashMix64(u64 value);
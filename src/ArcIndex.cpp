@@ -0,0 +1,519 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <string.h>
+#include "ArcIndex.h"
+#include "ArcHash.h"
+
+
+// Average keys per pilot bucket. Lower builds faster, higher is smaller.
+#define MPH_BUCKET_SIZE         4
+
+// Keys per 100 slots. With every slot used, the last buckets to be placed
+// need a long search for the few free slots.
+#define MPH_LOAD_PERCENT        90
+
+// Attempts before giving up on a bucket and trying another seed.
+#define MPH_PILOT_LIMIT         (1 << 20)
+#define MPH_SEED_LIMIT          8
+
+// Cache line size the search tables are aligned to.
+#define CACHE_LINE_ALIGN        64
+
+// Bloom filter bits per key. 10 bits gives roughly a 1% false positive rate.
+#define BLOOM_BITS_PER_KEY      10
+#define BLOOM_BLOCK_WORDS       8
+
+
+// Prefetches a cache line for reading.
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define PREFETCH(address)       _mm_prefetch((const char*)(address), _MM_HINT_T0)
+#elif defined(__GNUC__)
+#define PREFETCH(address)       __builtin_prefetch((address))
+#else
+#define PREFETCH(address)
+#endif
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Maps a 32 bit value onto [0, range) without a divide.
+    // ------------------------------------------------------------------------
+    inline u32 FastRange(u32 value, u32 range)
+    {
+        return (u32)(((u64)value * range) >> 32);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Counts the trailing zero bits. The value must not be zero.
+    // ------------------------------------------------------------------------
+    inline u32 TrailingZeros(u32 value)
+    {
+    #if defined(_MSC_VER)
+        unsigned long index;
+        _BitScanForward(&index, value);
+        return index;
+    #elif defined(__GNUC__)
+        return __builtin_ctz(value);
+    #else
+        u32 count = 0;
+        while ((value & 1) == 0)
+        {
+            value >>= 1;
+            count++;
+        }
+        return count;
+    #endif
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the mixed key for a hash.
+    // ------------------------------------------------------------------------
+    inline u64 MphKey(u32 hash, u32 seed)
+    {
+        return HashMix64(((u64)seed << 32) | hash);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the slot for a key once the buckets pilot is known. The pilot is
+    // mixed in before the range reduction, so keys that share a bucket never
+    // stay tied to the same slot whatever the pilot.
+    // ------------------------------------------------------------------------
+    inline u32 MphSlot(u64 key, u32 pilot, u32 slots)
+    {
+        return FastRange((u32)(HashMix64(key ^ pilot) >> 32), slots);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Tries to place every bucket using the given seed.
+    // ------------------------------------------------------------------------
+    bool MphSearch(const u32 *hashes, const u32 *entries, u32 count, u32 buckets, u32 slots, u32 seed, u32 *pilots, u32 *slotEntry)
+    {
+        std::vector<u64>    keys(count);
+        std::vector<u32>    bucketOf(count);
+        std::vector<u32>    bucketStart(buckets + 1, 0);
+        std::vector<u32>    members(count);
+        std::vector<u8>     taken(slots, 0);
+        std::vector<u32>    placed;
+
+        // Distribute the keys over the buckets.
+        for (u32 i=0; i<count; i++)
+        {
+            keys[i]     = MphKey(hashes[i], seed);
+            bucketOf[i] = FastRange((u32)(keys[i] >> 32), buckets);
+            bucketStart[bucketOf[i] + 1]++;
+        }
+
+        u32 largest = 0;
+        for (u32 b=0; b<buckets; b++)
+        {
+            if (bucketStart[b + 1] > largest)
+                largest = bucketStart[b + 1];
+
+            bucketStart[b + 1] += bucketStart[b];
+        }
+
+        {
+            std::vector<u32> fill(bucketStart.begin(), bucketStart.end() - 1);
+            for (u32 i=0; i<count; i++)
+            {
+                members[fill[bucketOf[i]]++] = i;
+            }
+        }
+
+        // Order the buckets largest first, as those are the hardest to place.
+        std::vector<u32> order;
+        order.reserve(buckets);
+        for (u32 size=largest; size > 0; size--)
+        {
+            for (u32 b=0; b<buckets; b++)
+            {
+                if (bucketStart[b + 1] - bucketStart[b] == size)
+                    order.push_back(b);
+            }
+        }
+
+        // Empty buckets never get looked up by a real key.
+        memset(pilots, 0, buckets * sizeof(u32));
+
+        for (size_t o=0; o<order.size(); o++)
+        {
+            u32  b     = order[o];
+            u32  first = bucketStart[b];
+            u32  last  = bucketStart[b + 1];
+            bool found = false;
+
+            for (u32 pilot=0; pilot<MPH_PILOT_LIMIT && !found; pilot++)
+            {
+                placed.clear();
+                found = true;
+
+                for (u32 m=first; m<last; m++)
+                {
+                    u32 slot = MphSlot(keys[members[m]], pilot, slots);
+                    if (taken[slot])
+                    {
+                        found = false;
+                        break;
+                    }
+
+                    // Mark now so keys in the same bucket can't collide.
+                    taken[slot] = 1;
+                    placed.push_back(slot);
+                }
+
+                if (found)
+                {
+                    pilots[b] = pilot;
+                    for (u32 m=first; m<last; m++)
+                    {
+                        slotEntry[placed[m - first]] = entries[members[m]];
+                    }
+                }
+                else
+                {
+                    for (size_t p=0; p<placed.size(); p++)
+                    {
+                        taken[placed[p]] = 0;
+                    }
+                }
+            }
+
+            if (!found)
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the padding that puts data on a cache line, given the FAT offset
+    // of the section data and the size of the section header.
+    // ------------------------------------------------------------------------
+    u32 AlignedOffset(u32 dataOffset, u32 headerSize)
+    {
+        u32 offset = headerSize;
+        while (((dataOffset + offset) % CACHE_LINE_ALIGN) != 0)
+        {
+            offset += sizeof(u32);
+        }
+
+        return offset;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the bloom filter block and bit mask seed for a hash.
+    // ------------------------------------------------------------------------
+    inline const u32 *BloomBlock(const FatBloomHeader *header, u32 hash, u32 &lane)
+    {
+        u64 key = HashMix64(hash);
+        lane    = (u32)key;
+
+        const u32 *blocks = (const u32*)((const u8*)header + header->blockOffset);
+        return blocks + FastRange((u32)(key >> 32), header->blocks) * BLOOM_BLOCK_WORDS;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the bit to set in word i of a bloom filter block.
+    // ------------------------------------------------------------------------
+    inline u32 BloomBit(u32 lane, u32 i)
+    {
+        // Odd multipliers from the split block bloom filter design.
+        static const u32 salt[BLOOM_BLOCK_WORDS] =
+        {
+            0x47b6137b, 0x44974d91, 0x8824ad5b, 0xa2b7289d,
+            0x705495c7, 0x2df1424b, 0x9efc4947, 0x5c6bfb31,
+        };
+
+        return 1u << ((lane * salt[i]) >> 27);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Fills the Eytzinger tree rooted at k with the next sorted keys.
+    // ------------------------------------------------------------------------
+    void EytzingerFill(const u32 *hashes, u32 count, u32 &next, u32 k, u32 *keys, u32 *keyEntry)
+    {
+        if (k <= count)
+        {
+            EytzingerFill(hashes, count, next, 2 * k, keys, keyEntry);
+
+            keys[k]     = hashes[next];
+            keyEntry[k] = next++;
+
+            EytzingerFill(hashes, count, next, 2 * k + 1, keys, keyEntry);
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Builds a perfect hash over the entry hashes.
+//
+// A PTHash style hash and displace scheme. Keys are spread over buckets and
+// each bucket gets a pilot value that moves all its keys into free slots.
+// A lookup is then one pilot read and one slot read. The keys are the
+// distinct hashes, each mapped to the first entry holding it. Unused slots
+// point at entry 0, whose hash won't match.
+// ----------------------------------------------------------------------------
+bool MphBuild(const u32 *hashes, u32 count, std::vector<u8> &section)
+{
+    if (count == 0)
+        return false;
+
+    std::vector<u32> keys;
+    std::vector<u32> entries;
+
+    for (u32 i=0; i<count; i++)
+    {
+        if (i == 0 || hashes[i] != hashes[i - 1])
+        {
+            keys.push_back(hashes[i]);
+            entries.push_back(i);
+        }
+    }
+
+    u32 distinct = keys.size();
+    u32 buckets  = distinct / MPH_BUCKET_SIZE + 1;
+    u32 slots    = (u32)((u64)distinct * 100 / MPH_LOAD_PERCENT) + 1;
+
+    section.assign(sizeof(FatMphHeader) + ((size_t)buckets + slots) * sizeof(u32), 0);
+
+    FatMphHeader *header    = (FatMphHeader*)&section[0];
+    u32          *pilots    = (u32*)(header + 1);
+    u32          *slotEntry = pilots + buckets;
+
+    header->buckets  = buckets;
+    header->slots    = slots;
+    header->reserved = 0;
+
+    for (u32 attempt=0; attempt<MPH_SEED_LIMIT; attempt++)
+    {
+        header->seed = 0x9e3779b9 * (attempt + 1);
+
+        memset(slotEntry, 0, slots * sizeof(u32));
+
+        if (MphSearch(&keys[0], &entries[0], distinct, buckets, slots, header->seed, pilots, slotEntry))
+        {
+            return true;
+        }
+    }
+
+    section.clear();
+    return false;
+}
+
+
+// ----------------------------------------------------------------------------
+// Checks the section is well formed.
+// ----------------------------------------------------------------------------
+bool MphValidate(const u8 *section, u32 size, u32 entryCount)
+{
+    if (size < sizeof(FatMphHeader))
+        return false;
+
+    const FatMphHeader *header = (const FatMphHeader*)section;
+    if (header->buckets == 0 || header->slots == 0)
+        return false;
+
+    if ((u64)size < sizeof(FatMphHeader) + ((u64)header->buckets + header->slots) * sizeof(u32))
+        return false;
+
+    const u32 *slotEntry = (const u32*)(header + 1) + header->buckets;
+    for (u32 i=0; i<header->slots; i++)
+    {
+        if (slotEntry[i] >= entryCount)
+            return false;
+    }
+
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Looks up the first entry index for a hash.
+// ----------------------------------------------------------------------------
+u32 MphLookup(const u8 *section, u32 hash)
+{
+    const FatMphHeader *header    = (const FatMphHeader*)section;
+    const u32          *pilots    = (const u32*)(header + 1);
+    const u32          *slotEntry = pilots + header->buckets;
+
+    u64 key    = MphKey(hash, header->seed);
+    u32 bucket = FastRange((u32)(key >> 32), header->buckets);
+
+    return slotEntry[MphSlot(key, pilots[bucket], header->slots)];
+}
+
+
+// ----------------------------------------------------------------------------
+// Builds the Eytzinger search table.
+//
+// The tree is filled by an in order walk, so it holds the sorted keys in
+// binary heap order. The key array is padded out to a cache line boundary.
+// ----------------------------------------------------------------------------
+void EytzingerBuild(const u32 *hashes, u32 count, u32 dataOffset, std::vector<u8> &section)
+{
+    u32 keyOffset = AlignedOffset(dataOffset, sizeof(FatEytzingerHeader));
+
+    section.assign(keyOffset + (count + 1) * 2 * sizeof(u32), 0);
+
+    FatEytzingerHeader *header   = (FatEytzingerHeader*)&section[0];
+    u32                *keys     = (u32*)(&section[0] + keyOffset);
+    u32                *keyEntry = keys + count + 1;
+
+    header->count     = count;
+    header->keyOffset = keyOffset;
+
+    u32 next = 0;
+    EytzingerFill(hashes, count, next, 1, keys, keyEntry);
+}
+
+
+// ----------------------------------------------------------------------------
+// Checks the section is well formed.
+// ----------------------------------------------------------------------------
+bool EytzingerValidate(const u8 *section, u32 size, u32 entryCount)
+{
+    if (size < sizeof(FatEytzingerHeader))
+        return false;
+
+    const FatEytzingerHeader *header = (const FatEytzingerHeader*)section;
+    if (header->count != entryCount || (header->keyOffset % sizeof(u32)) != 0)
+        return false;
+
+    if ((u64)size < header->keyOffset + ((u64)header->count + 1) * 2 * sizeof(u32))
+        return false;
+
+    const u32 *keyEntry = (const u32*)(section + header->keyOffset) + header->count + 1;
+    for (u32 k=1; k<=header->count; k++)
+    {
+        if (keyEntry[k] >= entryCount)
+            return false;
+    }
+
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Searches the Eytzinger table.
+//
+// The loop is branch free. Each step prefetches the line holding the keys
+// four levels further down, so the memory latency overlaps the search.
+// ----------------------------------------------------------------------------
+s32 EytzingerLookup(const u8 *section, u32 hash)
+{
+    const FatEytzingerHeader *header   = (const FatEytzingerHeader*)section;
+    const u32                *keys     = (const u32*)(section + header->keyOffset);
+    const u32                *keyEntry = keys + header->count + 1;
+
+    u32 count = header->count;
+    u32 k     = 1;
+
+    while (k <= count)
+    {
+        PREFETCH(keys + 16 * k);
+        k = 2 * k + (keys[k] < hash);
+    }
+
+    // Undo the right turns taken after the last left turn, leaving the
+    // first key not less than the hash.
+    k >>= TrailingZeros(~k) + 1;
+
+    if (k != 0 && keys[k] == hash)
+    {
+        return (s32)keyEntry[k];
+    }
+
+    return -1;
+}
+
+
+// ----------------------------------------------------------------------------
+// Builds the bloom filter.
+//
+// A split block filter. Each key picks one 256 bit block and sets one bit in
+// each of its eight words, so the filter answers from a single cache line.
+// ----------------------------------------------------------------------------
+void BloomBuild(const u32 *hashes, u32 count, u32 dataOffset, std::vector<u8> &section)
+{
+    u32 blocks      = (count * BLOOM_BITS_PER_KEY + 255) / 256 + 1;
+    u32 blockOffset = AlignedOffset(dataOffset, sizeof(FatBloomHeader));
+
+    section.assign(blockOffset + blocks * BLOOM_BLOCK_WORDS * sizeof(u32), 0);
+
+    FatBloomHeader *header = (FatBloomHeader*)&section[0];
+    header->blocks      = blocks;
+    header->blockOffset = blockOffset;
+
+    for (u32 i=0; i<count; i++)
+    {
+        u32  lane;
+        u32 *block = (u32*)BloomBlock(header, hashes[i], lane);
+
+        for (u32 w=0; w<BLOOM_BLOCK_WORDS; w++)
+        {
+            block[w] |= BloomBit(lane, w);
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Checks the section is well formed.
+// ----------------------------------------------------------------------------
+bool BloomValidate(const u8 *section, u32 size)
+{
+    if (size < sizeof(FatBloomHeader))
+        return false;
+
+    const FatBloomHeader *header = (const FatBloomHeader*)section;
+    if (header->blocks == 0 || (header->blockOffset % sizeof(u32)) != 0)
+        return false;
+
+    return (u64)size >= header->blockOffset + (u64)header->blocks * BLOOM_BLOCK_WORDS * sizeof(u32);
+}
+
+
+// ----------------------------------------------------------------------------
+// Tests the bloom filter.
+// ----------------------------------------------------------------------------
+bool BloomMayContain(const u8 *section, u32 hash)
+{
+    u32        lane;
+    const u32 *block = BloomBlock((const FatBloomHeader*)section, hash, lane);
+
+    u32 missing = 0;
+    for (u32 w=0; w<BLOOM_BLOCK_WORDS; w++)
+    {
+        missing |= BloomBit(lane, w) & ~block[w];
+    }
+
+    return missing == 0;
+}
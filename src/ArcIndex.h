@@ -0,0 +1,58 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <vector>
+#include "ArcEntry.h"
+
+
+// Builds a FAT_SECTION_MPH_V2 section over the entry hashes, which must be
+// sorted, as in the FAT. Entries may share a hash. Returns false if no
+// perfect hash could be found.
+bool MphBuild(const u32 *hashes, u32 count, std::vector<u8> &section);
+
+// Checks a FAT_SECTION_MPH_V2 section is well formed for the entry count.
+bool MphValidate(const u8 *section, u32 size, u32 entryCount);
+
+// Returns the index of the first entry with the hash. The caller must check
+// the entry hash matches, as keys not in the archive map to an arbitrary
+// entry.
+u32  MphLookup(const u8 *section, u32 hash);
+
+
+// Builds a FAT_SECTION_EYTZINGER section over the sorted entry hashes.
+// dataOffset is the FAT offset the section data will be written at.
+void EytzingerBuild(const u32 *hashes, u32 count, u32 dataOffset, std::vector<u8> &section);
+
+// Checks a FAT_SECTION_EYTZINGER section is well formed for the entry count.
+bool EytzingerValidate(const u8 *section, u32 size, u32 entryCount);
+
+// Returns the index of the first entry with the hash, or -1 if there's none.
+s32  EytzingerLookup(const u8 *section, u32 hash);
+
+
+// Builds a FAT_SECTION_BLOOM section over the entry hashes.
+// dataOffset is the FAT offset the section data will be written at.
+void BloomBuild(const u32 *hashes, u32 count, u32 dataOffset, std::vector<u8> &section);
+
+// Checks a FAT_SECTION_BLOOM section is well formed.
+bool BloomValidate(const u8 *section, u32 size);
+
+// Returns false if the hash is definitely not in the archive.
+bool BloomMayContain(const u8 *section, u32 hash);
@@ -0,0 +1,363 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "ArcPrefetch.h"
+#include "ArcUnicode.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#endif
+
+
+// Entries this close together are prefetched as one range.
+#define PREFETCH_GAP        (64 * 1024)
+
+// Reads that follow on within this gap count as in order.
+#define SEQUENTIAL_GAP      (64 * 1024)
+
+// The number of in order reads before reading ahead starts.
+#define SEQUENTIAL_RUN      3
+
+// How far past the current read to read ahead. More is asked for when half
+// of this has been used.
+#define READAHEAD_SIZE      (4 * 1024 * 1024)
+
+// The size of the reads that warm the file cache on Windows.
+#define WARM_BLOCK          (1024 * 1024)
+
+
+// Seeks with 64 bit offsets, as entries can lie beyond 2GB.
+#if defined(_MSC_VER)
+#define ARC_FSEEK(fp, offset)       _fseeki64((fp), (offset), SEEK_SET)
+#else
+#define ARC_FSEEK(fp, offset)       fseeko((fp), (off_t)(offset), SEEK_SET)
+#endif
+
+
+namespace
+{
+    // A range of the archive data file to prefetch.
+    typedef struct PrefetchRange
+    {
+        u64     offset;                         // The first byte
+        u64     size;                           // The number of bytes
+
+    } PrefetchRange;
+}
+
+
+// The background thread and the in order read tracking.
+struct ArcPrefetcher
+{
+    ArcArchive                 *archive;        // The archive it is attached to
+    FILE                       *fp;             // The thread's handle on the data file
+    std::thread                 thread;         // Hands ranges to the OS
+    std::deque<PrefetchRange>   ranges;         // Ranges waiting for the thread
+    std::mutex                  lock;           // Guards everything below
+    std::condition_variable     wake;           // Signalled when ranges are queued, or on close
+    bool                        closing;        // Should the thread stop?
+    u64                         lastEnd;        // The end of the last entry read
+    u32                         run;            // The number of in order reads in a row
+    u64                         aheadEnd;       // How far ahead has been asked for
+};
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Hands a range to the OS.
+    // ------------------------------------------------------------------------
+    void Warm(FILE *fp, const PrefetchRange &range, std::vector<u8> &scratch)
+    {
+#if defined(_WIN32)
+        // Windows has no readahead hint for files, so the range is read and
+        // thrown away, which leaves it in the file cache.
+        if (ARC_FSEEK(fp, range.offset) != 0)
+            return;
+
+        u64 left = range.size;
+        while (left > 0)
+        {
+            size_t size = (size_t)std::min<u64>(left, WARM_BLOCK);
+
+            if (fread(&scratch[0], 1, size, fp) != size)
+                break;
+
+            left -= size;
+        }
+#else
+        (void)scratch;
+
+        posix_fadvise(fileno(fp), (off_t)range.offset, (off_t)range.size, POSIX_FADV_WILLNEED);
+#endif
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Hands ranges to the OS until the prefetcher closes.
+    // ------------------------------------------------------------------------
+    void Worker(ArcPrefetcher *prefetcher)
+    {
+        std::vector<u8> scratch(WARM_BLOCK);
+
+        for (;;)
+        {
+            PrefetchRange range;
+            {
+                std::unique_lock<std::mutex> guard(prefetcher->lock);
+                while (prefetcher->ranges.empty() && !prefetcher->closing)
+                {
+                    prefetcher->wake.wait(guard);
+                }
+
+                if (prefetcher->closing)
+                    break;
+
+                range = prefetcher->ranges.front();
+                prefetcher->ranges.pop_front();
+            }
+
+            Warm(prefetcher->fp, range, scratch);
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Orders entries by the position of their data.
+    // ------------------------------------------------------------------------
+    bool EntryOffsetLess(const ArcEntry *lhs, const ArcEntry *rhs)
+    {
+        return lhs->offset < rhs->offset;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Queues the data of a set of entries, sorted by offset, as ranges.
+    // Entries up to PREFETCH_GAP apart share a range.
+    // ------------------------------------------------------------------------
+    void QueueEntries(ArcPrefetcher *prefetcher, std::vector<const ArcEntry*> &entries)
+    {
+        std::sort(entries.begin(), entries.end(), EntryOffsetLess);
+
+        std::vector<PrefetchRange> ranges;
+        for (size_t i=0; i<entries.size(); i++)
+        {
+            u64 start = entries[i]->offset;
+            u64 end   = start + ArcStoredSize(entries[i]);
+
+            if (end == start)
+                continue;
+
+            if (!ranges.empty() && start <= ranges.back().offset + ranges.back().size + PREFETCH_GAP)
+            {
+                ranges.back().size = std::max(ranges.back().size, end - ranges.back().offset);
+            }
+            else
+            {
+                PrefetchRange range = { start, end - start };
+                ranges.push_back(range);
+            }
+        }
+
+        if (ranges.empty())
+            return;
+
+        {
+            std::lock_guard<std::mutex> guard(prefetcher->lock);
+            prefetcher->ranges.insert(prefetcher->ranges.end(), ranges.begin(), ranges.end());
+        }
+
+        prefetcher->wake.notify_one();
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Starts prefetching for an archive.
+// ----------------------------------------------------------------------------
+ArcPrefetcher *ArcPrefetchOpen(ArcArchive &archive, const char *arcFilename)
+{
+    FILE *fp = fopen(arcFilename, "rb");
+    if (fp == NULL)
+        return NULL;
+
+    ArcPrefetcher *prefetcher = new ArcPrefetcher;
+    prefetcher->archive  = &archive;
+    prefetcher->fp       = fp;
+    prefetcher->closing  = false;
+    prefetcher->lastEnd  = 0;
+    prefetcher->run      = 0;
+    prefetcher->aheadEnd = 0;
+    prefetcher->thread   = std::thread(Worker, prefetcher);
+
+    archive.prefetcher = prefetcher;
+
+    return prefetcher;
+}
+
+
+// ----------------------------------------------------------------------------
+// Stops prefetching. Ranges not yet handed over are only hints, so they are
+// dropped.
+// ----------------------------------------------------------------------------
+void ArcPrefetchClose(ArcPrefetcher *prefetcher)
+{
+    if (prefetcher == NULL)
+        return;
+
+    {
+        std::lock_guard<std::mutex> guard(prefetcher->lock);
+        prefetcher->closing = true;
+    }
+
+    prefetcher->wake.notify_one();
+    prefetcher->thread.join();
+
+    if (prefetcher->archive->prefetcher == prefetcher)
+    {
+        prefetcher->archive->prefetcher = NULL;
+    }
+
+    fclose(prefetcher->fp);
+    delete prefetcher;
+}
+
+
+// ----------------------------------------------------------------------------
+// Prefetches the entries under a prefix.
+// ----------------------------------------------------------------------------
+u32 ArcPrefetchPrefix(ArcPrefetcher *prefetcher, const char *prefix)
+{
+    const ArcArchive &archive = *prefetcher->archive;
+
+    std::vector<const ArcEntry*> entries;
+
+    u32 first;
+    u32 count;
+    if (ArcFindPrefix(archive, prefix, first, count))
+    {
+        // With a path index the entries are a run of it.
+        for (u32 i=first; i<first + count; i++)
+        {
+            entries.push_back(ArcPathEntry(archive, i));
+        }
+    }
+    else
+    {
+        std::string formed = prefix;
+        if (archive.nameForm != 0 && !ArcNameIsNormal(prefix, archive.nameForm))
+        {
+            formed.resize(ArcNormaliseName(prefix, archive.nameForm, NULL, 0) + 1);
+            formed.resize(ArcNormaliseName(prefix, archive.nameForm, &formed[0], formed.size()));
+        }
+
+        for (u32 i=0; i<archive.count; i++)
+        {
+            if (strncmp(ArcEntryName(archive, &archive.entries[i]), formed.c_str(), formed.size()) == 0)
+            {
+                entries.push_back(&archive.entries[i]);
+            }
+        }
+    }
+
+    // Tombstones have no data.
+    std::vector<const ArcEntry*> live;
+    for (size_t i=0; i<entries.size(); i++)
+    {
+        if ((entries[i]->flags & ENTRY_FLAG_TOMBSTONE) == 0)
+        {
+            live.push_back(entries[i]);
+        }
+    }
+
+    QueueEntries(prefetcher, live);
+
+    return (u32)live.size();
+}
+
+
+// ----------------------------------------------------------------------------
+// Prefetches a set of entries.
+// ----------------------------------------------------------------------------
+void ArcPrefetchEntries(ArcPrefetcher *prefetcher, const ArcEntry *const *entries, u32 count)
+{
+    std::vector<const ArcEntry*> set;
+    for (u32 i=0; i<count; i++)
+    {
+        if (entries[i] && (entries[i]->flags & ENTRY_FLAG_TOMBSTONE) == 0)
+        {
+            set.push_back(entries[i]);
+        }
+    }
+
+    QueueEntries(prefetcher, set);
+}
+
+
+// ----------------------------------------------------------------------------
+// Notes a read, and reads ahead once reads are in order.
+//
+// A read counts as in order when it starts at most SEQUENTIAL_GAP after the
+// last one ended. After SEQUENTIAL_RUN of them, the READAHEAD_SIZE bytes past
+// the read are asked for, and more whenever half of that has been used.
+// ----------------------------------------------------------------------------
+void ArcPrefetchNote(ArcPrefetcher *prefetcher, const ArcEntry *pEntry)
+{
+    u64 start = pEntry->offset;
+    u64 end   = start + ArcStoredSize(pEntry);
+
+    PrefetchRange range = { 0, 0 };
+    {
+        std::lock_guard<std::mutex> guard(prefetcher->lock);
+
+        if (start >= prefetcher->lastEnd && start - prefetcher->lastEnd <= SEQUENTIAL_GAP)
+        {
+            prefetcher->run++;
+        }
+        else
+        {
+            prefetcher->run      = 0;
+            prefetcher->aheadEnd = 0;
+        }
+
+        prefetcher->lastEnd = end;
+
+        if (prefetcher->run >= SEQUENTIAL_RUN && end + READAHEAD_SIZE / 2 > prefetcher->aheadEnd)
+        {
+            range.offset = std::max(prefetcher->aheadEnd, end);
+            range.size   = end + READAHEAD_SIZE - range.offset;
+
+            prefetcher->aheadEnd = end + READAHEAD_SIZE;
+            prefetcher->ranges.push_back(range);
+        }
+    }
+
+    if (range.size > 0)
+    {
+        prefetcher->wake.notify_one();
+    }
+}
@@ -0,0 +1,54 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include "ArcReader.h"
+
+
+// Readahead for the archive data file. Entries that are used together, such
+// as a directory or a boot set, lie together in the .arc, so they can be
+// asked for as a few large ranges before they are read. A background thread
+// with its own handle on the file hands the ranges to the OS: as
+// posix_fadvise(POSIX_FADV_WILLNEED) hints, or on Windows, which has no such
+// hint for files, as reads that are thrown away but leave the data in the
+// file cache. The thread also reads ahead when entries are read in order.
+
+
+// Starts prefetching for an open archive, and attaches the prefetcher to it
+// so ArcRead() reports each read. Close it before the archive. Returns NULL
+// if the data file can't be opened.
+ArcPrefetcher  *ArcPrefetchOpen(ArcArchive &archive, const char *arcFilename);
+
+// Stops prefetching, dropping any ranges not yet handed over, and detaches
+// the prefetcher from its archive.
+void            ArcPrefetchClose(ArcPrefetcher *prefetcher);
+
+// Prefetches every entry whose name starts with prefix, such as a directory
+// ending in '/'. The prefix is put in the archive's name form first. Returns
+// the number of entries.
+u32             ArcPrefetchPrefix(ArcPrefetcher *prefetcher, const char *prefix);
+
+// Prefetches a set of entries, such as a boot set.
+void            ArcPrefetchEntries(ArcPrefetcher *prefetcher, const ArcEntry *const *entries, u32 count);
+
+// Reports that an entry is being read. After a few reads that follow on in
+// the file, the data beyond them is read ahead. Called by ArcRead(), and
+// for reads done elsewhere.
+void            ArcPrefetchNote(ArcPrefetcher *prefetcher, const ArcEntry *pEntry);
@@ -0,0 +1,886 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include "ArcReader.h"
+#include "ArcHash.h"
+#include "ArcCrc.h"
+#include "ArcIndex.h"
+#include "ArcPrefetch.h"
+#include "ArcUnicode.h"
+#include "zlib/zlib.h"
+
+
+// The FAT is loaded at this alignment.
+#define FAT_ALIGN       64
+
+// Names up to this long are put in their name form on the stack.
+#define NAME_LOCAL      256
+
+
+// Seeks with 64 bit offsets, as entries can lie beyond 2GB.
+#if defined(_MSC_VER)
+#define ARC_FSEEK(fp, offset)       _fseeki64((fp), (offset), SEEK_SET)
+#else
+#define ARC_FSEEK(fp, offset)       fseeko((fp), (off_t)(offset), SEEK_SET)
+#endif
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Walks the optional sections, which start at offset, and records the
+    // ones we use.
+    // ------------------------------------------------------------------------
+    bool ParseSections(ArcArchive &archive, u32 offset)
+    {
+        while (offset < archive.header->size)
+        {
+            if (archive.header->size - offset < sizeof(FatSection))
+                return false;
+
+            const FatSection *section = (const FatSection*)(archive.fat + offset);
+            const u8         *data    = (const u8*)(section + 1);
+
+            offset += sizeof(FatSection);
+            if (section->size > archive.header->size - offset)
+                return false;
+
+            switch(section->type)
+            {
+            case FAT_SECTION_MPH_V2:
+                if (!MphValidate(data, section->size, archive.count))
+                    return false;
+
+                archive.mph = data;
+                break;
+
+            case FAT_SECTION_EYTZINGER:
+                if (!EytzingerValidate(data, section->size, archive.count))
+                    return false;
+
+                archive.eytzinger = data;
+                break;
+
+            case FAT_SECTION_BLOOM:
+                if (!BloomValidate(data, section->size))
+                    return false;
+
+                archive.bloom = data;
+                break;
+
+            case FAT_SECTION_CRC:
+                if (section->size != archive.count * sizeof(u32))
+                    return false;
+
+                archive.crcs = (const u32*)data;
+                break;
+
+            case FAT_SECTION_NAMES:
+                if (section->size == 0 || data[section->size - 1] != 0)
+                    return false;
+
+                archive.names     = (const char*)data;
+                archive.namesSize = section->size;
+                break;
+
+            case FAT_SECTION_NAME_FORM:
+                if (section->size != sizeof(u32))
+                    return false;
+
+                archive.nameForm = *(const u32*)data;
+                break;
+
+            case FAT_SECTION_PATHS:
+                if (section->size != archive.count * sizeof(u32))
+                    return false;
+
+                for (u32 i=0; i<archive.count; i++)
+                {
+                    if (((const u32*)data)[i] >= archive.count)
+                        return false;
+                }
+
+                archive.paths = (const u32*)data;
+                break;
+
+            // Unknown sections are skipped.
+            default:
+                break;
+            }
+
+            offset += (section->size + 7) & ~7;
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Checks every entry's name lies in the name pool. The pool ends with a
+    // NUL, so each name is then terminated.
+    // ------------------------------------------------------------------------
+    bool ValidateNames(const ArcArchive &archive)
+    {
+        if (archive.count > 0 && archive.names == NULL)
+            return false;
+
+        for (u32 i=0; i<archive.count; i++)
+        {
+            if (archive.entries[i].name >= archive.namesSize)
+                return false;
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Converts an old entry table, with fixed size names, to pooled entries.
+    // ------------------------------------------------------------------------
+    bool ConvertEntries(ArcArchive &archive)
+    {
+        const ArcEntryV1 *old       = (const ArcEntryV1*)(archive.fat + sizeof(FatHeader));
+        size_t            namesSize = 0;
+
+        for (u32 i=0; i<archive.count; i++)
+        {
+            const char *end = (const char*)memchr(old[i].filename, 0, sizeof(old[i].filename));
+            if (end == NULL)
+                return false;
+
+            namesSize += end - old[i].filename + 1;
+        }
+
+        archive.convertBlock = (u8*)malloc(archive.count * sizeof(ArcEntry) + namesSize + 1);
+        if (archive.convertBlock == NULL)
+            return false;
+
+        char *names = (char*)(archive.convertBlock + archive.count * sizeof(ArcEntry));
+        u32   offset = 0;
+
+        archive.entries   = (ArcEntry*)archive.convertBlock;
+        archive.names     = names;
+        archive.namesSize = (u32)namesSize;
+
+        for (u32 i=0; i<archive.count; i++)
+        {
+            ArcEntry &entry = archive.entries[i];
+            size_t    size  = strlen(old[i].filename) + 1;
+
+            entry.hash              = old[i].hash;
+            entry.offset            = old[i].offset;
+            entry.filesize          = old[i].filesize;
+            entry.compressedSize    = old[i].compressedSize;
+            entry.compressed        = old[i].compressed;
+            entry.compressionType   = old[i].compressionType;
+            entry.flags             = old[i].flags;
+            entry.exp1              = old[i].exp1;
+            entry.name              = offset;
+
+            memcpy(names + offset, old[i].filename, size);
+            offset += (u32)size;
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets a name in a name form. Names already in it, which is nearly all
+    // of them, are used as they are. Otherwise the name is written to local,
+    // or to heap when it's longer, which the caller frees.
+    // ------------------------------------------------------------------------
+    const char *FormName(const char *name, u32 form, char *local, char *&heap)
+    {
+        heap = NULL;
+
+        if (form == 0 || ArcNameIsNormal(name, form))
+            return name;
+
+        size_t length = ArcNormaliseName(name, form, local, NAME_LOCAL);
+        if (length < NAME_LOCAL)
+            return local;
+
+        heap = (char*)malloc(length + 1);
+        if (heap == NULL)
+            return name;
+
+        ArcNormaliseName(name, form, heap, length + 1);
+        return heap;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Finds the first position in [lower, upper) of the path index whose name
+    // doesn't sort before key, comparing length chars. With after set, finds
+    // the first whose name sorts after it, so names starting with key are
+    // passed over.
+    // ------------------------------------------------------------------------
+    u32 PathSearch(const ArcArchive &archive, const char *key, size_t length, u32 lower, u32 upper, bool after)
+    {
+        while (lower < upper)
+        {
+            u32 mid = lower + ((upper - lower) / 2);
+            int cmp = strncmp(ArcEntryName(archive, archive.entries + archive.paths[mid]), key, length);
+
+            if (cmp < 0 || (after && cmp == 0))
+            {
+                lower = mid + 1;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+
+        return lower;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Orders stack entries by hash, then by layer priority.
+    // ------------------------------------------------------------------------
+    bool StackEntryLess(const ArcStackEntry &lhs, const ArcStackEntry &rhs)
+    {
+        if (lhs.hash != rhs.hash)
+            return lhs.hash < rhs.hash;
+
+        return lhs.layer < rhs.layer;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the index of the first stack entry with the hash, or the entry
+    // count if there's none.
+    // ------------------------------------------------------------------------
+    u32 StackSearch(const ArcStack &stack, u32 hash)
+    {
+        if (stack.count == 0)
+        {
+            return 0;
+        }
+
+        if (stack.mph)
+        {
+            u32 index = MphLookup(stack.mph, hash);
+            return (stack.entries[index].hash == hash) ? index : stack.count;
+        }
+
+        u32 lower = 0;
+        u32 upper = stack.count;
+
+        while (lower < upper)
+        {
+            u32 mid = lower + ((upper - lower) / 2);
+
+            if (stack.entries[mid].hash < hash)
+            {
+                lower = mid + 1;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+
+        if (lower < stack.count && stack.entries[lower].hash == hash)
+        {
+            return lower;
+        }
+
+        return stack.count;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Loads and validates a FAT file.
+// ----------------------------------------------------------------------------
+bool ArcOpen(ArcArchive &archive, const char *fatFilename, const char *arcFilename)
+{
+    memset(&archive, 0, sizeof(ArcArchive));
+
+    FILE *fp = fopen(fatFilename, "rb");
+    if (fp == NULL)
+    {
+        return false;
+    }
+
+    // Open the data file
+    FILE *arc = NULL;
+    if (arcFilename)
+    {
+        arc = fopen(arcFilename, "rb");
+        if (arc == NULL)
+        {
+            fclose(fp);
+            return false;
+        }
+    }
+
+    return ArcOpenFiles(archive, fp, arc);
+}
+
+
+// ----------------------------------------------------------------------------
+// Loads and validates a FAT from an open file.
+// ----------------------------------------------------------------------------
+bool ArcOpenFiles(ArcArchive &archive, FILE *fp, FILE *arc)
+{
+    memset(&archive, 0, sizeof(ArcArchive));
+
+    // Closed with the archive from here on.
+    archive.arc = arc;
+
+    // Get file size
+    fseek(fp, 0, SEEK_END);
+    long filesize = ftell(fp);
+    rewind(fp);
+
+    if (filesize < (long)sizeof(FatHeader))
+    {
+        fclose(fp);
+        ArcClose(archive);
+        return false;
+    }
+
+    // Read data. Aligned so the search tables sit on cache lines.
+    archive.fatBlock = (u8*)malloc(filesize + FAT_ALIGN - 1);
+    archive.fat      = (u8*)(((size_t)archive.fatBlock + FAT_ALIGN - 1) & ~(size_t)(FAT_ALIGN - 1));
+    archive.fatSize  = (u32)filesize;
+    if (archive.fatBlock == NULL || fread(archive.fat, 1, filesize, fp) != (size_t)filesize)
+    {
+        fclose(fp);
+        ArcClose(archive);
+        return false;
+    }
+
+    fclose(fp);
+
+    // Point to data
+    archive.header  = (FatHeader*)(archive.fat);
+    archive.entries = (ArcEntry*)(archive.fat + sizeof(FatHeader));
+    archive.count   = archive.header->entries;
+
+    bool v1        = archive.header->magic2 == MAGIC2;
+    u32  entrySize = v1 ? sizeof(ArcEntryV1) : sizeof(ArcEntry);
+
+    // Validate
+    if (archive.header->magic1 != MAGIC1 ||
+        (archive.header->magic2 != MAGIC2_V2 && !v1) ||
+        archive.header->size    > archive.fatSize ||
+        archive.header->size    < sizeof(FatHeader) ||
+        (u64)archive.count * entrySize > archive.header->size - sizeof(FatHeader) ||
+        !ParseSections(archive, sizeof(FatHeader) + archive.count * entrySize) ||
+        !(v1 ? ConvertEntries(archive) : ValidateNames(archive)))
+    {
+        ArcClose(archive);
+        return false;
+    }
+
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Frees a loaded FAT.
+// ----------------------------------------------------------------------------
+void ArcClose(ArcArchive &archive)
+{
+    if (archive.arc)
+    {
+        fclose(archive.arc);
+    }
+
+    free(archive.convertBlock);
+    free(archive.fatBlock);
+    memset(&archive, 0, sizeof(ArcArchive));
+}
+
+
+// ----------------------------------------------------------------------------
+// Tests the bloom filter, if there is one.
+// ----------------------------------------------------------------------------
+bool ArcMayContain(const ArcArchive &archive, u32 hash)
+{
+    if (archive.bloom)
+    {
+        return BloomMayContain(archive.bloom, hash);
+    }
+
+    return archive.count > 0;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds an entry by hash.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcFind(const ArcArchive &archive, u32 hash)
+{
+    if (archive.count == 0)
+        return NULL;
+
+    // Most misses stop here, after reading one cache line.
+    if (archive.bloom && !BloomMayContain(archive.bloom, hash))
+        return NULL;
+
+    // Perfect hash gives the only possible candidate.
+    if (archive.mph)
+    {
+        ArcEntry *pEntry = archive.entries + MphLookup(archive.mph, hash);
+        return (pEntry->hash == hash) ? pEntry : NULL;
+    }
+
+    // Cache friendly search order.
+    if (archive.eytzinger)
+    {
+        s32 index = EytzingerLookup(archive.eytzinger, hash);
+        return (index >= 0) ? archive.entries + index : NULL;
+    }
+
+    // Binary search the sorted table.
+    u32 lower = 0;
+    u32 upper = archive.count;
+
+    while (lower < upper)
+    {
+        u32 mid = lower + ((upper - lower) / 2);
+
+        if (archive.entries[mid].hash < hash)
+        {
+            lower = mid + 1;
+        }
+        else
+        {
+            upper = mid;
+        }
+    }
+
+    if (lower < archive.count && archive.entries[lower].hash == hash)
+    {
+        return archive.entries + lower;
+    }
+
+    return NULL;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds an entry by name.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcFindName(const ArcArchive &archive, const char *name)
+{
+    char        local[NAME_LOCAL];
+    char       *heap;
+    const char *key    = FormName(name, archive.nameForm, local, heap);
+    u32         hash   = StringHash(key);
+    ArcEntry   *pEntry = ArcFind(archive, hash);
+
+    // Entries sharing a hash are next to each other, and the search may land
+    // anywhere in the run, so check the whole run.
+    if (pEntry && strcmp(ArcEntryName(archive, pEntry), key) != 0)
+    {
+        ArcEntry *first = pEntry;
+        ArcEntry *last  = pEntry;
+        ArcEntry *end   = archive.entries + archive.count;
+
+        while (first > archive.entries && first[-1].hash == hash)
+        {
+            first--;
+        }
+
+        while (last + 1 < end && last[1].hash == hash)
+        {
+            last++;
+        }
+
+        for (pEntry = first; pEntry <= last; pEntry++)
+        {
+            if (strcmp(ArcEntryName(archive, pEntry), key) == 0)
+                break;
+        }
+
+        if (pEntry > last)
+        {
+            pEntry = NULL;
+        }
+    }
+
+    free(heap);
+    return pEntry;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds an asset from a generated header.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcFindAsset(const ArcArchive &archive, const ArcAsset &asset)
+{
+    if (asset.index < archive.count && archive.entries[asset.index].hash == asset.hash)
+    {
+        return archive.entries + asset.index;
+    }
+
+    return ArcFind(archive, asset.hash);
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets an entry's name.
+// ----------------------------------------------------------------------------
+const char *ArcEntryName(const ArcArchive &archive, const ArcEntry *pEntry)
+{
+    return archive.names + pEntry->name;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds the entries under a prefix.
+// ----------------------------------------------------------------------------
+bool ArcFindPrefix(const ArcArchive &archive, const char *prefix, u32 &first, u32 &count)
+{
+    first = 0;
+    count = 0;
+
+    if (archive.paths == NULL)
+        return false;
+
+    char        local[NAME_LOCAL];
+    char       *heap;
+    const char *key    = FormName(prefix, archive.nameForm, local, heap);
+    size_t      length = strlen(key);
+
+    first = PathSearch(archive, key, length, 0, archive.count, false);
+    count = PathSearch(archive, key, length, first, archive.count, true) - first;
+
+    free(heap);
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets the entry at a position in name order.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcPathEntry(const ArcArchive &archive, u32 position)
+{
+    return archive.entries + archive.paths[position];
+}
+
+
+// ----------------------------------------------------------------------------
+// Lists a directory.
+//
+// Each file costs one step, and each subdirectory one binary search to get
+// past it, so a listing never reads the names deeper down.
+// ----------------------------------------------------------------------------
+bool ArcListDirectory(const ArcArchive &archive, const char *directory, ArcListCallback callback, void *user)
+{
+    if (archive.paths == NULL)
+        return false;
+
+    std::string prefix = directory;
+    if (!prefix.empty() && prefix[prefix.size() - 1] != '/')
+    {
+        prefix += '/';
+    }
+
+    char        local[NAME_LOCAL];
+    char       *heap;
+    const char *key      = FormName(prefix.c_str(), archive.nameForm, local, heap);
+    size_t      length   = strlen(key);
+    u32         position = PathSearch(archive, key, length, 0, archive.count, false);
+    u32         end      = PathSearch(archive, key, length, position, archive.count, true);
+
+    free(heap);
+
+    while (position < end)
+    {
+        const ArcEntry *pEntry   = ArcPathEntry(archive, position);
+        const char     *fullName = ArcEntryName(archive, pEntry);
+        const char     *name     = fullName + length;
+        const char     *slash    = strchr(name, '/');
+
+        if (slash == NULL)
+        {
+            if ((pEntry->flags & ENTRY_FLAG_TOMBSTONE) == 0)
+            {
+                callback(name, (u32)strlen(name), pEntry, user);
+            }
+
+            position++;
+            continue;
+        }
+
+        callback(name, (u32)(slash - name), NULL, user);
+
+        position = PathSearch(archive, fullName, slash + 1 - fullName, position, end, true);
+    }
+
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Reads an entry's uncompressed data.
+// ----------------------------------------------------------------------------
+bool ArcRead(const ArcArchive &archive, const ArcEntry *pEntry, void *buffer)
+{
+    if (archive.arc == NULL || pEntry == NULL || (pEntry->flags & ENTRY_FLAG_TOMBSTONE))
+        return false;
+
+    if (archive.prefetcher)
+    {
+        ArcPrefetchNote(archive.prefetcher, pEntry);
+    }
+
+    if (ARC_FSEEK(archive.arc, pEntry->offset) != 0)
+        return false;
+
+    bool result = false;
+
+    if (!pEntry->compressed)
+    {
+        result = fread(buffer, 1, pEntry->filesize, archive.arc) == pEntry->filesize;
+    }
+    else
+    {
+        u8 *packed = (u8*)malloc(pEntry->compressedSize);
+        if (packed == NULL)
+            return false;
+
+        result = fread(packed, 1, pEntry->compressedSize, archive.arc) == pEntry->compressedSize &&
+                 ArcDecode(pEntry, packed, buffer);
+
+        free(packed);
+    }
+
+    return result && (!archive.verifyOnRead || ArcVerify(archive, pEntry, buffer));
+}
+
+
+// ----------------------------------------------------------------------------
+// Checks an entry's uncompressed data against its checksum.
+// ----------------------------------------------------------------------------
+bool ArcVerify(const ArcArchive &archive, const ArcEntry *pEntry, const void *buffer)
+{
+    if (archive.crcs == NULL)
+        return true;
+
+    u32 crc = (pEntry->flags & ENTRY_FLAG_TOMBSTONE) ? 0 : Crc32c(0, buffer, pEntry->filesize);
+
+    return crc == archive.crcs[pEntry - archive.entries];
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets the number of bytes an entry's data takes in the archive.
+// ----------------------------------------------------------------------------
+u32 ArcStoredSize(const ArcEntry *pEntry)
+{
+    if (pEntry->flags & ENTRY_FLAG_TOMBSTONE)
+        return 0;
+
+    return pEntry->compressed ? pEntry->compressedSize : pEntry->filesize;
+}
+
+
+// ----------------------------------------------------------------------------
+// Decodes an entry's stored data.
+// ----------------------------------------------------------------------------
+bool ArcDecode(const ArcEntry *pEntry, const void *stored, void *buffer)
+{
+    if (!pEntry->compressed)
+    {
+        memcpy(buffer, stored, pEntry->filesize);
+        return true;
+    }
+
+    uLongf size = pEntry->filesize;
+
+    return uncompress((Bytef*)buffer, &size, (const Bytef*)stored, pEntry->compressedSize) == Z_OK &&
+           size == pEntry->filesize;
+}
+
+
+// ----------------------------------------------------------------------------
+// Mounts a stack of archives.
+//
+// Every entry is gathered and sorted by hash then priority. Within a run of
+// equal hashes the first entry seen for each name wins, and winning
+// tombstones are dropped. The merged table gets a perfect hash, so lookups
+// cost the same as for a single archive.
+// ----------------------------------------------------------------------------
+bool ArcMount(ArcStack &stack, ArcArchive **layers, u32 layerCount)
+{
+    memset(&stack, 0, sizeof(ArcStack));
+
+    std::vector<ArcStackEntry> all;
+    for (u32 l=0; l<layerCount; l++)
+    {
+        for (u32 i=0; i<layers[l]->count; i++)
+        {
+            ArcStackEntry entry;
+            entry.hash   = layers[l]->entries[i].hash;
+            entry.layer  = l;
+            entry.pEntry = layers[l]->entries + i;
+
+            all.push_back(entry);
+        }
+    }
+
+    std::sort(all.begin(), all.end(), StackEntryLess);
+
+    std::vector<ArcStackEntry> visible;
+    for (size_t first=0; first<all.size(); )
+    {
+        size_t last = first;
+        while (last < all.size() && all[last].hash == all[first].hash)
+        {
+            last++;
+        }
+
+        for (size_t i=first; i<last; i++)
+        {
+            // Already decided by a higher priority entry of the same name?
+            bool hidden = false;
+            for (size_t j=first; j<i && !hidden; j++)
+            {
+                hidden = strcmp(ArcEntryName(*layers[all[j].layer], all[j].pEntry),
+                                ArcEntryName(*layers[all[i].layer], all[i].pEntry)) == 0;
+            }
+
+            if (!hidden && (all[i].pEntry->flags & ENTRY_FLAG_TOMBSTONE) == 0)
+            {
+                visible.push_back(all[i]);
+            }
+        }
+
+        first = last;
+    }
+
+    stack.layers     = layers;
+    stack.layerCount = layerCount;
+    stack.count      = visible.size();
+    stack.nameForm   = (layerCount > 0) ? layers[0]->nameForm : 0;
+
+    for (u32 l=1; l<layerCount; l++)
+    {
+        if (layers[l]->nameForm != stack.nameForm)
+        {
+            stack.nameForm = 0;
+        }
+    }
+
+    if (stack.count > 0)
+    {
+        stack.entries = (ArcStackEntry*)malloc(stack.count * sizeof(ArcStackEntry));
+        if (stack.entries == NULL)
+        {
+            return false;
+        }
+
+        memcpy(stack.entries, &visible[0], stack.count * sizeof(ArcStackEntry));
+
+        std::vector<u32> hashes(stack.count);
+        for (u32 i=0; i<stack.count; i++)
+        {
+            hashes[i] = visible[i].hash;
+        }
+
+        std::vector<u8> mph;
+        if (MphBuild(&hashes[0], stack.count, mph))
+        {
+            stack.mph = (u8*)malloc(mph.size());
+            if (stack.mph)
+            {
+                memcpy(stack.mph, &mph[0], mph.size());
+            }
+        }
+    }
+
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Frees the merged index.
+// ----------------------------------------------------------------------------
+void ArcUnmount(ArcStack &stack)
+{
+    free(stack.entries);
+    free(stack.mph);
+    memset(&stack, 0, sizeof(ArcStack));
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds a visible entry by hash.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcStackFind(const ArcStack &stack, u32 hash, u32 *layer)
+{
+    u32 index = StackSearch(stack, hash);
+    if (index == stack.count)
+    {
+        return NULL;
+    }
+
+    if (layer)
+    {
+        *layer = stack.entries[index].layer;
+    }
+
+    return stack.entries[index].pEntry;
+}
+
+
+// ----------------------------------------------------------------------------
+// Finds a visible entry by name.
+// ----------------------------------------------------------------------------
+ArcEntry *ArcStackFindName(const ArcStack &stack, const char *name, u32 *layer)
+{
+    char        local[NAME_LOCAL];
+    char       *heap;
+    const char *key    = FormName(name, stack.nameForm, local, heap);
+    u32         hash   = StringHash(key);
+    ArcEntry   *pEntry = NULL;
+
+    // Entries sharing a hash are next to each other.
+    for (u32 i=StackSearch(stack, hash); i<stack.count && stack.entries[i].hash == hash; i++)
+    {
+        const ArcStackEntry &entry = stack.entries[i];
+
+        if (strcmp(ArcEntryName(*stack.layers[entry.layer], entry.pEntry), key) == 0)
+        {
+            if (layer)
+            {
+                *layer = stack.entries[i].layer;
+            }
+
+            pEntry = stack.entries[i].pEntry;
+            break;
+        }
+    }
+
+    free(heap);
+    return pEntry;
+}
@@ -0,0 +1,169 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <stdio.h>
+#include "ArcEntry.h"
+
+
+// Readahead for an archive, from ArcPrefetch.h.
+typedef struct ArcPrefetcher ArcPrefetcher;
+
+
+// Reader side of the archive format. This code has no windows dependencies
+// so it can be dropped into game code.
+typedef struct ArcArchive
+{
+    u8         *fatBlock;                   // The allocation holding the FAT
+    u8         *fat;                        // The loaded FAT, cache line aligned
+    u32         fatSize;                    // The size of the loaded FAT
+    FatHeader  *header;                     // The FAT header
+    ArcEntry   *entries;                    // The entry table, sorted by hash
+    u32         count;                      // The number of entries
+    const char *names;                      // The entry name pool
+    u32         namesSize;                  // The size of the name pool
+    u8         *convertBlock;               // Entries and names converted from an old FAT, or NULL
+    u32         nameForm;                   // The NAME_FORM_xxx the names are stored in, or 0
+    const u8   *mph;                        // Perfect hash section, or NULL
+    const u8   *eytzinger;                  // Eytzinger search table section, or NULL
+    const u8   *bloom;                      // Bloom filter section, or NULL
+    const u32  *crcs;                       // Entry checksums, or NULL
+    const u32  *paths;                      // Entry indexes in name order, or NULL
+    bool        verifyOnRead;               // Check each ArcRead against its checksum?
+    FILE       *arc;                        // The archive data file, or NULL
+    ArcPrefetcher *prefetcher;              // Told of each ArcRead, or NULL
+
+} ArcArchive;
+
+
+// An asset known when compiling, from a header written by pat -header.
+typedef struct ArcAsset
+{
+    u32         hash;                       // The entry hash
+    u32         index;                      // The entry's index in the FAT the header was written with
+
+} ArcAsset;
+
+
+// Called by ArcListDirectory() for each item in the directory. name is the
+// item's name within the directory, length chars long and not NUL terminated.
+// pEntry is the file, or NULL for a subdirectory.
+typedef void (*ArcListCallback)(const char *name, u32 length, const ArcEntry *pEntry, void *user);
+
+
+// One entry of a mounted stack.
+typedef struct ArcStackEntry
+{
+    u32         hash;                       // The entry hash
+    u32         layer;                      // The layer holding the entry
+    ArcEntry   *pEntry;                     // The entry
+
+} ArcStackEntry;
+
+
+// A stack of archives, such as a base archive and its patches, with a
+// merged index built when it's mounted.
+typedef struct ArcStack
+{
+    ArcArchive    **layers;                 // The layers, highest priority first
+    u32             layerCount;             // The number of layers
+    ArcStackEntry  *entries;                // The visible entries, sorted by hash
+    u32             count;                  // The number of visible entries
+    u8             *mph;                    // Perfect hash over the entries, or NULL
+    u32             nameForm;               // The layers' name form, or 0 if they differ
+
+} ArcStack;
+
+
+// Loads and validates a FAT file. The archive data file is optional and is
+// only needed to read entries. Old FATs with fixed size names are converted
+// to the pooled form as they're loaded.
+bool        ArcOpen(ArcArchive &archive, const char *fatFilename, const char *arcFilename = NULL);
+
+// As ArcOpen, with files the caller has opened, for names fopen can't take.
+// The FAT file is closed once it's read, and the data file, which may be
+// NULL, by ArcClose. Both are closed if this fails.
+bool        ArcOpenFiles(ArcArchive &archive, FILE *fatFile, FILE *arcFile);
+
+// Frees a loaded FAT and closes the archive data file.
+void        ArcClose(ArcArchive &archive);
+
+// Returns false if the hash is definitely not in the archive. Without a
+// bloom filter this always returns true.
+bool        ArcMayContain(const ArcArchive &archive, u32 hash);
+
+// Finds an entry by hash. Returns NULL if there's no such entry.
+ArcEntry   *ArcFind(const ArcArchive &archive, u32 hash);
+
+// Finds an entry by name, checking the stored filename to reject collisions.
+// The name is UTF-8, and is put in the archive's name form before it's
+// hashed. Names already in the form are hashed as they are.
+ArcEntry   *ArcFindName(const ArcArchive &archive, const char *name);
+
+// Finds an asset from a generated header. The index is used when it still
+// holds the asset's hash, so a lookup is one compare. If the FAT has changed
+// since the header was written, it falls back to ArcFind().
+ArcEntry   *ArcFindAsset(const ArcArchive &archive, const ArcAsset &asset);
+
+// Gets an entry's name.
+const char *ArcEntryName(const ArcArchive &archive, const ArcEntry *pEntry);
+
+// Finds the entries whose names start with prefix, using the path index.
+// They are ArcPathEntry(archive, first) up to first + count - 1, in name
+// order. The prefix is put in the archive's name form first. Returns false if
+// the archive has no path index (pat -paths).
+bool        ArcFindPrefix(const ArcArchive &archive, const char *prefix, u32 &first, u32 &count);
+
+// Gets the entry at a position in name order, from the path index.
+ArcEntry   *ArcPathEntry(const ArcArchive &archive, u32 position);
+
+// Lists a directory, such as "textures/ui" or "" for the root, using the path
+// index. Calls back once for each file directly in it, in name order, and
+// once for each subdirectory, which is then skipped with a binary search.
+// Tombstones are left out. Returns false if the archive has no path index.
+bool        ArcListDirectory(const ArcArchive &archive, const char *directory, ArcListCallback callback, void *user);
+
+// Reads an entry's uncompressed data. The buffer must hold filesize bytes.
+bool        ArcRead(const ArcArchive &archive, const ArcEntry *pEntry, void *buffer);
+
+// Checks an entry's uncompressed data against its checksum. Returns true if
+// the archive has no checksums. Set verifyOnRead to do this in ArcRead.
+bool        ArcVerify(const ArcArchive &archive, const ArcEntry *pEntry, const void *buffer);
+
+// Gets the number of bytes an entry's data takes in the archive.
+u32         ArcStoredSize(const ArcEntry *pEntry);
+
+// Decodes an entry's stored data, as read from the archive, into a buffer
+// of filesize bytes. Lets callers do their own file reads.
+bool        ArcDecode(const ArcEntry *pEntry, const void *stored, void *buffer);
+
+// Mounts a stack of open archives. layers[0] has the highest priority. An
+// entry hides entries of the same name in lower layers, and tombstones
+// remove them. The layers must stay open while the stack is mounted.
+bool        ArcMount(ArcStack &stack, ArcArchive **layers, u32 layerCount);
+
+// Frees the merged index. The layers are not closed.
+void        ArcUnmount(ArcStack &stack);
+
+// Finds a visible entry by hash. layer is set to the layer holding it.
+ArcEntry   *ArcStackFind(const ArcStack &stack, u32 hash, u32 *layer = NULL);
+
+// Finds a visible entry by name. layer is set to the layer holding it. The
+// name is put in the layers' name form, as in ArcFindName.
+ArcEntry   *ArcStackFindName(const ArcStack &stack, const char *name, u32 *layer = NULL);
@@ -0,0 +1,465 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include <string.h>
+#include <vector>
+#include "ArcUnicode.h"
+
+
+// A code point's normalisation and case data.
+typedef struct UnicodeRecord
+{
+    s32 lower;                              // Added to case fold
+    s32 upper;                              // Added to map to upper case
+    u16 decomposition;                      // Index of the full canonical decomposition
+    u8  decompositionLength;                // The number of code points in it, or 0
+    u8  ccc;                                // Canonical combining class
+    u8  flags;                              // UNICODE_FLAG_xxx
+
+} UnicodeRecord;
+
+
+// A pair of code points that composes to a primary composite.
+typedef struct UnicodeComposition
+{
+    u32 first;
+    u32 second;
+    u32 composite;
+
+} UnicodeComposition;
+
+
+#include "ArcUnicodeTables.h"
+
+
+// Hangul syllables are decomposed and composed arithmetically.
+#define HANGUL_S_BASE       0xac00
+#define HANGUL_L_BASE       0x1100
+#define HANGUL_V_BASE       0x1161
+#define HANGUL_T_BASE       0x11a7
+#define HANGUL_L_COUNT      19
+#define HANGUL_V_COUNT      21
+#define HANGUL_T_COUNT      28
+#define HANGUL_N_COUNT      (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT      (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+
+// Invalid UTF-8 bytes are carried through as this plus the byte. They're
+// past the last code point, so they have no data and never compose.
+#define INVALID_BYTE        0x110000
+
+// Byte lanes of a word.
+#define WORD_ONES           0x0101010101010101ULL
+#define WORD_HIGHS          0x8080808080808080ULL
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Gets a code point's data.
+    // ------------------------------------------------------------------------
+    inline const UnicodeRecord &Record(u32 code)
+    {
+        if (code >= UNICODE_LIMIT)
+            return unicodeRecords[0];
+
+        u32 block = unicodeStage1[code >> UNICODE_SHIFT];
+
+        return unicodeRecords[unicodeStage2[(block << UNICODE_SHIFT) + (code & ((1 << UNICODE_SHIFT) - 1))]];
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Decodes a UTF-8 sequence and steps past it. Overlong forms, surrogates
+    // and truncated sequences give INVALID_BYTE plus their first byte.
+    // ------------------------------------------------------------------------
+    u32 DecodeUtf8(const u8 *&p)
+    {
+        u32 lead = *p++;
+        if (lead < 0x80)
+            return lead;
+
+        u32 code;
+        u32 count;
+        u32 minimum;
+
+        if (lead >= 0xc2 && lead < 0xe0)
+        {
+            code = lead & 0x1f; count = 1; minimum = 0x80;
+        }
+        else if (lead >= 0xe0 && lead < 0xf0)
+        {
+            code = lead & 0x0f; count = 2; minimum = 0x800;
+        }
+        else if (lead >= 0xf0 && lead < 0xf5)
+        {
+            code = lead & 0x07; count = 3; minimum = 0x10000;
+        }
+        else
+        {
+            return INVALID_BYTE + lead;
+        }
+
+        // A NUL fails the continuation test, so this never reads past it.
+        for (u32 i=0; i<count; i++)
+        {
+            if ((p[i] & 0xc0) != 0x80)
+                return INVALID_BYTE + lead;
+
+            code = (code << 6) | (p[i] & 0x3f);
+        }
+
+        if (code < minimum || code > 0x10ffff || (code >= 0xd800 && code < 0xe000))
+            return INVALID_BYTE + lead;
+
+        p += count;
+        return code;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Encodes a code point, or an invalid byte, as UTF-8. Returns the length.
+    // ------------------------------------------------------------------------
+    u32 EncodeUtf8(u32 code, u8 *out)
+    {
+        if (code < 0x80)
+        {
+            out[0] = (u8)code;
+            return 1;
+        }
+
+        if (code >= INVALID_BYTE)
+        {
+            out[0] = (u8)(code - INVALID_BYTE);
+            return 1;
+        }
+
+        if (code < 0x800)
+        {
+            out[0] = (u8)(0xc0 | (code >> 6));
+            out[1] = (u8)(0x80 | (code & 0x3f));
+            return 2;
+        }
+
+        if (code < 0x10000)
+        {
+            out[0] = (u8)(0xe0 | (code >> 12));
+            out[1] = (u8)(0x80 | ((code >> 6) & 0x3f));
+            out[2] = (u8)(0x80 | (code & 0x3f));
+            return 3;
+        }
+
+        out[0] = (u8)(0xf0 | (code >> 18));
+        out[1] = (u8)(0x80 | ((code >> 12) & 0x3f));
+        out[2] = (u8)(0x80 | ((code >> 6) & 0x3f));
+        out[3] = (u8)(0x80 | (code & 0x3f));
+        return 4;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Appends a code point's full canonical decomposition.
+    // ------------------------------------------------------------------------
+    void Decompose(u32 code, std::vector<u32> &codes)
+    {
+        if (code >= HANGUL_S_BASE && code < HANGUL_S_BASE + HANGUL_S_COUNT)
+        {
+            u32 index = code - HANGUL_S_BASE;
+
+            codes.push_back(HANGUL_L_BASE + index / HANGUL_N_COUNT);
+            codes.push_back(HANGUL_V_BASE + (index % HANGUL_N_COUNT) / HANGUL_T_COUNT);
+            if (index % HANGUL_T_COUNT)
+                codes.push_back(HANGUL_T_BASE + index % HANGUL_T_COUNT);
+
+            return;
+        }
+
+        const UnicodeRecord &record = Record(code);
+        if (record.decompositionLength == 0)
+        {
+            codes.push_back(code);
+            return;
+        }
+
+        const u32 *parts = unicodeDecompositions + record.decomposition;
+        codes.insert(codes.end(), parts, parts + record.decompositionLength);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Sorts each run of combining marks by combining class, keeping the
+    // order of marks of the same class.
+    // ------------------------------------------------------------------------
+    void Reorder(std::vector<u32> &codes)
+    {
+        for (size_t i=1; i<codes.size(); i++)
+        {
+            u32 code = codes[i];
+            u8  ccc  = Record(code).ccc;
+            if (ccc == 0)
+                continue;
+
+            size_t j = i;
+            while (j > 0 && Record(codes[j - 1]).ccc > ccc)
+            {
+                codes[j] = codes[j - 1];
+                j--;
+            }
+
+            codes[j] = code;
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the primary composite of a pair, or 0 if they don't compose.
+    // ------------------------------------------------------------------------
+    u32 Compose(u32 first, u32 second)
+    {
+        // L + V and LV + T
+        if (first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT &&
+            second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT)
+        {
+            return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+        }
+
+        if (first >= HANGUL_S_BASE && first < HANGUL_S_BASE + HANGUL_S_COUNT &&
+            (first - HANGUL_S_BASE) % HANGUL_T_COUNT == 0 &&
+            second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT)
+        {
+            return first + second - HANGUL_T_BASE;
+        }
+
+        u32 lower = 0;
+        u32 upper = UNICODE_COMPOSITIONS;
+
+        while (lower < upper)
+        {
+            u32                       mid  = lower + ((upper - lower) / 2);
+            const UnicodeComposition &pair = unicodeCompositions[mid];
+
+            if (pair.first < first || (pair.first == first && pair.second < second))
+            {
+                lower = mid + 1;
+            }
+            else
+            {
+                upper = mid;
+            }
+        }
+
+        if (lower < UNICODE_COMPOSITIONS &&
+            unicodeCompositions[lower].first  == first &&
+            unicodeCompositions[lower].second == second)
+        {
+            return unicodeCompositions[lower].composite;
+        }
+
+        return 0;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Composes decomposed, ordered code points in place. A mark composes
+    // with the last starter unless a mark of the same or higher class, or
+    // another starter, comes between them.
+    // ------------------------------------------------------------------------
+    void ComposeAll(std::vector<u32> &codes)
+    {
+        size_t count   = 0;
+        size_t starter = 0;
+        bool   found   = false;
+        u8     lastCcc = 0;
+
+        for (size_t i=0; i<codes.size(); i++)
+        {
+            u32 code = codes[i];
+            u8  ccc  = Record(code).ccc;
+
+            if (found)
+            {
+                bool blocked = count > starter + 1 && (lastCcc == 0 || lastCcc >= ccc);
+                u32  pair    = blocked ? 0 : Compose(codes[starter], code);
+
+                if (pair)
+                {
+                    codes[starter] = pair;
+                    continue;
+                }
+            }
+
+            if (ccc == 0)
+            {
+                starter = count;
+                found   = true;
+            }
+
+            lastCcc         = ccc;
+            codes[count++]  = code;
+        }
+
+        codes.resize(count);
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Tests whether 8 bytes are all ASCII, none is NUL, and none has the
+    // wrong case for the form. A lane's high bit is set by a byte of 0x80 or
+    // over, by a zero byte, or by a letter in the range being tested.
+    // ------------------------------------------------------------------------
+    inline bool WordIsNormal(u64 word, u32 form)
+    {
+        u64 bad = word | ((word - WORD_ONES) & ~word);
+
+        if (form & NAME_FORM_LOWER)
+            bad |= (word + WORD_ONES * (0x80 - 'A')) & ~(word + WORD_ONES * (0x80 - 'Z' - 1));
+
+        if (form & NAME_FORM_UPPER)
+            bad |= (word + WORD_ONES * (0x80 - 'a')) & ~(word + WORD_ONES * (0x80 - 'z' - 1));
+
+        return (bad & WORD_HIGHS) == 0;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Gets the flag saying a code point is left alone by a form.
+    // ------------------------------------------------------------------------
+    u8 FormFlag(u32 form)
+    {
+        if (form & NAME_FORM_LOWER)
+            return UNICODE_FLAG_LOWER;
+
+        if (form & NAME_FORM_UPPER)
+            return UNICODE_FLAG_UPPER;
+
+        return UNICODE_FLAG_KEEP;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Tests whether a name is already in a name form.
+//
+// Each flagged code point is a starter that nothing composes onto, and that
+// the form maps to itself, so a name made only of them is unchanged.
+// ----------------------------------------------------------------------------
+bool ArcNameIsNormal(const char *name, u32 form)
+{
+    const u8 *p    = (const u8*)name;
+    const u8 *end  = p + strlen(name);
+    u8        flag = FormFlag(form);
+
+    for (;;)
+    {
+        // Runs of ASCII go a word at a time, while a whole word is left
+        // before the NUL, so nothing past the string is read.
+        if (end - p >= 8)
+        {
+            u64 word;
+            memcpy(&word, p, sizeof(word));
+
+            if (WordIsNormal(word, form))
+            {
+                p += 8;
+                continue;
+            }
+        }
+
+        // ASCII only needs its case checked. NUL has no flags.
+        if (*p < 0x80)
+        {
+            if ((unicodeAscii[*p] & flag) == 0)
+                return *p == 0;
+
+            p++;
+            continue;
+        }
+
+        if ((Record(DecodeUtf8(p)).flags & flag) == 0)
+            return false;
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Puts a name in a name form.
+//
+// The canonical form is NFC of the case mapped decomposition. Mapping the
+// decomposed characters, rather than the name as given, makes canonically
+// equivalent names map the same way.
+// ----------------------------------------------------------------------------
+size_t ArcNormaliseName(const char *name, u32 form, char *out, size_t outSize)
+{
+    size_t length = strlen(name);
+
+    if (ArcNameIsNormal(name, form))
+    {
+        if (length < outSize)
+            memcpy(out, name, length + 1);
+
+        return length;
+    }
+
+    std::vector<u32> codes;
+    codes.reserve(length * 2);
+
+    const u8 *p = (const u8*)name;
+    while (*p)
+    {
+        Decompose(DecodeUtf8(p), codes);
+    }
+
+    Reorder(codes);
+
+    if (form & (NAME_FORM_LOWER | NAME_FORM_UPPER))
+    {
+        std::vector<u32> mapped;
+        mapped.reserve(codes.size());
+
+        for (size_t i=0; i<codes.size(); i++)
+        {
+            const UnicodeRecord &record = Record(codes[i]);
+
+            Decompose(codes[i] + ((form & NAME_FORM_LOWER) ? record.lower : record.upper), mapped);
+        }
+
+        Reorder(mapped);
+        codes.swap(mapped);
+    }
+
+    ComposeAll(codes);
+
+    // Measure, then write if it fits.
+    u8     bytes[4];
+    size_t size = 0;
+
+    for (size_t i=0; i<codes.size(); i++)
+    {
+        u32 count = EncodeUtf8(codes[i], bytes);
+
+        if (size + count < outSize)
+            memcpy(out + size, bytes, count);
+
+        size += count;
+    }
+
+    if (size < outSize)
+        out[size] = 0;
+
+    return size;
+}
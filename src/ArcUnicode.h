@@ -0,0 +1,34 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include <stddef.h>
+#include "ArcEntry.h"
+
+
+// Tests whether a UTF-8 name is already in a name form (NAME_FORM_xxx).
+// Quick for ASCII names, and for names of precomposed characters.
+bool   ArcNameIsNormal(const char *name, u32 form);
+
+// Puts a UTF-8 name in a name form: the characters are decomposed, case
+// folded or upper cased if the form asks for it, and recomposed as NFC. Returns the length
+// of the result, which is written with a NUL if it fits in outSize chars.
+// Invalid UTF-8 bytes are kept as they are.
+size_t ArcNormaliseName(const char *name, u32 form, char *out, size_t outSize);
@@ -0,0 +1,4613 @@
+// Generated by tools/MakeUnicodeTables.py from Unicode 14.0.0. Do not edit.
+
+
+#pragma once
+
+
+#define UNICODE_SHIFT           6
+#define UNICODE_LIMIT           0x2fa40
+#define UNICODE_FLAG_KEEP       0x01
+#define UNICODE_FLAG_LOWER      0x02
+#define UNICODE_FLAG_UPPER      0x04
+#define UNICODE_COMPOSITIONS    941
+
+
+static const u8 unicodeAscii[128] =
+{
+      0,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,   7,
+      7,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,
+      5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   5,   7,   7,   7,   7,   7,
+      7,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,
+      3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   3,   7,   7,   7,   7,   7,
+};
+
+
+static const u16 unicodeStage1[3049] =
+{
+       0,    1,    2,    3,    4,    5,    6,    7,    8,    9,   10,    0,   11,   12,   13,   14,
+      15,   16,   17,   18,   19,   20,   21,   22,   23,   24,    0,   25,   26,   27,    0,   28,
+      29,   30,   31,   32,   33,   34,   35,   36,   37,   38,   39,   40,   35,   41,   42,   43,
+      39,   44,   39,   45,   46,   47,    0,   48,   49,   50,   51,   52,   53,   54,   55,   56,
+      57,    0,   58,   59,    0,   60,   61,   62,    0,    0,    0,    0,    0,   63,    0,   64,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,   65,    0,    0,   66,
+       0,    0,   67,    0,   68,    0,    0,    0,   69,   70,   71,   72,   73,   74,   75,   76,
+      77,    0,   78,   79,    0,   80,   81,   82,   83,   84,   85,   86,   87,   88,   89,   90,
+      91,    0,    0,   92,   93,   94,   95,   96,   97,   98,   99,  100,  101,    0,    0,    0,
+       0,    0,  102,  103,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  104,    0,    0,    0,    0,
+     105,  106,  107,  108,  109,  110,    0,  111,    0,    0,    0,    0,    0,    0,    0,    0,
+     112,  113,  114,  115,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  116,  117,  118,  119,  120,  121,  122,
+     123,    0,    0,  124,  125,  126,  127,  128,    0,    0,  129,  130,    0,  131,  132,  133,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  134,  135,  136,  137,  138,  139,  140,  141,  142,  143,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  144,    0,    0,    0,  145,  146,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  147,    0,    0,    0,  148,    0,  149,    0,    0,
+     150,  151,  152,  153,    0,  154,  155,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  156,    0,    0,  157,    0,    0,    0,    0,
+       0,    0,  158,  159,  160,    0,    0,    0,    0,    0,  161,    0,    0,  162,  163,    0,
+       0,  164,  165,    0,  166,  127,    0,  167,  168,    0,    0,  169,  170,  171,    0,    0,
+       0,  172,  173,  174,    0,    0,  175,  176,  110,    0,  177,    0,  178,    0,    0,    0,
+     179,    0,  180,  181,  182,  183,    0,  184,  185,  186,  187,    0,    0,    0,    0,    0,
+     110,    0,    0,    0,    0,  188,  189,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  190,  191,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  192,    0,    0,    0,    0,    0,  193,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  194,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,  195,  196,  197,    0,  198,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     199,    0,    0,    0,  191,    0,    0,    0,    0,    0,  200,  201,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  202,  203,  204,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     205,  206,  207,  208,  209,  210,  211,  212,  213,
+};
+
+
+static const u16 unicodeStage2[13696] =
+{
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    0,    0,    0,    0,    0,
+       0,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    3,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       4,    5,    6,    7,    8,    9,    1,   10,   11,   12,   13,   14,   15,   16,   17,   18,
+       1,   19,   20,   21,   22,   23,   24,    0,    1,   25,   26,   27,   28,   29,    1,    0,
+      30,   31,   32,   33,   34,   35,    2,   36,   37,   38,   39,   40,   41,   42,   43,   44,
+       2,   45,   46,   47,   48,   49,   50,    0,    2,   51,   52,   53,   54,   55,    2,   56,
+      57,   58,   59,   60,   61,   62,   63,   64,   65,   66,   67,   68,   69,   70,   71,   72,
+      73,   74,   75,   76,   77,   78,   79,   80,   81,   82,   83,   84,   85,   86,   87,   88,
+      89,   90,   91,   92,   93,   94,   73,   74,   95,   96,   97,   98,   99,  100,  101,  102,
+     103,  104,   73,   74,  105,  106,  107,  108,    0,  109,  110,  111,  112,  113,  114,   73,
+      74,   73,   74,  115,  116,  117,  118,  119,  120,    0,   73,   74,  121,  122,  123,  124,
+     125,  126,   73,   74,  127,  128,  129,  130,  131,  132,  133,  134,  135,  136,  137,  138,
+     139,  140,  141,  142,  143,  144,   73,   74,  145,  146,  147,  148,  149,  150,  151,  152,
+     153,  154,  155,  156,  157,  158,  159,  160,  161,  162,  163,  164,  165,  166,  167,  168,
+     169,  170,   73,   74,   73,   74,  171,   73,   74,  172,  172,   73,   74,    0,  173,  174,
+     175,   73,   74,  172,  176,  177,  178,  179,   73,   74,  180,    0,  178,  181,  182,  183,
+     184,  185,   73,   74,   73,   74,  186,   73,   74,  186,    0,    0,   73,   74,  186,  187,
+     188,  189,  189,   73,   74,   73,   74,  190,   73,   74,    0,    0,   73,   74,    0,  191,
+       0,    0,    0,    0,  192,  193,  194,  192,  193,  194,  192,  193,  194,  195,  196,  197,
+     198,  199,  200,  201,  202,  203,  204,  205,  206,  207,  208,  209,  210,  211,  212,  213,
+     214,  215,  216,  217,   73,   74,  218,  219,  220,  221,  222,  223,  224,  225,  226,  227,
+     228,  192,  193,  194,  229,  230,  231,  232,  233,  234,  235,  236,  237,  238,  239,  240,
+     241,  242,  243,  244,  245,  246,  247,  248,  249,  250,  251,  252,  253,  254,  255,  256,
+     257,  258,  259,  260,  261,  262,  263,  264,  265,  266,  267,  268,   73,   74,  269,  270,
+     271,    0,   73,   74,   73,   74,  272,  273,  274,  275,  276,  277,  278,  279,  280,  281,
+     282,  283,  284,  285,    0,    0,    0,    0,    0,    0,  286,   73,   74,  287,  288,  289,
+     289,   73,   74,  290,  291,  292,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+     293,  294,  295,  296,  297,    0,  298,  298,    0,  299,    0,  300,  301,    0,    0,    0,
+     298,  302,    0,  303,    0,  304,  305,    0,  306,  307,  305,  308,  309,    0,    0,  307,
+       0,  310,  311,    0,    0,  312,    0,    0,    0,    0,    0,    0,    0,  313,    0,    0,
+     314,    0,  315,  314,    0,    0,    0,  316,  314,  317,  318,  318,  319,    0,    0,    0,
+       0,    0,  320,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  321,  322,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,  323,  324,  325,  325,  325,  325,  324,  326,  325,  325,  325,  325,
+     325,  327,  327,  325,  325,  325,  325,  327,  327,  325,  325,  325,  325,  325,  325,  325,
+     325,  325,  325,  325,  328,  328,  328,  328,  328,  325,  325,  325,  325,  323,  323,  323,
+     329,  330,  323,  331,  332,  333,  323,  325,  325,  325,  323,  323,  323,  325,  325,    0,
+     323,  323,  323,  325,  325,  325,  325,  323,  324,  325,  325,  323,  334,  335,  335,  334,
+     335,  335,  334,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+      73,   74,   73,   74,  336,    0,   73,   74,    0,    0,    0,  182,  182,  182,  337,  338,
+       0,    0,    0,    0,    0,  339,  340,  341,  342,  343,  344,    0,  345,    0,  346,  347,
+     348,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    0,    1,    1,    1,    1,    1,    1,    1,  349,  350,  351,  352,  353,  354,
+     355,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,  356,    2,    2,    2,    2,    2,    2,    2,  357,  358,  359,  360,  361,  362,
+     363,  364,    0,  365,  366,  367,  368,  369,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+     370,  371,  372,  373,  374,  375,    0,   73,   74,  376,   73,   74,    0,  271,  271,  271,
+     377,  378,  379,  380,  379,  379,  379,  381,  379,  379,  379,  379,  382,  383,  384,  379,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,  385,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,  386,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+     387,  388,  389,  390,  389,  389,  389,  391,  389,  389,  389,  389,  392,  393,  394,  389,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,  395,  396,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,    0,  323,  323,  323,  323,  323,    0,    0,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+     397,  398,  399,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,  400,
+     401,  402,  403,  404,   73,   74,  405,  406,   73,   74,  407,  408,  409,  410,  411,  412,
+      73,   74,  413,  414,  415,  416,  417,  418,   73,   74,  419,  420,  421,  422,  423,  424,
+     425,  426,  427,  428,  429,  430,   73,   74,  431,  432,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+       0,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,
+     433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,
+     433,  433,  433,  433,  433,  433,  433,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+     434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+     434,  434,  434,  434,  434,  434,  434,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,  325,  323,  323,  323,  323,  325,  323,  323,  323,  435,  325,  323,  323,  323,  323,
+     323,  323,  325,  325,  325,  325,  325,  325,  323,  323,  325,  323,  323,  435,  436,  323,
+     437,  438,  439,  440,  441,  442,  443,  444,  445,  446,  446,  447,  448,  449,    0,  450,
+       0,  451,  452,    0,  323,  325,    0,  445,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,  323,  453,  454,  455,    0,    0,    0,    0,    0,
+       0,    0,  456,  457,  458,  459,  460,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  461,  462,  463,  453,  454,
+     455,  464,  465,  323,  323,  325,  325,  323,  323,  323,  323,  323,  325,  323,  323,  325,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     466,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     467,    0,  468,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  469,    0,    0,  323,  323,  323,  323,  323,  323,  323,    0,    0,  323,
+     323,  323,  323,  325,  323,    0,    0,  323,  323,    0,  325,  323,  323,  325,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,  470,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  325,  323,  323,  325,  323,  323,  325,  325,  325,  323,  325,  325,  323,  325,  323,
+     323,  323,  325,  323,  325,  323,  325,  323,  325,  323,  323,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,  323,  323,  323,
+     323,  323,  325,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,  325,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  323,  323,  323,  323,    0,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,    0,  323,  323,  323,    0,  323,  323,  323,  323,  323,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  325,  325,  325,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  323,  325,  325,  325,  323,  323,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,  323,  323,  323,  325,
+     325,  325,  325,  325,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,    0,  325,  323,  323,  325,  323,  323,  325,  323,  323,  323,  325,  325,  325,
+     461,  462,  463,  323,  323,  323,  325,  323,  323,  325,  325,  323,  323,  323,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  471,    0,    0,    0,    0,    0,    0,
+       0,  472,    0,    0,  473,    0,    0,    0,    0,    0,    0,    0,  474,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,
+       0,  323,  325,  323,  323,    0,    0,    0,  476,  477,  478,  479,  480,  481,  482,  483,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  474,    0,  484,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  485,  486,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  484,    0,    0,    0,    0,  487,  488,    0,  489,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  490,    0,    0,  491,    0,    0,    0,    0,    0,  474,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  492,  493,  494,    0,    0,  495,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  474,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  496,    0,    0,  497,  498,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,  484,  484,    0,    0,    0,    0,  499,  500,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  501,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  484,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  502,  503,  504,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  484,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  505,    0,    0,    0,    0,  475,    0,    0,
+       0,    0,    0,    0,    0,  506,  507,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     508,    0,  484,    0,    0,    0,    0,  509,  510,    0,  511,  512,    0,  475,    0,    0,
+       0,    0,    0,    0,    0,  484,  484,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,  475,    0,  484,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  513,  514,  515,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  484,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,  484,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  516,    0,  517,  518,  519,  484,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  520,  520,  475,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  521,  521,  521,  521,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  522,  522,  475,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  523,  523,  523,  523,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  325,  325,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,  325,    0,  325,    0,  326,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  524,    0,    0,    0,    0,    0,    0,    0,    0,    0,  525,    0,    0,
+       0,    0,  526,    0,    0,    0,    0,  527,    0,    0,    0,    0,  528,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  529,    0,    0,    0,    0,    0,    0,
+       0,  530,  531,  532,  533,  534,  535,    0,  536,    0,  531,  531,  531,  531,    0,    0,
+     531,  537,  323,  323,  475,    0,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  538,    0,    0,    0,    0,    0,    0,    0,    0,    0,  539,    0,    0,
+       0,    0,  540,    0,    0,    0,    0,  541,    0,    0,    0,    0,  542,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  543,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  325,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  544,    0,    0,    0,    0,    0,    0,    0,  484,    0,
+       0,    0,    0,    0,    0,    0,    0,  474,    0,  475,  475,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  325,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+     545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,  545,
+     545,  545,  545,  545,  545,  545,    0,  545,    0,    0,    0,    0,    0,  545,    0,    0,
+     546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,
+     546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,
+     546,  546,  546,  546,  546,  546,  546,  546,  546,  546,  546,    0,    0,  546,  546,  546,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,
+     484,  484,  484,  484,  484,  484,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  484,  484,  484,  484,  484,  484,  484,  484,
+     484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,  484,
+     484,  484,  484,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  547,  547,  547,  547,  547,  547,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  475,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  436,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  435,  323,  325,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  323,  325,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,  323,  323,  323,  323,  323,  323,  323,  323,    0,    0,  325,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  325,  325,  325,  325,  325,  325,  323,  323,  325,    0,  325,
+     325,  323,  323,  325,  325,  323,  323,  323,  323,  323,  325,  323,  323,  323,  323,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  548,    0,  549,    0,  550,    0,  551,    0,  552,    0,
+       0,    0,  553,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  474,  484,    0,    0,    0,    0,    0,  554,    0,  555,    0,    0,
+     556,  557,    0,  558,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  325,  323,  323,  323,
+     323,  323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,  475,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  475,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  474,    0,    0,    0,    0,    0,    0,    0,    0,
+     559,  560,  561,  562,  562,  563,  564,  565,  566,    0,    0,    0,    0,    0,    0,    0,
+     567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+     567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,
+     567,  567,  567,  567,  567,  567,  567,  567,  567,  567,  567,    0,    0,  567,  567,  567,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,    0,  328,  325,  325,  325,  325,  325,  323,  323,  325,  325,  325,  325,
+     323,    0,  328,  328,  328,  328,  328,  328,  328,    0,    0,    0,    0,  325,    0,    0,
+       0,    0,    0,    0,  323,    0,    0,    0,  323,  323,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  568,    0,    0,    0,  569,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  570,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  325,  323,  323,  323,  323,  323,  323,  323,  325,  323,  323,  335,  571,  325,
+     327,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,  323,  323,  324,  436,  436,  325,  572,  323,  334,  325,  323,  325,
+     573,  574,  575,  576,  577,  578,  579,  580,  581,  582,  583,  584,  585,  586,  587,  588,
+     589,  590,  591,  592,  593,  594,  595,  596,  597,  598,  599,  600,  601,  602,  603,  604,
+     605,  606,  607,  608,  609,  610,  611,  612,  613,  614,  615,  616,  617,  618,  619,  620,
+     621,  622,  623,  624,  625,  626,  627,  628,  629,  630,  631,  632,  633,  634,  635,  636,
+     637,  638,  639,  640,  641,  642,  643,  644,  645,  646,  647,  648,  649,  650,  651,  652,
+     653,  654,  655,  656,  657,  658,  659,  660,  661,  662,  663,  664,  665,  666,  667,  668,
+     669,  670,  671,  672,  673,  674,  675,  676,  677,  678,  679,  680,  681,  682,  683,  684,
+     685,  686,  687,  688,  689,  690,  691,  692,  693,  694,  695,  696,  697,  698,  699,  700,
+     701,  702,  703,  704,  705,  706,  707,  708,  709,  710,  711,  712,  713,  714,  715,  716,
+     717,  718,  719,  720,  721,  722,  723,  724,  725,  726,    0,  727,    0,    0,  728,    0,
+     729,  730,  731,  732,  733,  734,  735,  736,  737,  738,  739,  740,  741,  742,  743,  744,
+     745,  746,  747,  748,  749,  750,  751,  752,  753,  754,  755,  756,  757,  758,  759,  760,
+     761,  762,  763,  764,  765,  766,  767,  768,  769,  770,  771,  772,  773,  774,  775,  776,
+     777,  778,  779,  780,  781,  782,  783,  784,  785,  786,  787,  788,  789,  790,  791,  792,
+     793,  794,  795,  796,  797,  798,  799,  800,  801,  802,  803,  804,  805,  806,  807,  808,
+     809,  810,  811,  812,  813,  814,  815,  816,  817,  818,   73,   74,   73,   74,   73,   74,
+     819,  820,  821,  822,  823,  824,  825,  826,  827,  828,  829,  830,  831,  832,  833,  834,
+     835,  836,  837,  838,  839,  840,    0,    0,  841,  842,  843,  844,  845,  846,    0,    0,
+     847,  848,  849,  850,  851,  852,  853,  854,  855,  856,  857,  858,  859,  860,  861,  862,
+     863,  864,  865,  866,  867,  868,  869,  870,  871,  872,  873,  874,  875,  876,  877,  878,
+     879,  880,  881,  882,  883,  884,    0,    0,  885,  886,  887,  888,  889,  890,    0,    0,
+     891,  892,  893,  894,  895,  896,  897,  898,    0,  899,    0,  900,    0,  901,    0,  902,
+     903,  904,  905,  906,  907,  908,  909,  910,  911,  912,  913,  914,  915,  916,  917,  918,
+     919,  920,  921,  922,  923,  924,  925,  926,  927,  928,  929,  930,  931,  932,    0,    0,
+     933,  934,  935,  936,  937,  938,  939,  940,  941,  942,  943,  944,  945,  946,  947,  948,
+     949,  950,  951,  952,  953,  954,  955,  956,  957,  958,  959,  960,  961,  962,  963,  964,
+     965,  966,  967,  968,  969,  970,  971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
+     981,  982,  983,  984,  985,    0,  986,  987,  988,  989,  990,  991,  992,    0,  993,    0,
+       0,  994,  995,  996,  997,    0,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007,
+    1008, 1009, 1010, 1011,    0,    0, 1012, 1013, 1014, 1015, 1016, 1017,    0, 1018, 1019, 1020,
+    1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036,
+       0,    0, 1037, 1038, 1039,    0, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,    0,    0,
+    1048, 1049,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  328,  328,  323,  323,  323,  323,  328,  328,  328,  323,  323,    0,    0,    0,
+       0,  323,    0,    0,    0,  328,  328,  323,  325,  323,  328,  328,  325,  325,  325,  325,
+     323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0, 1050,    0,    0,    0, 1051, 1052,    0,    0,    0,    0,
+       0,    0, 1053,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1054,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055, 1055,
+    1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056, 1056,
+       0,    0,    0,   73,   74,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1057, 1058,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1059,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1060, 1061, 1062,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0, 1063,    0,    0,    0,    0, 1064,    0,    0, 1065,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0, 1066,    0, 1067,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0, 1068,    0,    0, 1069,    0,    0, 1070,    0, 1071,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1072,    0, 1073,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1074, 1075, 1076,
+    1077, 1078,    0,    0, 1079, 1080,    0,    0, 1081, 1082,    0,    0,    0,    0,    0,    0,
+    1083, 1084,    0,    0, 1085, 1086,    0,    0, 1087, 1088,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1089, 1090, 1091, 1092,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1093, 1094, 1095, 1096,    0,    0,    0,    0,    0,    0, 1097, 1098, 1099, 1100,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0, 1101, 1102,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103,
+    1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103, 1103,
+    1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,
+    1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104, 1104,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1105,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,
+     433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,
+     433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,  433,
+     434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+     434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+     434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,  434,
+      73,   74, 1106, 1107, 1108, 1109, 1110,   73,   74,   73,   74,   73,   74, 1111, 1112, 1113,
+    1114,    0,   73,   74,    0,   73,   74,    0,    0,    0,    0,    0,    0,    0, 1115, 1115,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,    0,    0,    0,    0,    0,    0,    0,   73,   74,   73,   74,  323,
+     323,  323,   73,   74,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+    1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116, 1116,
+    1116, 1116, 1116, 1116, 1116, 1116,    0, 1116,    0,    0,    0,    0,    0, 1116,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  572,  436,  324,  435, 1117, 1117,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1118,    0, 1119,    0,
+    1120,    0, 1121,    0, 1122,    0, 1123,    0, 1124,    0, 1125,    0, 1126,    0, 1127,    0,
+    1128,    0, 1129,    0,    0, 1130,    0, 1131,    0, 1132,    0,    0,    0,    0,    0,    0,
+    1133, 1134,    0, 1135, 1136,    0, 1137, 1138,    0, 1139, 1140,    0, 1141, 1142,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0, 1143,    0,    0,    0,    0, 1144, 1144,    0,    0,    0, 1145,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1146,    0, 1147,    0,
+    1148,    0, 1149,    0, 1150,    0, 1151,    0, 1152,    0, 1153,    0, 1154,    0, 1155,    0,
+    1156,    0, 1157,    0,    0, 1158,    0, 1159,    0, 1160,    0,    0,    0,    0,    0,    0,
+    1161, 1162,    0, 1163, 1164,    0, 1165, 1166,    0, 1167, 1168,    0, 1169, 1170,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0, 1171,    0,    0, 1172, 1173, 1174, 1175,    0,    0,    0, 1176,    0,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,    0,  323,
+       0,    0,    0,    0,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,    0,    0,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,    0,    0,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+       0,    0,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,   73,   74,   73,   74, 1177,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,    0,    0,    0,   73,   74, 1178,    0,    0,
+      73,   74,   73,   74, 1179,    0,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74,   73,   74,   73,   74,   73,   74, 1180, 1181, 1182, 1183, 1180,    0,
+    1184, 1185, 1186, 1187,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,   73,   74,
+      73,   74,   73,   74, 1188, 1189, 1190,   73,   74,   73,   74,    0,    0,    0,    0,    0,
+      73,   74,    0,    0,    0,    0,   73,   74,   73,   74,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,   73,   74,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  325,  325,  325,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,    0,  323,  323,  325,    0,    0,  323,  323,    0,    0,    0,    0,    0,  323,  323,
+       0,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0, 1191,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+    1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192, 1192,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+    1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
+    1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+    1240, 1241, 1242, 1243, 1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255,
+    1256, 1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271,
+    1272, 1273, 1274, 1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1212, 1284, 1285, 1286,
+    1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
+    1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318,
+    1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334,
+    1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346, 1347, 1348, 1349, 1350,
+    1351, 1302, 1352, 1353, 1354, 1355, 1356, 1357, 1358, 1359, 1286, 1360, 1361, 1362, 1363, 1364,
+    1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1212,
+    1380, 1381, 1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394, 1395,
+    1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404, 1405, 1406, 1288, 1407, 1408, 1409, 1410,
+    1411, 1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424, 1425, 1426,
+    1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442,
+    1443, 1444, 1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454, 1455, 1456,    0,    0,
+    1457,    0, 1458,    0,    0, 1459, 1460, 1461, 1462, 1463, 1464, 1465, 1466, 1467, 1468,    0,
+    1469,    0, 1470,    0,    0, 1471, 1472,    0,    0,    0, 1473, 1474, 1475, 1476, 1477, 1478,
+    1479, 1480, 1481, 1482, 1483, 1484, 1485, 1486, 1487, 1488, 1489, 1490, 1491, 1492, 1493, 1494,
+    1495, 1496, 1497, 1498, 1499, 1500, 1501, 1502, 1503, 1504, 1505, 1506, 1507, 1508, 1509, 1510,
+    1511, 1512, 1513, 1514, 1515, 1516, 1517, 1341, 1518, 1519, 1520, 1521, 1522, 1523, 1523, 1524,
+    1525, 1526, 1527, 1528, 1529, 1530, 1531, 1471, 1532, 1533, 1534, 1535, 1536, 1537,    0,    0,
+    1538, 1539, 1540, 1541, 1542, 1543, 1544, 1545, 1485, 1546, 1547, 1548, 1457, 1549, 1550, 1551,
+    1552, 1553, 1554, 1555, 1556, 1557, 1558, 1559, 1560, 1494, 1561, 1495, 1562, 1563, 1564, 1565,
+    1566, 1458, 1233, 1567, 1568, 1569, 1303, 1390, 1570, 1571, 1502, 1572, 1503, 1573, 1574, 1575,
+    1460, 1576, 1577, 1578, 1579, 1580, 1461, 1581, 1582, 1583, 1584, 1585, 1586, 1517, 1587, 1588,
+    1341, 1589, 1521, 1590, 1591, 1592, 1593, 1594, 1526, 1595, 1470, 1596, 1527, 1284, 1597, 1528,
+    1598, 1530, 1599, 1600, 1601, 1602, 1603, 1532, 1466, 1604, 1533, 1605, 1534, 1606, 1200, 1607,
+    1608, 1609, 1610, 1611, 1612, 1613, 1614, 1615, 1616, 1617,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1618, 1619, 1620,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1621, 1622, 1623, 1624, 1625, 1626,
+    1627, 1628, 1629, 1630, 1631, 1632, 1633,    0, 1634, 1635, 1636, 1637, 1638,    0, 1639,    0,
+    1640, 1641,    0, 1642, 1643,    0, 1644, 1645, 1646, 1647, 1648, 1649, 1650, 1651, 1652,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,  325,  325,  325,  325,  325,  325,  325,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    0,    0,    0,    0,    0,
+       0,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  325,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     325,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  323,  323,  323,  323,  323,    0,    0,    0,    0,    0,
+    1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653,
+    1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653,
+    1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+    1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+    1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653,
+    1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653, 1653,
+    1653, 1653, 1653, 1653,    0,    0,    0,    0, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+    1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,
+    1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654, 1654,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655,    0, 1655, 1655, 1655, 1655,
+    1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655, 1655,    0, 1655, 1655, 1655, 1655,
+    1655, 1655, 1655,    0, 1655, 1655,    0, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656,
+    1656, 1656,    0, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656, 1656,
+    1656, 1656,    0, 1656, 1656, 1656, 1656, 1656, 1656, 1656,    0, 1656, 1656,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  325,    0,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,  323,  328,  325,    0,    0,    0,    0,  475,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,  323,  325,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657,
+    1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657,
+    1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657, 1657,
+    1657, 1657, 1657,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658,
+    1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658,
+    1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658, 1658,
+    1658, 1658, 1658,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  323,  323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  325,  325,  323,  323,  323,  325,  323,  325,  325,  325,
+     325,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  323,  325,  323,  325,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1659,    0, 1660,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1661,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  475,  474,    0,    0,    0,    0,    0,
+     323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  484,    0,    0,    0,    0,    0,    0, 1662, 1663,
+       0,    0,    0,  475,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     475,    0,    0,    0,    0,    0,    0,    0,    0,    0,  474,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,  475,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  474,  475,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  474,  474,    0,  484,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1664, 1665,  475,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  484,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  323,  323,  323,  323,  323,  323,  323,    0,    0,    0,
+     323,  323,  323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  475,    0,    0,    0,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     484,    0,    0,    0,    0,    0,    0,    0,    0,    0,  484, 1666, 1667,  484, 1668,    0,
+       0,    0,  475,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  484,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1669, 1670,    0,    0,    0,  475,
+     474,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,  475,  474,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  475,  474,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     484,    0,    0,    0,    0,    0,    0,    0, 1671,    0,    0,    0,    0,  475,  475,    0,
+       0,    0,    0,  474,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  474,    0,  475,  475,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,  475,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     328,  328,  328,  328,  328,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1672, 1672,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  328,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1673, 1674,
+    1675, 1676, 1677, 1678, 1679,  326,  326,  328,  328,  328,    0,    0,    0, 1680,  326,  326,
+     326,  326,  326,    0,    0,    0,    0,    0,    0,    0,    0,  325,  325,  325,  325,  325,
+     325,  325,  325,    0,    0,  323,  323,  323,  323,  323,  325,  325,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,  323,  323,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0, 1681, 1682, 1683, 1684, 1685,
+    1686,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,  323,  323,  323,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     323,  323,  323,  323,  323,  323,  323,    0,  323,  323,  323,  323,  323,  323,  323,  323,
+     323,  323,  323,  323,  323,  323,  323,  323,  323,    0,    0,  323,  323,  323,  323,  323,
+     323,  323,    0,  323,  323,    0,  323,  323,  323,  323,  323,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,  323,  323,  323,  323,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+     325,  325,  325,  325,  325,  325,  325,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687,
+    1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687, 1687,
+    1687, 1687, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688,
+    1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688, 1688,
+    1688, 1688, 1688, 1688,  323,  323,  323,  323,  323,  323,  474,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+    1689, 1690, 1691, 1692, 1693, 1479, 1694, 1695, 1696, 1697, 1480, 1698, 1699, 1700, 1481, 1701,
+    1702, 1703, 1704, 1705, 1706, 1707, 1708, 1709, 1710, 1711, 1712, 1539, 1713, 1714, 1715, 1716,
+    1717, 1718, 1719, 1720, 1721, 1544, 1482, 1483, 1545, 1722, 1723, 1290, 1724, 1484, 1725, 1726,
+    1727, 1728, 1728, 1728, 1729, 1730, 1731, 1732, 1733, 1734, 1735, 1736, 1737, 1738, 1739, 1740,
+    1741, 1742, 1743, 1744, 1745, 1746, 1746, 1547, 1747, 1748, 1749, 1750, 1486, 1751, 1752, 1753,
+    1443, 1754, 1755, 1756, 1757, 1758, 1759, 1760, 1761, 1762, 1763, 1764, 1765, 1766, 1767, 1768,
+    1769, 1770, 1771, 1772, 1773, 1774, 1775, 1776, 1777, 1778, 1779, 1779, 1780, 1781, 1782, 1286,
+    1783, 1784, 1785, 1786, 1787, 1788, 1789, 1790, 1491, 1791, 1792, 1793, 1794, 1795, 1796, 1797,
+    1798, 1799, 1800, 1801, 1802, 1803, 1804, 1805, 1806, 1807, 1808, 1809, 1810, 1811, 1232, 1812,
+    1813, 1814, 1814, 1815, 1816, 1816, 1817, 1818, 1819, 1820, 1821, 1822, 1823, 1824, 1825, 1826,
+    1827, 1828, 1829, 1492, 1830, 1831, 1832, 1833, 1559, 1833, 1834, 1494, 1835, 1836, 1837, 1838,
+    1495, 1205, 1839, 1840, 1841, 1842, 1843, 1844, 1845, 1846, 1847, 1848, 1849, 1850, 1851, 1852,
+    1853, 1854, 1855, 1856, 1857, 1858, 1859, 1860, 1496, 1861, 1862, 1863, 1864, 1865, 1866, 1498,
+    1867, 1868, 1869, 1870, 1871, 1872, 1873, 1874, 1233, 1567, 1875, 1876, 1877, 1878, 1879, 1880,
+    1881, 1882, 1499, 1883, 1884, 1885, 1886, 1610, 1887, 1888, 1889, 1890, 1891, 1892, 1893, 1894,
+    1895, 1896, 1897, 1898, 1899, 1303, 1900, 1901, 1902, 1903, 1904, 1905, 1906, 1907, 1908, 1909,
+    1910, 1500, 1390, 1911, 1912, 1913, 1914, 1915, 1916, 1917, 1918, 1571, 1919, 1920, 1921, 1922,
+    1923, 1924, 1925, 1926, 1572, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934, 1935, 1936, 1937,
+    1938, 1574, 1939, 1940, 1941, 1942, 1943, 1944, 1945, 1946, 1947, 1948, 1949, 1949, 1950, 1951,
+    1576, 1952, 1953, 1954, 1955, 1956, 1957, 1958, 1289, 1959, 1960, 1961, 1962, 1963, 1964, 1965,
+    1582, 1966, 1967, 1968, 1969, 1970, 1971, 1971, 1583, 1612, 1972, 1973, 1974, 1975, 1976, 1251,
+    1585, 1977, 1978, 1511, 1979, 1980, 1465, 1981, 1982, 1515, 1983, 1984, 1985, 1986, 1986, 1987,
+    1988, 1989, 1990, 1991, 1992, 1993, 1994, 1995, 1996, 1997, 1998, 1999, 2000, 2001, 2002, 2003,
+    2004, 2005, 2006, 2007, 2008, 2009, 2010, 2011, 2012, 2013, 1521, 2014, 2015, 2016, 2017, 2018,
+    2019, 2020, 2021, 2022, 2023, 2024, 2025, 2026, 2027, 2028, 2029, 1815, 2030, 2031, 2032, 2033,
+    2034, 2035, 2036, 2037, 2038, 2039, 2040, 2041, 1307, 2042, 2043, 2044, 2045, 2046, 2047, 1524,
+    2048, 2049, 2050, 2051, 2052, 2053, 2054, 2055, 2056, 2057, 2058, 2059, 2060, 2061, 2062, 2063,
+    2064, 2065, 2066, 2067, 1246, 2068, 2069, 2070, 2071, 2072, 2073, 1592, 2074, 2075, 2076, 2077,
+    2078, 2079, 2080, 2081, 2082, 2083, 2084, 2085, 2086, 2087, 2088, 2089, 2090, 2091, 2092, 2093,
+    1597, 1598, 2094, 2095, 2096, 2097, 2098, 2099, 2100, 2101, 2102, 2103, 2104, 2105, 2106, 1599,
+    2107, 2108, 2109, 2110, 2111, 2112, 2113, 2114, 2115, 2116, 2117, 2118, 2119, 2120, 2121, 2122,
+    2123, 2124, 2125, 2126, 2127, 2128, 2129, 2130, 2131, 2132, 2133, 2134, 2135, 2136, 1605, 1605,
+    2137, 2138, 2139, 2140, 2141, 2142, 2143, 2144, 2145, 2146, 1606, 2147, 2148, 2149, 2150, 2151,
+    2152, 2153, 2154, 2155, 2156, 2157, 2158, 2159, 2160, 2161, 2162, 2163, 2164, 2165,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+};
+
+
+static const UnicodeRecord unicodeRecords[2166] =
+{
+    { 0, 0, 0, 0, 0, 7 },
+    { 32, 0, 0, 0, 0, 5 },
+    { 0, -32, 0, 0, 0, 3 },
+    { 775, 743, 0, 0, 0, 1 },
+    { 32, 0, 1, 2, 0, 5 },
+    { 32, 0, 3, 2, 0, 5 },
+    { 32, 0, 5, 2, 0, 5 },
+    { 32, 0, 7, 2, 0, 5 },
+    { 32, 0, 9, 2, 0, 5 },
+    { 32, 0, 11, 2, 0, 5 },
+    { 32, 0, 13, 2, 0, 5 },
+    { 32, 0, 15, 2, 0, 5 },
+    { 32, 0, 17, 2, 0, 5 },
+    { 32, 0, 19, 2, 0, 5 },
+    { 32, 0, 21, 2, 0, 5 },
+    { 32, 0, 23, 2, 0, 5 },
+    { 32, 0, 25, 2, 0, 5 },
+    { 32, 0, 27, 2, 0, 5 },
+    { 32, 0, 29, 2, 0, 5 },
+    { 32, 0, 31, 2, 0, 5 },
+    { 32, 0, 33, 2, 0, 5 },
+    { 32, 0, 35, 2, 0, 5 },
+    { 32, 0, 37, 2, 0, 5 },
+    { 32, 0, 39, 2, 0, 5 },
+    { 32, 0, 41, 2, 0, 5 },
+    { 32, 0, 43, 2, 0, 5 },
+    { 32, 0, 45, 2, 0, 5 },
+    { 32, 0, 47, 2, 0, 5 },
+    { 32, 0, 49, 2, 0, 5 },
+    { 32, 0, 51, 2, 0, 5 },
+    { 0, -32, 53, 2, 0, 3 },
+    { 0, -32, 55, 2, 0, 3 },
+    { 0, -32, 57, 2, 0, 3 },
+    { 0, -32, 59, 2, 0, 3 },
+    { 0, -32, 61, 2, 0, 3 },
+    { 0, -32, 63, 2, 0, 3 },
+    { 0, -32, 65, 2, 0, 3 },
+    { 0, -32, 67, 2, 0, 3 },
+    { 0, -32, 69, 2, 0, 3 },
+    { 0, -32, 71, 2, 0, 3 },
+    { 0, -32, 73, 2, 0, 3 },
+    { 0, -32, 75, 2, 0, 3 },
+    { 0, -32, 77, 2, 0, 3 },
+    { 0, -32, 79, 2, 0, 3 },
+    { 0, -32, 81, 2, 0, 3 },
+    { 0, -32, 83, 2, 0, 3 },
+    { 0, -32, 85, 2, 0, 3 },
+    { 0, -32, 87, 2, 0, 3 },
+    { 0, -32, 89, 2, 0, 3 },
+    { 0, -32, 91, 2, 0, 3 },
+    { 0, -32, 93, 2, 0, 3 },
+    { 0, -32, 95, 2, 0, 3 },
+    { 0, -32, 97, 2, 0, 3 },
+    { 0, -32, 99, 2, 0, 3 },
+    { 0, -32, 101, 2, 0, 3 },
+    { 0, -32, 103, 2, 0, 3 },
+    { 0, 121, 105, 2, 0, 3 },
+    { 1, 0, 107, 2, 0, 5 },
+    { 0, -1, 109, 2, 0, 3 },
+    { 1, 0, 111, 2, 0, 5 },
+    { 0, -1, 113, 2, 0, 3 },
+    { 1, 0, 115, 2, 0, 5 },
+    { 0, -1, 117, 2, 0, 3 },
+    { 1, 0, 119, 2, 0, 5 },
+    { 0, -1, 121, 2, 0, 3 },
+    { 1, 0, 123, 2, 0, 5 },
+    { 0, -1, 125, 2, 0, 3 },
+    { 1, 0, 127, 2, 0, 5 },
+    { 0, -1, 129, 2, 0, 3 },
+    { 1, 0, 131, 2, 0, 5 },
+    { 0, -1, 133, 2, 0, 3 },
+    { 1, 0, 135, 2, 0, 5 },
+    { 0, -1, 137, 2, 0, 3 },
+    { 1, 0, 0, 0, 0, 5 },
+    { 0, -1, 0, 0, 0, 3 },
+    { 1, 0, 139, 2, 0, 5 },
+    { 0, -1, 141, 2, 0, 3 },
+    { 1, 0, 143, 2, 0, 5 },
+    { 0, -1, 145, 2, 0, 3 },
+    { 1, 0, 147, 2, 0, 5 },
+    { 0, -1, 149, 2, 0, 3 },
+    { 1, 0, 151, 2, 0, 5 },
+    { 0, -1, 153, 2, 0, 3 },
+    { 1, 0, 155, 2, 0, 5 },
+    { 0, -1, 157, 2, 0, 3 },
+    { 1, 0, 159, 2, 0, 5 },
+    { 0, -1, 161, 2, 0, 3 },
+    { 1, 0, 163, 2, 0, 5 },
+    { 0, -1, 165, 2, 0, 3 },
+    { 1, 0, 167, 2, 0, 5 },
+    { 0, -1, 169, 2, 0, 3 },
+    { 1, 0, 171, 2, 0, 5 },
+    { 0, -1, 173, 2, 0, 3 },
+    { 1, 0, 175, 2, 0, 5 },
+    { 0, -1, 177, 2, 0, 3 },
+    { 1, 0, 179, 2, 0, 5 },
+    { 0, -1, 181, 2, 0, 3 },
+    { 1, 0, 183, 2, 0, 5 },
+    { 0, -1, 185, 2, 0, 3 },
+    { 1, 0, 187, 2, 0, 5 },
+    { 0, -1, 189, 2, 0, 3 },
+    { 1, 0, 191, 2, 0, 5 },
+    { 0, -1, 193, 2, 0, 3 },
+    { 0, 0, 195, 2, 0, 5 },
+    { 0, -232, 0, 0, 0, 3 },
+    { 1, 0, 197, 2, 0, 5 },
+    { 0, -1, 199, 2, 0, 3 },
+    { 1, 0, 201, 2, 0, 5 },
+    { 0, -1, 203, 2, 0, 3 },
+    { 1, 0, 205, 2, 0, 5 },
+    { 0, -1, 207, 2, 0, 3 },
+    { 1, 0, 209, 2, 0, 5 },
+    { 0, -1, 211, 2, 0, 3 },
+    { 1, 0, 213, 2, 0, 5 },
+    { 0, -1, 215, 2, 0, 3 },
+    { 1, 0, 217, 2, 0, 5 },
+    { 0, -1, 219, 2, 0, 3 },
+    { 1, 0, 221, 2, 0, 5 },
+    { 0, -1, 223, 2, 0, 3 },
+    { 1, 0, 225, 2, 0, 5 },
+    { 0, -1, 227, 2, 0, 3 },
+    { 1, 0, 229, 2, 0, 5 },
+    { 0, -1, 231, 2, 0, 3 },
+    { 1, 0, 233, 2, 0, 5 },
+    { 0, -1, 235, 2, 0, 3 },
+    { 1, 0, 237, 2, 0, 5 },
+    { 0, -1, 239, 2, 0, 3 },
+    { 1, 0, 241, 2, 0, 5 },
+    { 0, -1, 243, 2, 0, 3 },
+    { 1, 0, 245, 2, 0, 5 },
+    { 0, -1, 247, 2, 0, 3 },
+    { 1, 0, 249, 2, 0, 5 },
+    { 0, -1, 251, 2, 0, 3 },
+    { 1, 0, 253, 2, 0, 5 },
+    { 0, -1, 255, 2, 0, 3 },
+    { 1, 0, 257, 2, 0, 5 },
+    { 0, -1, 259, 2, 0, 3 },
+    { 1, 0, 261, 2, 0, 5 },
+    { 0, -1, 263, 2, 0, 3 },
+    { 1, 0, 265, 2, 0, 5 },
+    { 0, -1, 267, 2, 0, 3 },
+    { 1, 0, 269, 2, 0, 5 },
+    { 0, -1, 271, 2, 0, 3 },
+    { 1, 0, 273, 2, 0, 5 },
+    { 0, -1, 275, 2, 0, 3 },
+    { 1, 0, 277, 2, 0, 5 },
+    { 0, -1, 279, 2, 0, 3 },
+    { 1, 0, 281, 2, 0, 5 },
+    { 0, -1, 283, 2, 0, 3 },
+    { 1, 0, 285, 2, 0, 5 },
+    { 0, -1, 287, 2, 0, 3 },
+    { 1, 0, 289, 2, 0, 5 },
+    { 0, -1, 291, 2, 0, 3 },
+    { 1, 0, 293, 2, 0, 5 },
+    { 0, -1, 295, 2, 0, 3 },
+    { 1, 0, 297, 2, 0, 5 },
+    { 0, -1, 299, 2, 0, 3 },
+    { 1, 0, 301, 2, 0, 5 },
+    { 0, -1, 303, 2, 0, 3 },
+    { 1, 0, 305, 2, 0, 5 },
+    { 0, -1, 307, 2, 0, 3 },
+    { -121, 0, 309, 2, 0, 5 },
+    { 1, 0, 311, 2, 0, 5 },
+    { 0, -1, 313, 2, 0, 3 },
+    { 1, 0, 315, 2, 0, 5 },
+    { 0, -1, 317, 2, 0, 3 },
+    { 1, 0, 319, 2, 0, 5 },
+    { 0, -1, 321, 2, 0, 3 },
+    { -268, -300, 0, 0, 0, 1 },
+    { 0, 195, 0, 0, 0, 3 },
+    { 210, 0, 0, 0, 0, 5 },
+    { 206, 0, 0, 0, 0, 5 },
+    { 205, 0, 0, 0, 0, 5 },
+    { 79, 0, 0, 0, 0, 5 },
+    { 202, 0, 0, 0, 0, 5 },
+    { 203, 0, 0, 0, 0, 5 },
+    { 207, 0, 0, 0, 0, 5 },
+    { 0, 97, 0, 0, 0, 3 },
+    { 211, 0, 0, 0, 0, 5 },
+    { 209, 0, 0, 0, 0, 5 },
+    { 0, 163, 0, 0, 0, 3 },
+    { 213, 0, 0, 0, 0, 5 },
+    { 0, 130, 0, 0, 0, 3 },
+    { 214, 0, 0, 0, 0, 5 },
+    { 1, 0, 323, 2, 0, 5 },
+    { 0, -1, 325, 2, 0, 3 },
+    { 218, 0, 0, 0, 0, 5 },
+    { 1, 0, 327, 2, 0, 5 },
+    { 0, -1, 329, 2, 0, 3 },
+    { 217, 0, 0, 0, 0, 5 },
+    { 219, 0, 0, 0, 0, 5 },
+    { 0, 56, 0, 0, 0, 3 },
+    { 2, 0, 0, 0, 0, 5 },
+    { 1, -1, 0, 0, 0, 1 },
+    { 0, -2, 0, 0, 0, 3 },
+    { 1, 0, 331, 2, 0, 5 },
+    { 0, -1, 333, 2, 0, 3 },
+    { 1, 0, 335, 2, 0, 5 },
+    { 0, -1, 337, 2, 0, 3 },
+    { 1, 0, 339, 2, 0, 5 },
+    { 0, -1, 341, 2, 0, 3 },
+    { 1, 0, 343, 2, 0, 5 },
+    { 0, -1, 345, 2, 0, 3 },
+    { 1, 0, 347, 3, 0, 5 },
+    { 0, -1, 350, 3, 0, 3 },
+    { 1, 0, 353, 3, 0, 5 },
+    { 0, -1, 356, 3, 0, 3 },
+    { 1, 0, 359, 3, 0, 5 },
+    { 0, -1, 362, 3, 0, 3 },
+    { 1, 0, 365, 3, 0, 5 },
+    { 0, -1, 368, 3, 0, 3 },
+    { 0, -79, 0, 0, 0, 3 },
+    { 1, 0, 371, 3, 0, 5 },
+    { 0, -1, 374, 3, 0, 3 },
+    { 1, 0, 377, 3, 0, 5 },
+    { 0, -1, 380, 3, 0, 3 },
+    { 1, 0, 383, 2, 0, 5 },
+    { 0, -1, 385, 2, 0, 3 },
+    { 1, 0, 387, 2, 0, 5 },
+    { 0, -1, 389, 2, 0, 3 },
+    { 1, 0, 391, 2, 0, 5 },
+    { 0, -1, 393, 2, 0, 3 },
+    { 1, 0, 395, 2, 0, 5 },
+    { 0, -1, 397, 2, 0, 3 },
+    { 1, 0, 399, 3, 0, 5 },
+    { 0, -1, 402, 3, 0, 3 },
+    { 1, 0, 405, 2, 0, 5 },
+    { 0, -1, 407, 2, 0, 3 },
+    { 0, 0, 409, 2, 0, 3 },
+    { 1, 0, 411, 2, 0, 5 },
+    { 0, -1, 413, 2, 0, 3 },
+    { -97, 0, 0, 0, 0, 5 },
+    { -56, 0, 0, 0, 0, 5 },
+    { 1, 0, 415, 2, 0, 5 },
+    { 0, -1, 417, 2, 0, 3 },
+    { 1, 0, 419, 3, 0, 5 },
+    { 0, -1, 422, 3, 0, 3 },
+    { 1, 0, 425, 2, 0, 5 },
+    { 0, -1, 427, 2, 0, 3 },
+    { 1, 0, 429, 2, 0, 5 },
+    { 0, -1, 431, 2, 0, 3 },
+    { 1, 0, 433, 2, 0, 5 },
+    { 0, -1, 435, 2, 0, 3 },
+    { 1, 0, 437, 2, 0, 5 },
+    { 0, -1, 439, 2, 0, 3 },
+    { 1, 0, 441, 2, 0, 5 },
+    { 0, -1, 443, 2, 0, 3 },
+    { 1, 0, 445, 2, 0, 5 },
+    { 0, -1, 447, 2, 0, 3 },
+    { 1, 0, 449, 2, 0, 5 },
+    { 0, -1, 451, 2, 0, 3 },
+    { 1, 0, 453, 2, 0, 5 },
+    { 0, -1, 455, 2, 0, 3 },
+    { 1, 0, 457, 2, 0, 5 },
+    { 0, -1, 459, 2, 0, 3 },
+    { 1, 0, 461, 2, 0, 5 },
+    { 0, -1, 463, 2, 0, 3 },
+    { 1, 0, 465, 2, 0, 5 },
+    { 0, -1, 467, 2, 0, 3 },
+    { 1, 0, 469, 2, 0, 5 },
+    { 0, -1, 471, 2, 0, 3 },
+    { 1, 0, 473, 2, 0, 5 },
+    { 0, -1, 475, 2, 0, 3 },
+    { 1, 0, 477, 2, 0, 5 },
+    { 0, -1, 479, 2, 0, 3 },
+    { 1, 0, 481, 2, 0, 5 },
+    { 0, -1, 483, 2, 0, 3 },
+    { 1, 0, 485, 2, 0, 5 },
+    { 0, -1, 487, 2, 0, 3 },
+    { 1, 0, 489, 2, 0, 5 },
+    { 0, -1, 491, 2, 0, 3 },
+    { -130, 0, 0, 0, 0, 5 },
+    { 1, 0, 493, 2, 0, 5 },
+    { 0, -1, 495, 2, 0, 3 },
+    { 1, 0, 497, 2, 0, 5 },
+    { 0, -1, 499, 2, 0, 3 },
+    { 1, 0, 501, 3, 0, 5 },
+    { 0, -1, 504, 3, 0, 3 },
+    { 1, 0, 507, 3, 0, 5 },
+    { 0, -1, 510, 3, 0, 3 },
+    { 1, 0, 513, 2, 0, 5 },
+    { 0, -1, 515, 2, 0, 3 },
+    { 1, 0, 517, 3, 0, 5 },
+    { 0, -1, 520, 3, 0, 3 },
+    { 1, 0, 523, 2, 0, 5 },
+    { 0, -1, 525, 2, 0, 3 },
+    { 10795, 0, 0, 0, 0, 5 },
+    { -163, 0, 0, 0, 0, 5 },
+    { 10792, 0, 0, 0, 0, 5 },
+    { 0, 10815, 0, 0, 0, 3 },
+    { -195, 0, 0, 0, 0, 5 },
+    { 69, 0, 0, 0, 0, 5 },
+    { 71, 0, 0, 0, 0, 5 },
+    { 0, 10783, 0, 0, 0, 3 },
+    { 0, 10780, 0, 0, 0, 3 },
+    { 0, 10782, 0, 0, 0, 3 },
+    { 0, -210, 0, 0, 0, 3 },
+    { 0, -206, 0, 0, 0, 3 },
+    { 0, -205, 0, 0, 0, 3 },
+    { 0, -202, 0, 0, 0, 3 },
+    { 0, -203, 0, 0, 0, 3 },
+    { 0, 42319, 0, 0, 0, 3 },
+    { 0, 42315, 0, 0, 0, 3 },
+    { 0, -207, 0, 0, 0, 3 },
+    { 0, 42280, 0, 0, 0, 3 },
+    { 0, 42308, 0, 0, 0, 3 },
+    { 0, -209, 0, 0, 0, 3 },
+    { 0, -211, 0, 0, 0, 3 },
+    { 0, 10743, 0, 0, 0, 3 },
+    { 0, 42305, 0, 0, 0, 3 },
+    { 0, 10749, 0, 0, 0, 3 },
+    { 0, -213, 0, 0, 0, 3 },
+    { 0, -214, 0, 0, 0, 3 },
+    { 0, 10727, 0, 0, 0, 3 },
+    { 0, -218, 0, 0, 0, 3 },
+    { 0, 42307, 0, 0, 0, 3 },
+    { 0, 42282, 0, 0, 0, 3 },
+    { 0, -69, 0, 0, 0, 3 },
+    { 0, -217, 0, 0, 0, 3 },
+    { 0, -71, 0, 0, 0, 3 },
+    { 0, -219, 0, 0, 0, 3 },
+    { 0, 42261, 0, 0, 0, 3 },
+    { 0, 42258, 0, 0, 0, 3 },
+    { 0, 0, 0, 0, 230, 0 },
+    { 0, 0, 0, 0, 232, 0 },
+    { 0, 0, 0, 0, 220, 0 },
+    { 0, 0, 0, 0, 216, 0 },
+    { 0, 0, 0, 0, 202, 0 },
+    { 0, 0, 0, 0, 1, 0 },
+    { 0, 0, 527, 1, 230, 0 },
+    { 0, 0, 528, 1, 230, 0 },
+    { 0, 0, 529, 1, 230, 0 },
+    { 0, 0, 530, 2, 230, 0 },
+    { 116, 84, 0, 0, 240, 0 },
+    { 0, 0, 0, 0, 233, 0 },
+    { 0, 0, 0, 0, 234, 0 },
+    { 0, 0, 532, 1, 0, 0 },
+    { 0, 0, 533, 1, 0, 0 },
+    { 116, 0, 0, 0, 0, 5 },
+    { 0, 0, 534, 2, 0, 7 },
+    { 38, 0, 536, 2, 0, 5 },
+    { 0, 0, 538, 1, 0, 0 },
+    { 37, 0, 539, 2, 0, 5 },
+    { 37, 0, 541, 2, 0, 5 },
+    { 37, 0, 543, 2, 0, 5 },
+    { 64, 0, 545, 2, 0, 5 },
+    { 63, 0, 547, 2, 0, 5 },
+    { 63, 0, 549, 2, 0, 5 },
+    { 0, 0, 551, 3, 0, 3 },
+    { 32, 0, 554, 2, 0, 5 },
+    { 32, 0, 556, 2, 0, 5 },
+    { 0, -38, 558, 2, 0, 3 },
+    { 0, -37, 560, 2, 0, 3 },
+    { 0, -37, 562, 2, 0, 3 },
+    { 0, -37, 564, 2, 0, 3 },
+    { 0, 0, 566, 3, 0, 3 },
+    { 1, -31, 0, 0, 0, 1 },
+    { 0, -32, 569, 2, 0, 3 },
+    { 0, -32, 571, 2, 0, 3 },
+    { 0, -64, 573, 2, 0, 3 },
+    { 0, -63, 575, 2, 0, 3 },
+    { 0, -63, 577, 2, 0, 3 },
+    { 8, 0, 0, 0, 0, 5 },
+    { -30, -62, 0, 0, 0, 1 },
+    { -25, -57, 0, 0, 0, 1 },
+    { 0, 0, 579, 2, 0, 7 },
+    { 0, 0, 581, 2, 0, 7 },
+    { -15, -47, 0, 0, 0, 1 },
+    { -22, -54, 0, 0, 0, 1 },
+    { 0, -8, 0, 0, 0, 3 },
+    { -54, -86, 0, 0, 0, 1 },
+    { -48, -80, 0, 0, 0, 1 },
+    { 0, 7, 0, 0, 0, 3 },
+    { 0, -116, 0, 0, 0, 3 },
+    { -60, 0, 0, 0, 0, 5 },
+    { -64, -96, 0, 0, 0, 1 },
+    { -7, 0, 0, 0, 0, 5 },
+    { 80, 0, 583, 2, 0, 5 },
+    { 80, 0, 585, 2, 0, 5 },
+    { 80, 0, 0, 0, 0, 5 },
+    { 80, 0, 587, 2, 0, 5 },
+    { 80, 0, 589, 2, 0, 5 },
+    { 80, 0, 591, 2, 0, 5 },
+    { 80, 0, 593, 2, 0, 5 },
+    { 80, 0, 595, 2, 0, 5 },
+    { 32, 0, 597, 2, 0, 5 },
+    { 0, -32, 599, 2, 0, 3 },
+    { 0, -80, 601, 2, 0, 3 },
+    { 0, -80, 603, 2, 0, 3 },
+    { 0, -80, 0, 0, 0, 3 },
+    { 0, -80, 605, 2, 0, 3 },
+    { 0, -80, 607, 2, 0, 3 },
+    { 0, -80, 609, 2, 0, 3 },
+    { 0, -80, 611, 2, 0, 3 },
+    { 0, -80, 613, 2, 0, 3 },
+    { 1, 0, 615, 2, 0, 5 },
+    { 0, -1, 617, 2, 0, 3 },
+    { 15, 0, 0, 0, 0, 5 },
+    { 1, 0, 619, 2, 0, 5 },
+    { 0, -1, 621, 2, 0, 3 },
+    { 0, -15, 0, 0, 0, 3 },
+    { 1, 0, 623, 2, 0, 5 },
+    { 0, -1, 625, 2, 0, 3 },
+    { 1, 0, 627, 2, 0, 5 },
+    { 0, -1, 629, 2, 0, 3 },
+    { 1, 0, 631, 2, 0, 5 },
+    { 0, -1, 633, 2, 0, 3 },
+    { 1, 0, 635, 2, 0, 5 },
+    { 0, -1, 637, 2, 0, 3 },
+    { 1, 0, 639, 2, 0, 5 },
+    { 0, -1, 641, 2, 0, 3 },
+    { 1, 0, 643, 2, 0, 5 },
+    { 0, -1, 645, 2, 0, 3 },
+    { 1, 0, 647, 2, 0, 5 },
+    { 0, -1, 649, 2, 0, 3 },
+    { 1, 0, 651, 2, 0, 5 },
+    { 0, -1, 653, 2, 0, 3 },
+    { 1, 0, 655, 2, 0, 5 },
+    { 0, -1, 657, 2, 0, 3 },
+    { 1, 0, 659, 2, 0, 5 },
+    { 0, -1, 661, 2, 0, 3 },
+    { 1, 0, 663, 2, 0, 5 },
+    { 0, -1, 665, 2, 0, 3 },
+    { 1, 0, 667, 2, 0, 5 },
+    { 0, -1, 669, 2, 0, 3 },
+    { 1, 0, 671, 2, 0, 5 },
+    { 0, -1, 673, 2, 0, 3 },
+    { 1, 0, 675, 2, 0, 5 },
+    { 0, -1, 677, 2, 0, 3 },
+    { 1, 0, 679, 2, 0, 5 },
+    { 0, -1, 681, 2, 0, 3 },
+    { 1, 0, 683, 2, 0, 5 },
+    { 0, -1, 685, 2, 0, 3 },
+    { 48, 0, 0, 0, 0, 5 },
+    { 0, -48, 0, 0, 0, 3 },
+    { 0, 0, 0, 0, 222, 0 },
+    { 0, 0, 0, 0, 228, 0 },
+    { 0, 0, 0, 0, 10, 0 },
+    { 0, 0, 0, 0, 11, 0 },
+    { 0, 0, 0, 0, 12, 0 },
+    { 0, 0, 0, 0, 13, 0 },
+    { 0, 0, 0, 0, 14, 0 },
+    { 0, 0, 0, 0, 15, 0 },
+    { 0, 0, 0, 0, 16, 0 },
+    { 0, 0, 0, 0, 17, 0 },
+    { 0, 0, 0, 0, 18, 0 },
+    { 0, 0, 0, 0, 19, 0 },
+    { 0, 0, 0, 0, 20, 0 },
+    { 0, 0, 0, 0, 21, 0 },
+    { 0, 0, 0, 0, 22, 0 },
+    { 0, 0, 0, 0, 23, 0 },
+    { 0, 0, 0, 0, 24, 0 },
+    { 0, 0, 0, 0, 25, 0 },
+    { 0, 0, 0, 0, 30, 0 },
+    { 0, 0, 0, 0, 31, 0 },
+    { 0, 0, 0, 0, 32, 0 },
+    { 0, 0, 687, 2, 0, 7 },
+    { 0, 0, 689, 2, 0, 7 },
+    { 0, 0, 691, 2, 0, 7 },
+    { 0, 0, 693, 2, 0, 7 },
+    { 0, 0, 695, 2, 0, 7 },
+    { 0, 0, 0, 0, 27, 0 },
+    { 0, 0, 0, 0, 28, 0 },
+    { 0, 0, 0, 0, 29, 0 },
+    { 0, 0, 0, 0, 33, 0 },
+    { 0, 0, 0, 0, 34, 0 },
+    { 0, 0, 0, 0, 35, 0 },
+    { 0, 0, 697, 2, 0, 7 },
+    { 0, 0, 699, 2, 0, 7 },
+    { 0, 0, 701, 2, 0, 7 },
+    { 0, 0, 0, 0, 36, 0 },
+    { 0, 0, 703, 2, 0, 7 },
+    { 0, 0, 705, 2, 0, 7 },
+    { 0, 0, 707, 2, 0, 7 },
+    { 0, 0, 0, 0, 7, 0 },
+    { 0, 0, 0, 0, 9, 0 },
+    { 0, 0, 709, 2, 0, 0 },
+    { 0, 0, 711, 2, 0, 0 },
+    { 0, 0, 713, 2, 0, 0 },
+    { 0, 0, 715, 2, 0, 0 },
+    { 0, 0, 717, 2, 0, 0 },
+    { 0, 0, 719, 2, 0, 0 },
+    { 0, 0, 721, 2, 0, 0 },
+    { 0, 0, 723, 2, 0, 0 },
+    { 0, 0, 0, 0, 0, 0 },
+    { 0, 0, 725, 2, 0, 7 },
+    { 0, 0, 727, 2, 0, 7 },
+    { 0, 0, 729, 2, 0, 0 },
+    { 0, 0, 731, 2, 0, 0 },
+    { 0, 0, 733, 2, 0, 0 },
+    { 0, 0, 735, 2, 0, 0 },
+    { 0, 0, 737, 2, 0, 0 },
+    { 0, 0, 739, 2, 0, 0 },
+    { 0, 0, 741, 2, 0, 0 },
+    { 0, 0, 743, 2, 0, 0 },
+    { 0, 0, 745, 2, 0, 0 },
+    { 0, 0, 747, 2, 0, 7 },
+    { 0, 0, 749, 2, 0, 7 },
+    { 0, 0, 751, 2, 0, 7 },
+    { 0, 0, 753, 2, 0, 0 },
+    { 0, 0, 755, 2, 0, 0 },
+    { 0, 0, 757, 2, 0, 7 },
+    { 0, 0, 759, 2, 0, 7 },
+    { 0, 0, 761, 2, 0, 7 },
+    { 0, 0, 763, 2, 0, 7 },
+    { 0, 0, 765, 2, 0, 7 },
+    { 0, 0, 0, 0, 84, 0 },
+    { 0, 0, 0, 0, 91, 0 },
+    { 0, 0, 767, 2, 0, 7 },
+    { 0, 0, 769, 2, 0, 7 },
+    { 0, 0, 771, 2, 0, 7 },
+    { 0, 0, 773, 2, 0, 7 },
+    { 0, 0, 775, 3, 0, 7 },
+    { 0, 0, 778, 2, 0, 7 },
+    { 0, 0, 780, 2, 0, 7 },
+    { 0, 0, 782, 2, 0, 7 },
+    { 0, 0, 784, 2, 0, 7 },
+    { 0, 0, 786, 2, 0, 7 },
+    { 0, 0, 788, 3, 0, 7 },
+    { 0, 0, 791, 2, 0, 7 },
+    { 0, 0, 0, 0, 103, 0 },
+    { 0, 0, 0, 0, 107, 0 },
+    { 0, 0, 0, 0, 118, 0 },
+    { 0, 0, 0, 0, 122, 0 },
+    { 0, 0, 793, 2, 0, 0 },
+    { 0, 0, 795, 2, 0, 0 },
+    { 0, 0, 797, 2, 0, 0 },
+    { 0, 0, 799, 2, 0, 0 },
+    { 0, 0, 801, 2, 0, 0 },
+    { 0, 0, 803, 2, 0, 0 },
+    { 0, 0, 0, 0, 129, 0 },
+    { 0, 0, 0, 0, 130, 0 },
+    { 0, 0, 805, 2, 0, 0 },
+    { 0, 0, 0, 0, 132, 0 },
+    { 0, 0, 807, 2, 0, 0 },
+    { 0, 0, 809, 2, 0, 0 },
+    { 0, 0, 811, 2, 0, 0 },
+    { 0, 0, 813, 2, 0, 0 },
+    { 0, 0, 815, 2, 0, 0 },
+    { 0, 0, 817, 2, 0, 0 },
+    { 0, 0, 819, 2, 0, 0 },
+    { 0, 0, 821, 2, 0, 0 },
+    { 0, 0, 823, 2, 0, 0 },
+    { 0, 0, 825, 2, 0, 0 },
+    { 0, 0, 827, 2, 0, 7 },
+    { 7264, 0, 0, 0, 0, 5 },
+    { 0, 3008, 0, 0, 0, 3 },
+    { -8, -8, 0, 0, 0, 1 },
+    { 0, 0, 829, 2, 0, 7 },
+    { 0, 0, 831, 2, 0, 7 },
+    { 0, 0, 833, 2, 0, 7 },
+    { 0, 0, 835, 2, 0, 7 },
+    { 0, 0, 837, 2, 0, 7 },
+    { 0, 0, 839, 2, 0, 7 },
+    { 0, 0, 841, 2, 0, 7 },
+    { 0, 0, 843, 2, 0, 7 },
+    { 0, 0, 845, 2, 0, 7 },
+    { 0, 0, 847, 2, 0, 7 },
+    { 0, 0, 849, 2, 0, 7 },
+    { -6222, -6254, 0, 0, 0, 1 },
+    { -6221, -6253, 0, 0, 0, 1 },
+    { -6212, -6244, 0, 0, 0, 1 },
+    { -6210, -6242, 0, 0, 0, 1 },
+    { -6211, -6243, 0, 0, 0, 1 },
+    { -6204, -6236, 0, 0, 0, 1 },
+    { -6180, -6181, 0, 0, 0, 1 },
+    { 35267, 35266, 0, 0, 0, 1 },
+    { -3008, 0, 0, 0, 0, 5 },
+    { 0, 35332, 0, 0, 0, 3 },
+    { 0, 3814, 0, 0, 0, 3 },
+    { 0, 35384, 0, 0, 0, 3 },
+    { 0, 0, 0, 0, 214, 0 },
+    { 0, 0, 0, 0, 218, 0 },
+    { 1, 0, 851, 2, 0, 5 },
+    { 0, -1, 853, 2, 0, 3 },
+    { 1, 0, 855, 2, 0, 5 },
+    { 0, -1, 857, 2, 0, 3 },
+    { 1, 0, 859, 2, 0, 5 },
+    { 0, -1, 861, 2, 0, 3 },
+    { 1, 0, 863, 2, 0, 5 },
+    { 0, -1, 865, 2, 0, 3 },
+    { 1, 0, 867, 3, 0, 5 },
+    { 0, -1, 870, 3, 0, 3 },
+    { 1, 0, 873, 2, 0, 5 },
+    { 0, -1, 875, 2, 0, 3 },
+    { 1, 0, 877, 2, 0, 5 },
+    { 0, -1, 879, 2, 0, 3 },
+    { 1, 0, 881, 2, 0, 5 },
+    { 0, -1, 883, 2, 0, 3 },
+    { 1, 0, 885, 2, 0, 5 },
+    { 0, -1, 887, 2, 0, 3 },
+    { 1, 0, 889, 2, 0, 5 },
+    { 0, -1, 891, 2, 0, 3 },
+    { 1, 0, 893, 3, 0, 5 },
+    { 0, -1, 896, 3, 0, 3 },
+    { 1, 0, 899, 3, 0, 5 },
+    { 0, -1, 902, 3, 0, 3 },
+    { 1, 0, 905, 2, 0, 5 },
+    { 0, -1, 907, 2, 0, 3 },
+    { 1, 0, 909, 2, 0, 5 },
+    { 0, -1, 911, 2, 0, 3 },
+    { 1, 0, 913, 3, 0, 5 },
+    { 0, -1, 916, 3, 0, 3 },
+    { 1, 0, 919, 2, 0, 5 },
+    { 0, -1, 921, 2, 0, 3 },
+    { 1, 0, 923, 2, 0, 5 },
+    { 0, -1, 925, 2, 0, 3 },
+    { 1, 0, 927, 2, 0, 5 },
+    { 0, -1, 929, 2, 0, 3 },
+    { 1, 0, 931, 2, 0, 5 },
+    { 0, -1, 933, 2, 0, 3 },
+    { 1, 0, 935, 2, 0, 5 },
+    { 0, -1, 937, 2, 0, 3 },
+    { 1, 0, 939, 2, 0, 5 },
+    { 0, -1, 941, 2, 0, 3 },
+    { 1, 0, 943, 2, 0, 5 },
+    { 0, -1, 945, 2, 0, 3 },
+    { 1, 0, 947, 2, 0, 5 },
+    { 0, -1, 949, 2, 0, 3 },
+    { 1, 0, 951, 3, 0, 5 },
+    { 0, -1, 954, 3, 0, 3 },
+    { 1, 0, 957, 2, 0, 5 },
+    { 0, -1, 959, 2, 0, 3 },
+    { 1, 0, 961, 2, 0, 5 },
+    { 0, -1, 963, 2, 0, 3 },
+    { 1, 0, 965, 2, 0, 5 },
+    { 0, -1, 967, 2, 0, 3 },
+    { 1, 0, 969, 2, 0, 5 },
+    { 0, -1, 971, 2, 0, 3 },
+    { 1, 0, 973, 3, 0, 5 },
+    { 0, -1, 976, 3, 0, 3 },
+    { 1, 0, 979, 2, 0, 5 },
+    { 0, -1, 981, 2, 0, 3 },
+    { 1, 0, 983, 2, 0, 5 },
+    { 0, -1, 985, 2, 0, 3 },
+    { 1, 0, 987, 2, 0, 5 },
+    { 0, -1, 989, 2, 0, 3 },
+    { 1, 0, 991, 2, 0, 5 },
+    { 0, -1, 993, 2, 0, 3 },
+    { 1, 0, 995, 2, 0, 5 },
+    { 0, -1, 997, 2, 0, 3 },
+    { 1, 0, 999, 2, 0, 5 },
+    { 0, -1, 1001, 2, 0, 3 },
+    { 1, 0, 1003, 2, 0, 5 },
+    { 0, -1, 1005, 2, 0, 3 },
+    { 1, 0, 1007, 2, 0, 5 },
+    { 0, -1, 1009, 2, 0, 3 },
+    { 1, 0, 1011, 2, 0, 5 },
+    { 0, -1, 1013, 2, 0, 3 },
+    { 1, 0, 1015, 3, 0, 5 },
+    { 0, -1, 1018, 3, 0, 3 },
+    { 1, 0, 1021, 3, 0, 5 },
+    { 0, -1, 1024, 3, 0, 3 },
+    { 1, 0, 1027, 3, 0, 5 },
+    { 0, -1, 1030, 3, 0, 3 },
+    { 1, 0, 1033, 3, 0, 5 },
+    { 0, -1, 1036, 3, 0, 3 },
+    { 1, 0, 1039, 2, 0, 5 },
+    { 0, -1, 1041, 2, 0, 3 },
+    { 1, 0, 1043, 2, 0, 5 },
+    { 0, -1, 1045, 2, 0, 3 },
+    { 1, 0, 1047, 2, 0, 5 },
+    { 0, -1, 1049, 2, 0, 3 },
+    { 1, 0, 1051, 2, 0, 5 },
+    { 0, -1, 1053, 2, 0, 3 },
+    { 1, 0, 1055, 3, 0, 5 },
+    { 0, -1, 1058, 3, 0, 3 },
+    { 1, 0, 1061, 2, 0, 5 },
+    { 0, -1, 1063, 2, 0, 3 },
+    { 1, 0, 1065, 2, 0, 5 },
+    { 0, -1, 1067, 2, 0, 3 },
+    { 1, 0, 1069, 2, 0, 5 },
+    { 0, -1, 1071, 2, 0, 3 },
+    { 1, 0, 1073, 3, 0, 5 },
+    { 0, -1, 1076, 3, 0, 3 },
+    { 1, 0, 1079, 3, 0, 5 },
+    { 0, -1, 1082, 3, 0, 3 },
+    { 1, 0, 1085, 3, 0, 5 },
+    { 0, -1, 1088, 3, 0, 3 },
+    { 1, 0, 1091, 2, 0, 5 },
+    { 0, -1, 1093, 2, 0, 3 },
+    { 1, 0, 1095, 2, 0, 5 },
+    { 0, -1, 1097, 2, 0, 3 },
+    { 1, 0, 1099, 2, 0, 5 },
+    { 0, -1, 1101, 2, 0, 3 },
+    { 1, 0, 1103, 2, 0, 5 },
+    { 0, -1, 1105, 2, 0, 3 },
+    { 1, 0, 1107, 2, 0, 5 },
+    { 0, -1, 1109, 2, 0, 3 },
+    { 1, 0, 1111, 2, 0, 5 },
+    { 0, -1, 1113, 2, 0, 3 },
+    { 1, 0, 1115, 2, 0, 5 },
+    { 0, -1, 1117, 2, 0, 3 },
+    { 1, 0, 1119, 3, 0, 5 },
+    { 0, -1, 1122, 3, 0, 3 },
+    { 1, 0, 1125, 3, 0, 5 },
+    { 0, -1, 1128, 3, 0, 3 },
+    { 1, 0, 1131, 2, 0, 5 },
+    { 0, -1, 1133, 2, 0, 3 },
+    { 1, 0, 1135, 2, 0, 5 },
+    { 0, -1, 1137, 2, 0, 3 },
+    { 1, 0, 1139, 2, 0, 5 },
+    { 0, -1, 1141, 2, 0, 3 },
+    { 1, 0, 1143, 2, 0, 5 },
+    { 0, -1, 1145, 2, 0, 3 },
+    { 1, 0, 1147, 2, 0, 5 },
+    { 0, -1, 1149, 2, 0, 3 },
+    { 1, 0, 1151, 2, 0, 5 },
+    { 0, -1, 1153, 2, 0, 3 },
+    { 1, 0, 1155, 2, 0, 5 },
+    { 0, -1, 1157, 2, 0, 3 },
+    { 1, 0, 1159, 2, 0, 5 },
+    { 0, -1, 1161, 2, 0, 3 },
+    { 1, 0, 1163, 2, 0, 5 },
+    { 0, -1, 1165, 2, 0, 3 },
+    { 1, 0, 1167, 2, 0, 5 },
+    { 0, -1, 1169, 2, 0, 3 },
+    { 1, 0, 1171, 2, 0, 5 },
+    { 0, -1, 1173, 2, 0, 3 },
+    { 1, 0, 1175, 2, 0, 5 },
+    { 0, -1, 1177, 2, 0, 3 },
+    { 1, 0, 1179, 2, 0, 5 },
+    { 0, -1, 1181, 2, 0, 3 },
+    { 0, 0, 1183, 2, 0, 3 },
+    { 0, 0, 1185, 2, 0, 3 },
+    { 0, 0, 1187, 2, 0, 3 },
+    { 0, 0, 1189, 2, 0, 3 },
+    { -58, -59, 1191, 2, 0, 1 },
+    { -7615, 0, 0, 0, 0, 5 },
+    { 1, 0, 1193, 2, 0, 5 },
+    { 0, -1, 1195, 2, 0, 3 },
+    { 1, 0, 1197, 2, 0, 5 },
+    { 0, -1, 1199, 2, 0, 3 },
+    { 1, 0, 1201, 3, 0, 5 },
+    { 0, -1, 1204, 3, 0, 3 },
+    { 1, 0, 1207, 3, 0, 5 },
+    { 0, -1, 1210, 3, 0, 3 },
+    { 1, 0, 1213, 3, 0, 5 },
+    { 0, -1, 1216, 3, 0, 3 },
+    { 1, 0, 1219, 3, 0, 5 },
+    { 0, -1, 1222, 3, 0, 3 },
+    { 1, 0, 1225, 3, 0, 5 },
+    { 0, -1, 1228, 3, 0, 3 },
+    { 1, 0, 1231, 3, 0, 5 },
+    { 0, -1, 1234, 3, 0, 3 },
+    { 1, 0, 1237, 3, 0, 5 },
+    { 0, -1, 1240, 3, 0, 3 },
+    { 1, 0, 1243, 3, 0, 5 },
+    { 0, -1, 1246, 3, 0, 3 },
+    { 1, 0, 1249, 3, 0, 5 },
+    { 0, -1, 1252, 3, 0, 3 },
+    { 1, 0, 1255, 3, 0, 5 },
+    { 0, -1, 1258, 3, 0, 3 },
+    { 1, 0, 1261, 2, 0, 5 },
+    { 0, -1, 1263, 2, 0, 3 },
+    { 1, 0, 1265, 2, 0, 5 },
+    { 0, -1, 1267, 2, 0, 3 },
+    { 1, 0, 1269, 2, 0, 5 },
+    { 0, -1, 1271, 2, 0, 3 },
+    { 1, 0, 1273, 3, 0, 5 },
+    { 0, -1, 1276, 3, 0, 3 },
+    { 1, 0, 1279, 3, 0, 5 },
+    { 0, -1, 1282, 3, 0, 3 },
+    { 1, 0, 1285, 3, 0, 5 },
+    { 0, -1, 1288, 3, 0, 3 },
+    { 1, 0, 1291, 3, 0, 5 },
+    { 0, -1, 1294, 3, 0, 3 },
+    { 1, 0, 1297, 3, 0, 5 },
+    { 0, -1, 1300, 3, 0, 3 },
+    { 1, 0, 1303, 2, 0, 5 },
+    { 0, -1, 1305, 2, 0, 3 },
+    { 1, 0, 1307, 2, 0, 5 },
+    { 0, -1, 1309, 2, 0, 3 },
+    { 1, 0, 1311, 2, 0, 5 },
+    { 0, -1, 1313, 2, 0, 3 },
+    { 1, 0, 1315, 2, 0, 5 },
+    { 0, -1, 1317, 2, 0, 3 },
+    { 1, 0, 1319, 3, 0, 5 },
+    { 0, -1, 1322, 3, 0, 3 },
+    { 1, 0, 1325, 3, 0, 5 },
+    { 0, -1, 1328, 3, 0, 3 },
+    { 1, 0, 1331, 3, 0, 5 },
+    { 0, -1, 1334, 3, 0, 3 },
+    { 1, 0, 1337, 3, 0, 5 },
+    { 0, -1, 1340, 3, 0, 3 },
+    { 1, 0, 1343, 3, 0, 5 },
+    { 0, -1, 1346, 3, 0, 3 },
+    { 1, 0, 1349, 3, 0, 5 },
+    { 0, -1, 1352, 3, 0, 3 },
+    { 1, 0, 1355, 3, 0, 5 },
+    { 0, -1, 1358, 3, 0, 3 },
+    { 1, 0, 1361, 3, 0, 5 },
+    { 0, -1, 1364, 3, 0, 3 },
+    { 1, 0, 1367, 3, 0, 5 },
+    { 0, -1, 1370, 3, 0, 3 },
+    { 1, 0, 1373, 3, 0, 5 },
+    { 0, -1, 1376, 3, 0, 3 },
+    { 1, 0, 1379, 2, 0, 5 },
+    { 0, -1, 1381, 2, 0, 3 },
+    { 1, 0, 1383, 2, 0, 5 },
+    { 0, -1, 1385, 2, 0, 3 },
+    { 1, 0, 1387, 3, 0, 5 },
+    { 0, -1, 1390, 3, 0, 3 },
+    { 1, 0, 1393, 3, 0, 5 },
+    { 0, -1, 1396, 3, 0, 3 },
+    { 1, 0, 1399, 3, 0, 5 },
+    { 0, -1, 1402, 3, 0, 3 },
+    { 1, 0, 1405, 3, 0, 5 },
+    { 0, -1, 1408, 3, 0, 3 },
+    { 1, 0, 1411, 3, 0, 5 },
+    { 0, -1, 1414, 3, 0, 3 },
+    { 1, 0, 1417, 2, 0, 5 },
+    { 0, -1, 1419, 2, 0, 3 },
+    { 1, 0, 1421, 2, 0, 5 },
+    { 0, -1, 1423, 2, 0, 3 },
+    { 1, 0, 1425, 2, 0, 5 },
+    { 0, -1, 1427, 2, 0, 3 },
+    { 1, 0, 1429, 2, 0, 5 },
+    { 0, -1, 1431, 2, 0, 3 },
+    { 0, 8, 1433, 2, 0, 3 },
+    { 0, 8, 1435, 2, 0, 3 },
+    { 0, 8, 1437, 3, 0, 3 },
+    { 0, 8, 1440, 3, 0, 3 },
+    { 0, 8, 1443, 3, 0, 3 },
+    { 0, 8, 1446, 3, 0, 3 },
+    { 0, 8, 1449, 3, 0, 3 },
+    { 0, 8, 1452, 3, 0, 3 },
+    { -8, 0, 1455, 2, 0, 5 },
+    { -8, 0, 1457, 2, 0, 5 },
+    { -8, 0, 1459, 3, 0, 5 },
+    { -8, 0, 1462, 3, 0, 5 },
+    { -8, 0, 1465, 3, 0, 5 },
+    { -8, 0, 1468, 3, 0, 5 },
+    { -8, 0, 1471, 3, 0, 5 },
+    { -8, 0, 1474, 3, 0, 5 },
+    { 0, 8, 1477, 2, 0, 3 },
+    { 0, 8, 1479, 2, 0, 3 },
+    { 0, 8, 1481, 3, 0, 3 },
+    { 0, 8, 1484, 3, 0, 3 },
+    { 0, 8, 1487, 3, 0, 3 },
+    { 0, 8, 1490, 3, 0, 3 },
+    { -8, 0, 1493, 2, 0, 5 },
+    { -8, 0, 1495, 2, 0, 5 },
+    { -8, 0, 1497, 3, 0, 5 },
+    { -8, 0, 1500, 3, 0, 5 },
+    { -8, 0, 1503, 3, 0, 5 },
+    { -8, 0, 1506, 3, 0, 5 },
+    { 0, 8, 1509, 2, 0, 3 },
+    { 0, 8, 1511, 2, 0, 3 },
+    { 0, 8, 1513, 3, 0, 3 },
+    { 0, 8, 1516, 3, 0, 3 },
+    { 0, 8, 1519, 3, 0, 3 },
+    { 0, 8, 1522, 3, 0, 3 },
+    { 0, 8, 1525, 3, 0, 3 },
+    { 0, 8, 1528, 3, 0, 3 },
+    { -8, 0, 1531, 2, 0, 5 },
+    { -8, 0, 1533, 2, 0, 5 },
+    { -8, 0, 1535, 3, 0, 5 },
+    { -8, 0, 1538, 3, 0, 5 },
+    { -8, 0, 1541, 3, 0, 5 },
+    { -8, 0, 1544, 3, 0, 5 },
+    { -8, 0, 1547, 3, 0, 5 },
+    { -8, 0, 1550, 3, 0, 5 },
+    { 0, 8, 1553, 2, 0, 3 },
+    { 0, 8, 1555, 2, 0, 3 },
+    { 0, 8, 1557, 3, 0, 3 },
+    { 0, 8, 1560, 3, 0, 3 },
+    { 0, 8, 1563, 3, 0, 3 },
+    { 0, 8, 1566, 3, 0, 3 },
+    { 0, 8, 1569, 3, 0, 3 },
+    { 0, 8, 1572, 3, 0, 3 },
+    { -8, 0, 1575, 2, 0, 5 },
+    { -8, 0, 1577, 2, 0, 5 },
+    { -8, 0, 1579, 3, 0, 5 },
+    { -8, 0, 1582, 3, 0, 5 },
+    { -8, 0, 1585, 3, 0, 5 },
+    { -8, 0, 1588, 3, 0, 5 },
+    { -8, 0, 1591, 3, 0, 5 },
+    { -8, 0, 1594, 3, 0, 5 },
+    { 0, 8, 1597, 2, 0, 3 },
+    { 0, 8, 1599, 2, 0, 3 },
+    { 0, 8, 1601, 3, 0, 3 },
+    { 0, 8, 1604, 3, 0, 3 },
+    { 0, 8, 1607, 3, 0, 3 },
+    { 0, 8, 1610, 3, 0, 3 },
+    { -8, 0, 1613, 2, 0, 5 },
+    { -8, 0, 1615, 2, 0, 5 },
+    { -8, 0, 1617, 3, 0, 5 },
+    { -8, 0, 1620, 3, 0, 5 },
+    { -8, 0, 1623, 3, 0, 5 },
+    { -8, 0, 1626, 3, 0, 5 },
+    { 0, 0, 1629, 2, 0, 3 },
+    { 0, 8, 1631, 2, 0, 3 },
+    { 0, 0, 1633, 3, 0, 3 },
+    { 0, 8, 1636, 3, 0, 3 },
+    { 0, 0, 1639, 3, 0, 3 },
+    { 0, 8, 1642, 3, 0, 3 },
+    { 0, 0, 1645, 3, 0, 3 },
+    { 0, 8, 1648, 3, 0, 3 },
+    { -8, 0, 1651, 2, 0, 5 },
+    { -8, 0, 1653, 3, 0, 5 },
+    { -8, 0, 1656, 3, 0, 5 },
+    { -8, 0, 1659, 3, 0, 5 },
+    { 0, 8, 1662, 2, 0, 3 },
+    { 0, 8, 1664, 2, 0, 3 },
+    { 0, 8, 1666, 3, 0, 3 },
+    { 0, 8, 1669, 3, 0, 3 },
+    { 0, 8, 1672, 3, 0, 3 },
+    { 0, 8, 1675, 3, 0, 3 },
+    { 0, 8, 1678, 3, 0, 3 },
+    { 0, 8, 1681, 3, 0, 3 },
+    { -8, 0, 1684, 2, 0, 5 },
+    { -8, 0, 1686, 2, 0, 5 },
+    { -8, 0, 1688, 3, 0, 5 },
+    { -8, 0, 1691, 3, 0, 5 },
+    { -8, 0, 1694, 3, 0, 5 },
+    { -8, 0, 1697, 3, 0, 5 },
+    { -8, 0, 1700, 3, 0, 5 },
+    { -8, 0, 1703, 3, 0, 5 },
+    { 0, 74, 1706, 2, 0, 3 },
+    { 0, 74, 558, 2, 0, 0 },
+    { 0, 86, 1708, 2, 0, 3 },
+    { 0, 86, 560, 2, 0, 0 },
+    { 0, 86, 1710, 2, 0, 3 },
+    { 0, 86, 562, 2, 0, 0 },
+    { 0, 100, 1712, 2, 0, 3 },
+    { 0, 100, 564, 2, 0, 0 },
+    { 0, 128, 1714, 2, 0, 3 },
+    { 0, 128, 573, 2, 0, 0 },
+    { 0, 112, 1716, 2, 0, 3 },
+    { 0, 112, 575, 2, 0, 0 },
+    { 0, 126, 1718, 2, 0, 3 },
+    { 0, 126, 577, 2, 0, 0 },
+    { 0, 0, 1720, 3, 0, 1 },
+    { 0, 0, 1723, 3, 0, 1 },
+    { 0, 0, 1726, 4, 0, 1 },
+    { 0, 0, 1730, 4, 0, 1 },
+    { 0, 0, 1734, 4, 0, 1 },
+    { 0, 0, 1738, 4, 0, 1 },
+    { 0, 0, 1742, 4, 0, 1 },
+    { 0, 0, 1746, 4, 0, 1 },
+    { -8, 0, 1750, 3, 0, 1 },
+    { -8, 0, 1753, 3, 0, 1 },
+    { -8, 0, 1756, 4, 0, 1 },
+    { -8, 0, 1760, 4, 0, 1 },
+    { -8, 0, 1764, 4, 0, 1 },
+    { -8, 0, 1768, 4, 0, 1 },
+    { -8, 0, 1772, 4, 0, 1 },
+    { -8, 0, 1776, 4, 0, 1 },
+    { 0, 0, 1780, 3, 0, 1 },
+    { 0, 0, 1783, 3, 0, 1 },
+    { 0, 0, 1786, 4, 0, 1 },
+    { 0, 0, 1790, 4, 0, 1 },
+    { 0, 0, 1794, 4, 0, 1 },
+    { 0, 0, 1798, 4, 0, 1 },
+    { 0, 0, 1802, 4, 0, 1 },
+    { 0, 0, 1806, 4, 0, 1 },
+    { -8, 0, 1810, 3, 0, 1 },
+    { -8, 0, 1813, 3, 0, 1 },
+    { -8, 0, 1816, 4, 0, 1 },
+    { -8, 0, 1820, 4, 0, 1 },
+    { -8, 0, 1824, 4, 0, 1 },
+    { -8, 0, 1828, 4, 0, 1 },
+    { -8, 0, 1832, 4, 0, 1 },
+    { -8, 0, 1836, 4, 0, 1 },
+    { 0, 0, 1840, 3, 0, 1 },
+    { 0, 0, 1843, 3, 0, 1 },
+    { 0, 0, 1846, 4, 0, 1 },
+    { 0, 0, 1850, 4, 0, 1 },
+    { 0, 0, 1854, 4, 0, 1 },
+    { 0, 0, 1858, 4, 0, 1 },
+    { 0, 0, 1862, 4, 0, 1 },
+    { 0, 0, 1866, 4, 0, 1 },
+    { -8, 0, 1870, 3, 0, 1 },
+    { -8, 0, 1873, 3, 0, 1 },
+    { -8, 0, 1876, 4, 0, 1 },
+    { -8, 0, 1880, 4, 0, 1 },
+    { -8, 0, 1884, 4, 0, 1 },
+    { -8, 0, 1888, 4, 0, 1 },
+    { -8, 0, 1892, 4, 0, 1 },
+    { -8, 0, 1896, 4, 0, 1 },
+    { 0, 8, 1900, 2, 0, 3 },
+    { 0, 8, 1902, 2, 0, 3 },
+    { 0, 0, 1904, 3, 0, 1 },
+    { 0, 0, 1907, 2, 0, 1 },
+    { 0, 0, 1909, 3, 0, 1 },
+    { 0, 0, 1912, 2, 0, 3 },
+    { 0, 0, 1914, 3, 0, 1 },
+    { -8, 0, 1917, 2, 0, 5 },
+    { -8, 0, 1919, 2, 0, 5 },
+    { -74, 0, 1921, 2, 0, 5 },
+    { -74, 0, 536, 2, 0, 0 },
+    { -9, 0, 1923, 2, 0, 1 },
+    { -7173, -7205, 1925, 1, 0, 0 },
+    { 0, 0, 1926, 2, 0, 7 },
+    { 0, 0, 1928, 3, 0, 1 },
+    { 0, 0, 1931, 2, 0, 1 },
+    { 0, 0, 1933, 3, 0, 1 },
+    { 0, 0, 1936, 2, 0, 3 },
+    { 0, 0, 1938, 3, 0, 1 },
+    { -86, 0, 1941, 2, 0, 5 },
+    { -86, 0, 539, 2, 0, 0 },
+    { -86, 0, 1943, 2, 0, 5 },
+    { -86, 0, 541, 2, 0, 0 },
+    { -9, 0, 1945, 2, 0, 1 },
+    { 0, 0, 1947, 2, 0, 7 },
+    { 0, 0, 1949, 2, 0, 7 },
+    { 0, 0, 1951, 2, 0, 7 },
+    { 0, 8, 1953, 2, 0, 3 },
+    { 0, 8, 1955, 2, 0, 3 },
+    { 0, 0, 1957, 3, 0, 3 },
+    { 0, 0, 551, 3, 0, 0 },
+    { 0, 0, 1960, 2, 0, 3 },
+    { 0, 0, 1962, 3, 0, 3 },
+    { -8, 0, 1965, 2, 0, 5 },
+    { -8, 0, 1967, 2, 0, 5 },
+    { -100, 0, 1969, 2, 0, 5 },
+    { -100, 0, 543, 2, 0, 0 },
+    { 0, 0, 1971, 2, 0, 7 },
+    { 0, 0, 1973, 2, 0, 7 },
+    { 0, 0, 1975, 2, 0, 7 },
+    { 0, 8, 1977, 2, 0, 3 },
+    { 0, 8, 1979, 2, 0, 3 },
+    { 0, 0, 1981, 3, 0, 3 },
+    { 0, 0, 566, 3, 0, 0 },
+    { 0, 0, 1984, 2, 0, 3 },
+    { 0, 7, 1986, 2, 0, 3 },
+    { 0, 0, 1988, 2, 0, 3 },
+    { 0, 0, 1990, 3, 0, 3 },
+    { -8, 0, 1993, 2, 0, 5 },
+    { -8, 0, 1995, 2, 0, 5 },
+    { -112, 0, 1997, 2, 0, 5 },
+    { -112, 0, 547, 2, 0, 0 },
+    { -7, 0, 1999, 2, 0, 5 },
+    { 0, 0, 2001, 2, 0, 7 },
+    { 0, 0, 534, 2, 0, 0 },
+    { 0, 0, 2003, 1, 0, 0 },
+    { 0, 0, 2004, 3, 0, 1 },
+    { 0, 0, 2007, 2, 0, 1 },
+    { 0, 0, 2009, 3, 0, 1 },
+    { 0, 0, 2012, 2, 0, 3 },
+    { 0, 0, 2014, 3, 0, 1 },
+    { -128, 0, 2017, 2, 0, 5 },
+    { -128, 0, 545, 2, 0, 0 },
+    { -126, 0, 2019, 2, 0, 5 },
+    { -126, 0, 549, 2, 0, 0 },
+    { -9, 0, 2021, 2, 0, 1 },
+    { 0, 0, 2023, 1, 0, 0 },
+    { 0, 0, 2024, 1, 0, 0 },
+    { 0, 0, 2025, 1, 0, 0 },
+    { -7517, 0, 2026, 1, 0, 0 },
+    { -8383, 0, 2027, 1, 0, 0 },
+    { -8262, 0, 11, 2, 0, 0 },
+    { 28, 0, 0, 0, 0, 5 },
+    { 0, -28, 0, 0, 0, 3 },
+    { 16, 0, 0, 0, 0, 5 },
+    { 0, -16, 0, 0, 0, 3 },
+    { 0, 0, 2028, 2, 0, 7 },
+    { 0, 0, 2030, 2, 0, 7 },
+    { 0, 0, 2032, 2, 0, 7 },
+    { 0, 0, 2034, 2, 0, 7 },
+    { 0, 0, 2036, 2, 0, 7 },
+    { 0, 0, 2038, 2, 0, 7 },
+    { 0, 0, 2040, 2, 0, 7 },
+    { 0, 0, 2042, 2, 0, 7 },
+    { 0, 0, 2044, 2, 0, 7 },
+    { 0, 0, 2046, 2, 0, 7 },
+    { 0, 0, 2048, 2, 0, 7 },
+    { 0, 0, 2050, 2, 0, 7 },
+    { 0, 0, 2052, 2, 0, 7 },
+    { 0, 0, 2054, 2, 0, 7 },
+    { 0, 0, 2056, 2, 0, 7 },
+    { 0, 0, 2058, 2, 0, 7 },
+    { 0, 0, 2060, 2, 0, 7 },
+    { 0, 0, 2062, 2, 0, 7 },
+    { 0, 0, 2064, 2, 0, 7 },
+    { 0, 0, 2066, 2, 0, 7 },
+    { 0, 0, 2068, 2, 0, 7 },
+    { 0, 0, 2070, 2, 0, 7 },
+    { 0, 0, 2072, 2, 0, 7 },
+    { 0, 0, 2074, 2, 0, 7 },
+    { 0, 0, 2076, 2, 0, 7 },
+    { 0, 0, 2078, 2, 0, 7 },
+    { 0, 0, 2080, 2, 0, 7 },
+    { 0, 0, 2082, 2, 0, 7 },
+    { 0, 0, 2084, 2, 0, 7 },
+    { 0, 0, 2086, 2, 0, 7 },
+    { 0, 0, 2088, 2, 0, 7 },
+    { 0, 0, 2090, 2, 0, 7 },
+    { 0, 0, 2092, 2, 0, 7 },
+    { 0, 0, 2094, 2, 0, 7 },
+    { 0, 0, 2096, 2, 0, 7 },
+    { 0, 0, 2098, 2, 0, 7 },
+    { 0, 0, 2100, 2, 0, 7 },
+    { 0, 0, 2102, 2, 0, 7 },
+    { 0, 0, 2104, 2, 0, 7 },
+    { 0, 0, 2106, 2, 0, 7 },
+    { 0, 0, 2108, 2, 0, 7 },
+    { 0, 0, 2110, 2, 0, 7 },
+    { 0, 0, 2112, 2, 0, 7 },
+    { 0, 0, 2114, 2, 0, 7 },
+    { 0, 0, 2116, 1, 0, 0 },
+    { 0, 0, 2117, 1, 0, 0 },
+    { 26, 0, 0, 0, 0, 5 },
+    { 0, -26, 0, 0, 0, 3 },
+    { 0, 0, 2118, 2, 0, 0 },
+    { -10743, 0, 0, 0, 0, 5 },
+    { -3814, 0, 0, 0, 0, 5 },
+    { -10727, 0, 0, 0, 0, 5 },
+    { 0, -10795, 0, 0, 0, 3 },
+    { 0, -10792, 0, 0, 0, 3 },
+    { -10780, 0, 0, 0, 0, 5 },
+    { -10749, 0, 0, 0, 0, 5 },
+    { -10783, 0, 0, 0, 0, 5 },
+    { -10782, 0, 0, 0, 0, 5 },
+    { -10815, 0, 0, 0, 0, 5 },
+    { 0, -7264, 0, 0, 0, 3 },
+    { 0, 0, 0, 0, 224, 0 },
+    { 0, 0, 2120, 2, 0, 7 },
+    { 0, 0, 2122, 2, 0, 7 },
+    { 0, 0, 2124, 2, 0, 7 },
+    { 0, 0, 2126, 2, 0, 7 },
+    { 0, 0, 2128, 2, 0, 7 },
+    { 0, 0, 2130, 2, 0, 7 },
+    { 0, 0, 2132, 2, 0, 7 },
+    { 0, 0, 2134, 2, 0, 7 },
+    { 0, 0, 2136, 2, 0, 7 },
+    { 0, 0, 2138, 2, 0, 7 },
+    { 0, 0, 2140, 2, 0, 7 },
+    { 0, 0, 2142, 2, 0, 7 },
+    { 0, 0, 2144, 2, 0, 7 },
+    { 0, 0, 2146, 2, 0, 7 },
+    { 0, 0, 2148, 2, 0, 7 },
+    { 0, 0, 2150, 2, 0, 7 },
+    { 0, 0, 2152, 2, 0, 7 },
+    { 0, 0, 2154, 2, 0, 7 },
+    { 0, 0, 2156, 2, 0, 7 },
+    { 0, 0, 2158, 2, 0, 7 },
+    { 0, 0, 2160, 2, 0, 7 },
+    { 0, 0, 2162, 2, 0, 7 },
+    { 0, 0, 2164, 2, 0, 7 },
+    { 0, 0, 2166, 2, 0, 7 },
+    { 0, 0, 2168, 2, 0, 7 },
+    { 0, 0, 2170, 2, 0, 7 },
+    { 0, 0, 0, 0, 8, 0 },
+    { 0, 0, 2172, 2, 0, 7 },
+    { 0, 0, 2174, 2, 0, 7 },
+    { 0, 0, 2176, 2, 0, 7 },
+    { 0, 0, 2178, 2, 0, 7 },
+    { 0, 0, 2180, 2, 0, 7 },
+    { 0, 0, 2182, 2, 0, 7 },
+    { 0, 0, 2184, 2, 0, 7 },
+    { 0, 0, 2186, 2, 0, 7 },
+    { 0, 0, 2188, 2, 0, 7 },
+    { 0, 0, 2190, 2, 0, 7 },
+    { 0, 0, 2192, 2, 0, 7 },
+    { 0, 0, 2194, 2, 0, 7 },
+    { 0, 0, 2196, 2, 0, 7 },
+    { 0, 0, 2198, 2, 0, 7 },
+    { 0, 0, 2200, 2, 0, 7 },
+    { 0, 0, 2202, 2, 0, 7 },
+    { 0, 0, 2204, 2, 0, 7 },
+    { 0, 0, 2206, 2, 0, 7 },
+    { 0, 0, 2208, 2, 0, 7 },
+    { 0, 0, 2210, 2, 0, 7 },
+    { 0, 0, 2212, 2, 0, 7 },
+    { 0, 0, 2214, 2, 0, 7 },
+    { 0, 0, 2216, 2, 0, 7 },
+    { 0, 0, 2218, 2, 0, 7 },
+    { 0, 0, 2220, 2, 0, 7 },
+    { 0, 0, 2222, 2, 0, 7 },
+    { 0, 0, 2224, 2, 0, 7 },
+    { 0, 0, 2226, 2, 0, 7 },
+    { 0, 0, 2228, 2, 0, 7 },
+    { 0, 0, 2230, 2, 0, 7 },
+    { 0, 0, 2232, 2, 0, 7 },
+    { 0, 0, 2234, 2, 0, 7 },
+    { -35332, 0, 0, 0, 0, 5 },
+    { -42280, 0, 0, 0, 0, 5 },
+    { 0, 48, 0, 0, 0, 3 },
+    { -42308, 0, 0, 0, 0, 5 },
+    { -42319, 0, 0, 0, 0, 5 },
+    { -42315, 0, 0, 0, 0, 5 },
+    { -42305, 0, 0, 0, 0, 5 },
+    { -42258, 0, 0, 0, 0, 5 },
+    { -42282, 0, 0, 0, 0, 5 },
+    { -42261, 0, 0, 0, 0, 5 },
+    { 928, 0, 0, 0, 0, 5 },
+    { -48, 0, 0, 0, 0, 5 },
+    { -42307, 0, 0, 0, 0, 5 },
+    { -35384, 0, 0, 0, 0, 5 },
+    { 0, -928, 0, 0, 0, 3 },
+    { -38864, -38864, 0, 0, 0, 1 },
+    { 0, 0, 2236, 1, 0, 0 },
+    { 0, 0, 2237, 1, 0, 0 },
+    { 0, 0, 2238, 1, 0, 0 },
+    { 0, 0, 2239, 1, 0, 0 },
+    { 0, 0, 2240, 1, 0, 0 },
+    { 0, 0, 2241, 1, 0, 0 },
+    { 0, 0, 2242, 1, 0, 0 },
+    { 0, 0, 2243, 1, 0, 0 },
+    { 0, 0, 2244, 1, 0, 0 },
+    { 0, 0, 2245, 1, 0, 0 },
+    { 0, 0, 2246, 1, 0, 0 },
+    { 0, 0, 2247, 1, 0, 0 },
+    { 0, 0, 2248, 1, 0, 0 },
+    { 0, 0, 2249, 1, 0, 0 },
+    { 0, 0, 2250, 1, 0, 0 },
+    { 0, 0, 2251, 1, 0, 0 },
+    { 0, 0, 2252, 1, 0, 0 },
+    { 0, 0, 2253, 1, 0, 0 },
+    { 0, 0, 2254, 1, 0, 0 },
+    { 0, 0, 2255, 1, 0, 0 },
+    { 0, 0, 2256, 1, 0, 0 },
+    { 0, 0, 2257, 1, 0, 0 },
+    { 0, 0, 2258, 1, 0, 0 },
+    { 0, 0, 2259, 1, 0, 0 },
+    { 0, 0, 2260, 1, 0, 0 },
+    { 0, 0, 2261, 1, 0, 0 },
+    { 0, 0, 2262, 1, 0, 0 },
+    { 0, 0, 2263, 1, 0, 0 },
+    { 0, 0, 2264, 1, 0, 0 },
+    { 0, 0, 2265, 1, 0, 0 },
+    { 0, 0, 2266, 1, 0, 0 },
+    { 0, 0, 2267, 1, 0, 0 },
+    { 0, 0, 2268, 1, 0, 0 },
+    { 0, 0, 2269, 1, 0, 0 },
+    { 0, 0, 2270, 1, 0, 0 },
+    { 0, 0, 2271, 1, 0, 0 },
+    { 0, 0, 2272, 1, 0, 0 },
+    { 0, 0, 2273, 1, 0, 0 },
+    { 0, 0, 2274, 1, 0, 0 },
+    { 0, 0, 2275, 1, 0, 0 },
+    { 0, 0, 2276, 1, 0, 0 },
+    { 0, 0, 2277, 1, 0, 0 },
+    { 0, 0, 2278, 1, 0, 0 },
+    { 0, 0, 2279, 1, 0, 0 },
+    { 0, 0, 2280, 1, 0, 0 },
+    { 0, 0, 2281, 1, 0, 0 },
+    { 0, 0, 2282, 1, 0, 0 },
+    { 0, 0, 2283, 1, 0, 0 },
+    { 0, 0, 2284, 1, 0, 0 },
+    { 0, 0, 2285, 1, 0, 0 },
+    { 0, 0, 2286, 1, 0, 0 },
+    { 0, 0, 2287, 1, 0, 0 },
+    { 0, 0, 2288, 1, 0, 0 },
+    { 0, 0, 2289, 1, 0, 0 },
+    { 0, 0, 2290, 1, 0, 0 },
+    { 0, 0, 2291, 1, 0, 0 },
+    { 0, 0, 2292, 1, 0, 0 },
+    { 0, 0, 2293, 1, 0, 0 },
+    { 0, 0, 2294, 1, 0, 0 },
+    { 0, 0, 2295, 1, 0, 0 },
+    { 0, 0, 2296, 1, 0, 0 },
+    { 0, 0, 2297, 1, 0, 0 },
+    { 0, 0, 2298, 1, 0, 0 },
+    { 0, 0, 2299, 1, 0, 0 },
+    { 0, 0, 2300, 1, 0, 0 },
+    { 0, 0, 2301, 1, 0, 0 },
+    { 0, 0, 2302, 1, 0, 0 },
+    { 0, 0, 2303, 1, 0, 0 },
+    { 0, 0, 2304, 1, 0, 0 },
+    { 0, 0, 2305, 1, 0, 0 },
+    { 0, 0, 2306, 1, 0, 0 },
+    { 0, 0, 2307, 1, 0, 0 },
+    { 0, 0, 2308, 1, 0, 0 },
+    { 0, 0, 2309, 1, 0, 0 },
+    { 0, 0, 2310, 1, 0, 0 },
+    { 0, 0, 2311, 1, 0, 0 },
+    { 0, 0, 2312, 1, 0, 0 },
+    { 0, 0, 2313, 1, 0, 0 },
+    { 0, 0, 2314, 1, 0, 0 },
+    { 0, 0, 2315, 1, 0, 0 },
+    { 0, 0, 2316, 1, 0, 0 },
+    { 0, 0, 2317, 1, 0, 0 },
+    { 0, 0, 2318, 1, 0, 0 },
+    { 0, 0, 2319, 1, 0, 0 },
+    { 0, 0, 2320, 1, 0, 0 },
+    { 0, 0, 2321, 1, 0, 0 },
+    { 0, 0, 2322, 1, 0, 0 },
+    { 0, 0, 2323, 1, 0, 0 },
+    { 0, 0, 2324, 1, 0, 0 },
+    { 0, 0, 2325, 1, 0, 0 },
+    { 0, 0, 2326, 1, 0, 0 },
+    { 0, 0, 2327, 1, 0, 0 },
+    { 0, 0, 2328, 1, 0, 0 },
+    { 0, 0, 2329, 1, 0, 0 },
+    { 0, 0, 2330, 1, 0, 0 },
+    { 0, 0, 2331, 1, 0, 0 },
+    { 0, 0, 2332, 1, 0, 0 },
+    { 0, 0, 2333, 1, 0, 0 },
+    { 0, 0, 2334, 1, 0, 0 },
+    { 0, 0, 2335, 1, 0, 0 },
+    { 0, 0, 2336, 1, 0, 0 },
+    { 0, 0, 2337, 1, 0, 0 },
+    { 0, 0, 2338, 1, 0, 0 },
+    { 0, 0, 2339, 1, 0, 0 },
+    { 0, 0, 2340, 1, 0, 0 },
+    { 0, 0, 2341, 1, 0, 0 },
+    { 0, 0, 2342, 1, 0, 0 },
+    { 0, 0, 2343, 1, 0, 0 },
+    { 0, 0, 2344, 1, 0, 0 },
+    { 0, 0, 2345, 1, 0, 0 },
+    { 0, 0, 2346, 1, 0, 0 },
+    { 0, 0, 2347, 1, 0, 0 },
+    { 0, 0, 2348, 1, 0, 0 },
+    { 0, 0, 2349, 1, 0, 0 },
+    { 0, 0, 2350, 1, 0, 0 },
+    { 0, 0, 2351, 1, 0, 0 },
+    { 0, 0, 2352, 1, 0, 0 },
+    { 0, 0, 2353, 1, 0, 0 },
+    { 0, 0, 2354, 1, 0, 0 },
+    { 0, 0, 2355, 1, 0, 0 },
+    { 0, 0, 2356, 1, 0, 0 },
+    { 0, 0, 2357, 1, 0, 0 },
+    { 0, 0, 2358, 1, 0, 0 },
+    { 0, 0, 2359, 1, 0, 0 },
+    { 0, 0, 2360, 1, 0, 0 },
+    { 0, 0, 2361, 1, 0, 0 },
+    { 0, 0, 2362, 1, 0, 0 },
+    { 0, 0, 2363, 1, 0, 0 },
+    { 0, 0, 2364, 1, 0, 0 },
+    { 0, 0, 2365, 1, 0, 0 },
+    { 0, 0, 2366, 1, 0, 0 },
+    { 0, 0, 2367, 1, 0, 0 },
+    { 0, 0, 2368, 1, 0, 0 },
+    { 0, 0, 2369, 1, 0, 0 },
+    { 0, 0, 2370, 1, 0, 0 },
+    { 0, 0, 2371, 1, 0, 0 },
+    { 0, 0, 2372, 1, 0, 0 },
+    { 0, 0, 2373, 1, 0, 0 },
+    { 0, 0, 2374, 1, 0, 0 },
+    { 0, 0, 2375, 1, 0, 0 },
+    { 0, 0, 2376, 1, 0, 0 },
+    { 0, 0, 2377, 1, 0, 0 },
+    { 0, 0, 2378, 1, 0, 0 },
+    { 0, 0, 2379, 1, 0, 0 },
+    { 0, 0, 2380, 1, 0, 0 },
+    { 0, 0, 2381, 1, 0, 0 },
+    { 0, 0, 2382, 1, 0, 0 },
+    { 0, 0, 2383, 1, 0, 0 },
+    { 0, 0, 2384, 1, 0, 0 },
+    { 0, 0, 2385, 1, 0, 0 },
+    { 0, 0, 2386, 1, 0, 0 },
+    { 0, 0, 2387, 1, 0, 0 },
+    { 0, 0, 2388, 1, 0, 0 },
+    { 0, 0, 2389, 1, 0, 0 },
+    { 0, 0, 2390, 1, 0, 0 },
+    { 0, 0, 2391, 1, 0, 0 },
+    { 0, 0, 2392, 1, 0, 0 },
+    { 0, 0, 2393, 1, 0, 0 },
+    { 0, 0, 2394, 1, 0, 0 },
+    { 0, 0, 2395, 1, 0, 0 },
+    { 0, 0, 2396, 1, 0, 0 },
+    { 0, 0, 2397, 1, 0, 0 },
+    { 0, 0, 2398, 1, 0, 0 },
+    { 0, 0, 2399, 1, 0, 0 },
+    { 0, 0, 2400, 1, 0, 0 },
+    { 0, 0, 2401, 1, 0, 0 },
+    { 0, 0, 2402, 1, 0, 0 },
+    { 0, 0, 2403, 1, 0, 0 },
+    { 0, 0, 2404, 1, 0, 0 },
+    { 0, 0, 2405, 1, 0, 0 },
+    { 0, 0, 2406, 1, 0, 0 },
+    { 0, 0, 2407, 1, 0, 0 },
+    { 0, 0, 2408, 1, 0, 0 },
+    { 0, 0, 2409, 1, 0, 0 },
+    { 0, 0, 2410, 1, 0, 0 },
+    { 0, 0, 2411, 1, 0, 0 },
+    { 0, 0, 2412, 1, 0, 0 },
+    { 0, 0, 2413, 1, 0, 0 },
+    { 0, 0, 2414, 1, 0, 0 },
+    { 0, 0, 2415, 1, 0, 0 },
+    { 0, 0, 2416, 1, 0, 0 },
+    { 0, 0, 2417, 1, 0, 0 },
+    { 0, 0, 2418, 1, 0, 0 },
+    { 0, 0, 2419, 1, 0, 0 },
+    { 0, 0, 2420, 1, 0, 0 },
+    { 0, 0, 2421, 1, 0, 0 },
+    { 0, 0, 2422, 1, 0, 0 },
+    { 0, 0, 2423, 1, 0, 0 },
+    { 0, 0, 2424, 1, 0, 0 },
+    { 0, 0, 2425, 1, 0, 0 },
+    { 0, 0, 2426, 1, 0, 0 },
+    { 0, 0, 2427, 1, 0, 0 },
+    { 0, 0, 2428, 1, 0, 0 },
+    { 0, 0, 2429, 1, 0, 0 },
+    { 0, 0, 2430, 1, 0, 0 },
+    { 0, 0, 2431, 1, 0, 0 },
+    { 0, 0, 2432, 1, 0, 0 },
+    { 0, 0, 2433, 1, 0, 0 },
+    { 0, 0, 2434, 1, 0, 0 },
+    { 0, 0, 2435, 1, 0, 0 },
+    { 0, 0, 2436, 1, 0, 0 },
+    { 0, 0, 2437, 1, 0, 0 },
+    { 0, 0, 2438, 1, 0, 0 },
+    { 0, 0, 2439, 1, 0, 0 },
+    { 0, 0, 2440, 1, 0, 0 },
+    { 0, 0, 2441, 1, 0, 0 },
+    { 0, 0, 2442, 1, 0, 0 },
+    { 0, 0, 2443, 1, 0, 0 },
+    { 0, 0, 2444, 1, 0, 0 },
+    { 0, 0, 2445, 1, 0, 0 },
+    { 0, 0, 2446, 1, 0, 0 },
+    { 0, 0, 2447, 1, 0, 0 },
+    { 0, 0, 2448, 1, 0, 0 },
+    { 0, 0, 2449, 1, 0, 0 },
+    { 0, 0, 2450, 1, 0, 0 },
+    { 0, 0, 2451, 1, 0, 0 },
+    { 0, 0, 2452, 1, 0, 0 },
+    { 0, 0, 2453, 1, 0, 0 },
+    { 0, 0, 2454, 1, 0, 0 },
+    { 0, 0, 2455, 1, 0, 0 },
+    { 0, 0, 2456, 1, 0, 0 },
+    { 0, 0, 2457, 1, 0, 0 },
+    { 0, 0, 2458, 1, 0, 0 },
+    { 0, 0, 2459, 1, 0, 0 },
+    { 0, 0, 2460, 1, 0, 0 },
+    { 0, 0, 2461, 1, 0, 0 },
+    { 0, 0, 2462, 1, 0, 0 },
+    { 0, 0, 2463, 1, 0, 0 },
+    { 0, 0, 2464, 1, 0, 0 },
+    { 0, 0, 2465, 1, 0, 0 },
+    { 0, 0, 2466, 1, 0, 0 },
+    { 0, 0, 2467, 1, 0, 0 },
+    { 0, 0, 2468, 1, 0, 0 },
+    { 0, 0, 2469, 1, 0, 0 },
+    { 0, 0, 2470, 1, 0, 0 },
+    { 0, 0, 2471, 1, 0, 0 },
+    { 0, 0, 2472, 1, 0, 0 },
+    { 0, 0, 2473, 1, 0, 0 },
+    { 0, 0, 2474, 1, 0, 0 },
+    { 0, 0, 2475, 1, 0, 0 },
+    { 0, 0, 2476, 1, 0, 0 },
+    { 0, 0, 2477, 1, 0, 0 },
+    { 0, 0, 2478, 1, 0, 0 },
+    { 0, 0, 2479, 1, 0, 0 },
+    { 0, 0, 2480, 1, 0, 0 },
+    { 0, 0, 2481, 1, 0, 0 },
+    { 0, 0, 2482, 1, 0, 0 },
+    { 0, 0, 2483, 1, 0, 0 },
+    { 0, 0, 2484, 1, 0, 0 },
+    { 0, 0, 2485, 1, 0, 0 },
+    { 0, 0, 2486, 1, 0, 0 },
+    { 0, 0, 2487, 1, 0, 0 },
+    { 0, 0, 2488, 1, 0, 0 },
+    { 0, 0, 2489, 1, 0, 0 },
+    { 0, 0, 2490, 1, 0, 0 },
+    { 0, 0, 2491, 1, 0, 0 },
+    { 0, 0, 2492, 1, 0, 0 },
+    { 0, 0, 2493, 1, 0, 0 },
+    { 0, 0, 2494, 1, 0, 0 },
+    { 0, 0, 2495, 1, 0, 0 },
+    { 0, 0, 2496, 1, 0, 0 },
+    { 0, 0, 2497, 1, 0, 0 },
+    { 0, 0, 2498, 1, 0, 0 },
+    { 0, 0, 2499, 1, 0, 0 },
+    { 0, 0, 2500, 1, 0, 0 },
+    { 0, 0, 2501, 1, 0, 0 },
+    { 0, 0, 2502, 1, 0, 0 },
+    { 0, 0, 2503, 1, 0, 0 },
+    { 0, 0, 2504, 1, 0, 0 },
+    { 0, 0, 2505, 1, 0, 0 },
+    { 0, 0, 2506, 1, 0, 0 },
+    { 0, 0, 2507, 1, 0, 0 },
+    { 0, 0, 2508, 1, 0, 0 },
+    { 0, 0, 2509, 1, 0, 0 },
+    { 0, 0, 2510, 1, 0, 0 },
+    { 0, 0, 2511, 1, 0, 0 },
+    { 0, 0, 2512, 1, 0, 0 },
+    { 0, 0, 2513, 1, 0, 0 },
+    { 0, 0, 2514, 1, 0, 0 },
+    { 0, 0, 2515, 1, 0, 0 },
+    { 0, 0, 2516, 1, 0, 0 },
+    { 0, 0, 2517, 1, 0, 0 },
+    { 0, 0, 2518, 1, 0, 0 },
+    { 0, 0, 2519, 1, 0, 0 },
+    { 0, 0, 2520, 1, 0, 0 },
+    { 0, 0, 2521, 1, 0, 0 },
+    { 0, 0, 2522, 1, 0, 0 },
+    { 0, 0, 2523, 1, 0, 0 },
+    { 0, 0, 2524, 1, 0, 0 },
+    { 0, 0, 2525, 1, 0, 0 },
+    { 0, 0, 2526, 1, 0, 0 },
+    { 0, 0, 2527, 1, 0, 0 },
+    { 0, 0, 2528, 1, 0, 0 },
+    { 0, 0, 2529, 1, 0, 0 },
+    { 0, 0, 2530, 1, 0, 0 },
+    { 0, 0, 2531, 1, 0, 0 },
+    { 0, 0, 2532, 1, 0, 0 },
+    { 0, 0, 2533, 1, 0, 0 },
+    { 0, 0, 2534, 1, 0, 0 },
+    { 0, 0, 2535, 1, 0, 0 },
+    { 0, 0, 2536, 1, 0, 0 },
+    { 0, 0, 2537, 1, 0, 0 },
+    { 0, 0, 2538, 1, 0, 0 },
+    { 0, 0, 2539, 1, 0, 0 },
+    { 0, 0, 2540, 1, 0, 0 },
+    { 0, 0, 2541, 1, 0, 0 },
+    { 0, 0, 2542, 1, 0, 0 },
+    { 0, 0, 2543, 1, 0, 0 },
+    { 0, 0, 2544, 1, 0, 0 },
+    { 0, 0, 2545, 1, 0, 0 },
+    { 0, 0, 2546, 1, 0, 0 },
+    { 0, 0, 2547, 1, 0, 0 },
+    { 0, 0, 2548, 1, 0, 0 },
+    { 0, 0, 2549, 1, 0, 0 },
+    { 0, 0, 2550, 1, 0, 0 },
+    { 0, 0, 2551, 1, 0, 0 },
+    { 0, 0, 2552, 1, 0, 0 },
+    { 0, 0, 2553, 1, 0, 0 },
+    { 0, 0, 2554, 1, 0, 0 },
+    { 0, 0, 2555, 1, 0, 0 },
+    { 0, 0, 2556, 1, 0, 0 },
+    { 0, 0, 2557, 1, 0, 0 },
+    { 0, 0, 2558, 1, 0, 0 },
+    { 0, 0, 2559, 1, 0, 0 },
+    { 0, 0, 2560, 1, 0, 0 },
+    { 0, 0, 2561, 1, 0, 0 },
+    { 0, 0, 2562, 1, 0, 0 },
+    { 0, 0, 2563, 1, 0, 0 },
+    { 0, 0, 2564, 1, 0, 0 },
+    { 0, 0, 2565, 1, 0, 0 },
+    { 0, 0, 2566, 1, 0, 0 },
+    { 0, 0, 2567, 1, 0, 0 },
+    { 0, 0, 2568, 1, 0, 0 },
+    { 0, 0, 2569, 1, 0, 0 },
+    { 0, 0, 2570, 1, 0, 0 },
+    { 0, 0, 2571, 1, 0, 0 },
+    { 0, 0, 2572, 1, 0, 0 },
+    { 0, 0, 2573, 1, 0, 0 },
+    { 0, 0, 2574, 1, 0, 0 },
+    { 0, 0, 2575, 1, 0, 0 },
+    { 0, 0, 2576, 1, 0, 0 },
+    { 0, 0, 2577, 1, 0, 0 },
+    { 0, 0, 2578, 1, 0, 0 },
+    { 0, 0, 2579, 1, 0, 0 },
+    { 0, 0, 2580, 1, 0, 0 },
+    { 0, 0, 2581, 1, 0, 0 },
+    { 0, 0, 2582, 1, 0, 0 },
+    { 0, 0, 2583, 1, 0, 0 },
+    { 0, 0, 2584, 1, 0, 0 },
+    { 0, 0, 2585, 1, 0, 0 },
+    { 0, 0, 2586, 1, 0, 0 },
+    { 0, 0, 2587, 1, 0, 0 },
+    { 0, 0, 2588, 1, 0, 0 },
+    { 0, 0, 2589, 1, 0, 0 },
+    { 0, 0, 2590, 1, 0, 0 },
+    { 0, 0, 2591, 1, 0, 0 },
+    { 0, 0, 2592, 1, 0, 0 },
+    { 0, 0, 2593, 1, 0, 0 },
+    { 0, 0, 2594, 1, 0, 0 },
+    { 0, 0, 2595, 1, 0, 0 },
+    { 0, 0, 2596, 1, 0, 0 },
+    { 0, 0, 2597, 1, 0, 0 },
+    { 0, 0, 2598, 1, 0, 0 },
+    { 0, 0, 2599, 1, 0, 0 },
+    { 0, 0, 2600, 1, 0, 0 },
+    { 0, 0, 2601, 1, 0, 0 },
+    { 0, 0, 2602, 1, 0, 0 },
+    { 0, 0, 2603, 1, 0, 0 },
+    { 0, 0, 2604, 1, 0, 0 },
+    { 0, 0, 2605, 1, 0, 0 },
+    { 0, 0, 2606, 1, 0, 0 },
+    { 0, 0, 2607, 1, 0, 0 },
+    { 0, 0, 2608, 1, 0, 0 },
+    { 0, 0, 2609, 1, 0, 0 },
+    { 0, 0, 2610, 1, 0, 0 },
+    { 0, 0, 2611, 1, 0, 0 },
+    { 0, 0, 2612, 1, 0, 0 },
+    { 0, 0, 2613, 1, 0, 0 },
+    { 0, 0, 2614, 1, 0, 0 },
+    { 0, 0, 2615, 1, 0, 0 },
+    { 0, 0, 2616, 1, 0, 0 },
+    { 0, 0, 2617, 1, 0, 0 },
+    { 0, 0, 2618, 1, 0, 0 },
+    { 0, 0, 2619, 1, 0, 0 },
+    { 0, 0, 2620, 1, 0, 0 },
+    { 0, 0, 2621, 1, 0, 0 },
+    { 0, 0, 2622, 1, 0, 0 },
+    { 0, 0, 2623, 1, 0, 0 },
+    { 0, 0, 2624, 1, 0, 0 },
+    { 0, 0, 2625, 1, 0, 0 },
+    { 0, 0, 2626, 1, 0, 0 },
+    { 0, 0, 2627, 1, 0, 0 },
+    { 0, 0, 2628, 1, 0, 0 },
+    { 0, 0, 2629, 1, 0, 0 },
+    { 0, 0, 2630, 1, 0, 0 },
+    { 0, 0, 2631, 1, 0, 0 },
+    { 0, 0, 2632, 1, 0, 0 },
+    { 0, 0, 2633, 1, 0, 0 },
+    { 0, 0, 2634, 1, 0, 0 },
+    { 0, 0, 2635, 1, 0, 0 },
+    { 0, 0, 2636, 1, 0, 0 },
+    { 0, 0, 2637, 1, 0, 0 },
+    { 0, 0, 2638, 1, 0, 0 },
+    { 0, 0, 2639, 1, 0, 0 },
+    { 0, 0, 2640, 1, 0, 0 },
+    { 0, 0, 2641, 1, 0, 0 },
+    { 0, 0, 2642, 1, 0, 0 },
+    { 0, 0, 2643, 1, 0, 0 },
+    { 0, 0, 2644, 1, 0, 0 },
+    { 0, 0, 2645, 1, 0, 0 },
+    { 0, 0, 2646, 1, 0, 0 },
+    { 0, 0, 2647, 1, 0, 0 },
+    { 0, 0, 2648, 1, 0, 0 },
+    { 0, 0, 2649, 1, 0, 0 },
+    { 0, 0, 2650, 1, 0, 0 },
+    { 0, 0, 2651, 1, 0, 0 },
+    { 0, 0, 2652, 1, 0, 0 },
+    { 0, 0, 2653, 1, 0, 0 },
+    { 0, 0, 2654, 1, 0, 0 },
+    { 0, 0, 2655, 1, 0, 0 },
+    { 0, 0, 2656, 1, 0, 0 },
+    { 0, 0, 2657, 1, 0, 0 },
+    { 0, 0, 2658, 1, 0, 0 },
+    { 0, 0, 2659, 1, 0, 0 },
+    { 0, 0, 2660, 1, 0, 0 },
+    { 0, 0, 2661, 2, 0, 0 },
+    { 0, 0, 0, 0, 26, 0 },
+    { 0, 0, 2663, 2, 0, 0 },
+    { 0, 0, 2665, 2, 0, 0 },
+    { 0, 0, 2667, 2, 0, 0 },
+    { 0, 0, 2669, 3, 0, 0 },
+    { 0, 0, 2672, 3, 0, 0 },
+    { 0, 0, 2675, 2, 0, 0 },
+    { 0, 0, 2677, 2, 0, 0 },
+    { 0, 0, 2679, 2, 0, 0 },
+    { 0, 0, 2681, 2, 0, 0 },
+    { 0, 0, 2683, 2, 0, 0 },
+    { 0, 0, 2685, 2, 0, 0 },
+    { 0, 0, 2687, 2, 0, 0 },
+    { 0, 0, 2689, 2, 0, 0 },
+    { 0, 0, 2691, 2, 0, 0 },
+    { 0, 0, 2693, 2, 0, 0 },
+    { 0, 0, 2695, 2, 0, 0 },
+    { 0, 0, 2697, 2, 0, 0 },
+    { 0, 0, 2699, 2, 0, 0 },
+    { 0, 0, 2701, 2, 0, 0 },
+    { 0, 0, 2703, 2, 0, 0 },
+    { 0, 0, 2705, 2, 0, 0 },
+    { 0, 0, 2707, 2, 0, 0 },
+    { 0, 0, 2709, 2, 0, 0 },
+    { 0, 0, 2711, 2, 0, 0 },
+    { 0, 0, 2713, 2, 0, 0 },
+    { 0, 0, 2715, 2, 0, 0 },
+    { 0, 0, 2717, 2, 0, 0 },
+    { 0, 0, 2719, 2, 0, 0 },
+    { 0, 0, 2721, 2, 0, 0 },
+    { 0, 0, 2723, 2, 0, 0 },
+    { 0, 0, 2725, 2, 0, 0 },
+    { 0, 0, 2727, 2, 0, 0 },
+    { 0, 0, 2729, 2, 0, 0 },
+    { 40, 0, 0, 0, 0, 5 },
+    { 0, -40, 0, 0, 0, 3 },
+    { 39, 0, 0, 0, 0, 5 },
+    { 0, -39, 0, 0, 0, 3 },
+    { 64, 0, 0, 0, 0, 5 },
+    { 0, -64, 0, 0, 0, 3 },
+    { 0, 0, 2731, 2, 0, 7 },
+    { 0, 0, 2733, 2, 0, 7 },
+    { 0, 0, 2735, 2, 0, 7 },
+    { 0, 0, 2737, 2, 0, 7 },
+    { 0, 0, 2739, 2, 0, 7 },
+    { 0, 0, 2741, 2, 0, 7 },
+    { 0, 0, 2743, 2, 0, 7 },
+    { 0, 0, 2745, 2, 0, 7 },
+    { 0, 0, 2747, 2, 0, 7 },
+    { 0, 0, 2749, 2, 0, 7 },
+    { 0, 0, 2751, 2, 0, 7 },
+    { 0, 0, 2753, 2, 0, 7 },
+    { 0, 0, 2755, 2, 0, 7 },
+    { 0, 0, 0, 0, 6, 0 },
+    { 0, 0, 2757, 2, 0, 0 },
+    { 0, 0, 2759, 2, 0, 0 },
+    { 0, 0, 2761, 3, 0, 0 },
+    { 0, 0, 2764, 3, 0, 0 },
+    { 0, 0, 2767, 3, 0, 0 },
+    { 0, 0, 2770, 3, 0, 0 },
+    { 0, 0, 2773, 3, 0, 0 },
+    { 0, 0, 0, 0, 226, 0 },
+    { 0, 0, 2776, 2, 0, 0 },
+    { 0, 0, 2778, 2, 0, 0 },
+    { 0, 0, 2780, 3, 0, 0 },
+    { 0, 0, 2783, 3, 0, 0 },
+    { 0, 0, 2786, 3, 0, 0 },
+    { 0, 0, 2789, 3, 0, 0 },
+    { 34, 0, 0, 0, 0, 5 },
+    { 0, -34, 0, 0, 0, 3 },
+    { 0, 0, 2792, 1, 0, 0 },
+    { 0, 0, 2793, 1, 0, 0 },
+    { 0, 0, 2794, 1, 0, 0 },
+    { 0, 0, 2795, 1, 0, 0 },
+    { 0, 0, 2796, 1, 0, 0 },
+    { 0, 0, 2797, 1, 0, 0 },
+    { 0, 0, 2798, 1, 0, 0 },
+    { 0, 0, 2799, 1, 0, 0 },
+    { 0, 0, 2800, 1, 0, 0 },
+    { 0, 0, 2801, 1, 0, 0 },
+    { 0, 0, 2802, 1, 0, 0 },
+    { 0, 0, 2803, 1, 0, 0 },
+    { 0, 0, 2804, 1, 0, 0 },
+    { 0, 0, 2805, 1, 0, 0 },
+    { 0, 0, 2806, 1, 0, 0 },
+    { 0, 0, 2807, 1, 0, 0 },
+    { 0, 0, 2808, 1, 0, 0 },
+    { 0, 0, 2809, 1, 0, 0 },
+    { 0, 0, 2810, 1, 0, 0 },
+    { 0, 0, 2811, 1, 0, 0 },
+    { 0, 0, 2812, 1, 0, 0 },
+    { 0, 0, 2813, 1, 0, 0 },
+    { 0, 0, 2814, 1, 0, 0 },
+    { 0, 0, 2815, 1, 0, 0 },
+    { 0, 0, 2816, 1, 0, 0 },
+    { 0, 0, 2817, 1, 0, 0 },
+    { 0, 0, 2818, 1, 0, 0 },
+    { 0, 0, 2819, 1, 0, 0 },
+    { 0, 0, 2820, 1, 0, 0 },
+    { 0, 0, 2821, 1, 0, 0 },
+    { 0, 0, 2822, 1, 0, 0 },
+    { 0, 0, 2823, 1, 0, 0 },
+    { 0, 0, 2824, 1, 0, 0 },
+    { 0, 0, 2825, 1, 0, 0 },
+    { 0, 0, 2826, 1, 0, 0 },
+    { 0, 0, 2827, 1, 0, 0 },
+    { 0, 0, 2828, 1, 0, 0 },
+    { 0, 0, 2829, 1, 0, 0 },
+    { 0, 0, 2830, 1, 0, 0 },
+    { 0, 0, 2831, 1, 0, 0 },
+    { 0, 0, 2832, 1, 0, 0 },
+    { 0, 0, 2833, 1, 0, 0 },
+    { 0, 0, 2834, 1, 0, 0 },
+    { 0, 0, 2835, 1, 0, 0 },
+    { 0, 0, 2836, 1, 0, 0 },
+    { 0, 0, 2837, 1, 0, 0 },
+    { 0, 0, 2838, 1, 0, 0 },
+    { 0, 0, 2839, 1, 0, 0 },
+    { 0, 0, 2840, 1, 0, 0 },
+    { 0, 0, 2841, 1, 0, 0 },
+    { 0, 0, 2842, 1, 0, 0 },
+    { 0, 0, 2843, 1, 0, 0 },
+    { 0, 0, 2844, 1, 0, 0 },
+    { 0, 0, 2845, 1, 0, 0 },
+    { 0, 0, 2846, 1, 0, 0 },
+    { 0, 0, 2847, 1, 0, 0 },
+    { 0, 0, 2848, 1, 0, 0 },
+    { 0, 0, 2849, 1, 0, 0 },
+    { 0, 0, 2850, 1, 0, 0 },
+    { 0, 0, 2851, 1, 0, 0 },
+    { 0, 0, 2852, 1, 0, 0 },
+    { 0, 0, 2853, 1, 0, 0 },
+    { 0, 0, 2854, 1, 0, 0 },
+    { 0, 0, 2855, 1, 0, 0 },
+    { 0, 0, 2856, 1, 0, 0 },
+    { 0, 0, 2857, 1, 0, 0 },
+    { 0, 0, 2858, 1, 0, 0 },
+    { 0, 0, 2859, 1, 0, 0 },
+    { 0, 0, 2860, 1, 0, 0 },
+    { 0, 0, 2861, 1, 0, 0 },
+    { 0, 0, 2862, 1, 0, 0 },
+    { 0, 0, 2863, 1, 0, 0 },
+    { 0, 0, 2864, 1, 0, 0 },
+    { 0, 0, 2865, 1, 0, 0 },
+    { 0, 0, 2866, 1, 0, 0 },
+    { 0, 0, 2867, 1, 0, 0 },
+    { 0, 0, 2868, 1, 0, 0 },
+    { 0, 0, 2869, 1, 0, 0 },
+    { 0, 0, 2870, 1, 0, 0 },
+    { 0, 0, 2871, 1, 0, 0 },
+    { 0, 0, 2872, 1, 0, 0 },
+    { 0, 0, 2873, 1, 0, 0 },
+    { 0, 0, 2874, 1, 0, 0 },
+    { 0, 0, 2875, 1, 0, 0 },
+    { 0, 0, 2876, 1, 0, 0 },
+    { 0, 0, 2877, 1, 0, 0 },
+    { 0, 0, 2878, 1, 0, 0 },
+    { 0, 0, 2879, 1, 0, 0 },
+    { 0, 0, 2880, 1, 0, 0 },
+    { 0, 0, 2881, 1, 0, 0 },
+    { 0, 0, 2882, 1, 0, 0 },
+    { 0, 0, 2883, 1, 0, 0 },
+    { 0, 0, 2884, 1, 0, 0 },
+    { 0, 0, 2885, 1, 0, 0 },
+    { 0, 0, 2886, 1, 0, 0 },
+    { 0, 0, 2887, 1, 0, 0 },
+    { 0, 0, 2888, 1, 0, 0 },
+    { 0, 0, 2889, 1, 0, 0 },
+    { 0, 0, 2890, 1, 0, 0 },
+    { 0, 0, 2891, 1, 0, 0 },
+    { 0, 0, 2892, 1, 0, 0 },
+    { 0, 0, 2893, 1, 0, 0 },
+    { 0, 0, 2894, 1, 0, 0 },
+    { 0, 0, 2895, 1, 0, 0 },
+    { 0, 0, 2896, 1, 0, 0 },
+    { 0, 0, 2897, 1, 0, 0 },
+    { 0, 0, 2898, 1, 0, 0 },
+    { 0, 0, 2899, 1, 0, 0 },
+    { 0, 0, 2900, 1, 0, 0 },
+    { 0, 0, 2901, 1, 0, 0 },
+    { 0, 0, 2902, 1, 0, 0 },
+    { 0, 0, 2903, 1, 0, 0 },
+    { 0, 0, 2904, 1, 0, 0 },
+    { 0, 0, 2905, 1, 0, 0 },
+    { 0, 0, 2906, 1, 0, 0 },
+    { 0, 0, 2907, 1, 0, 0 },
+    { 0, 0, 2908, 1, 0, 0 },
+    { 0, 0, 2909, 1, 0, 0 },
+    { 0, 0, 2910, 1, 0, 0 },
+    { 0, 0, 2911, 1, 0, 0 },
+    { 0, 0, 2912, 1, 0, 0 },
+    { 0, 0, 2913, 1, 0, 0 },
+    { 0, 0, 2914, 1, 0, 0 },
+    { 0, 0, 2915, 1, 0, 0 },
+    { 0, 0, 2916, 1, 0, 0 },
+    { 0, 0, 2917, 1, 0, 0 },
+    { 0, 0, 2918, 1, 0, 0 },
+    { 0, 0, 2919, 1, 0, 0 },
+    { 0, 0, 2920, 1, 0, 0 },
+    { 0, 0, 2921, 1, 0, 0 },
+    { 0, 0, 2922, 1, 0, 0 },
+    { 0, 0, 2923, 1, 0, 0 },
+    { 0, 0, 2924, 1, 0, 0 },
+    { 0, 0, 2925, 1, 0, 0 },
+    { 0, 0, 2926, 1, 0, 0 },
+    { 0, 0, 2927, 1, 0, 0 },
+    { 0, 0, 2928, 1, 0, 0 },
+    { 0, 0, 2929, 1, 0, 0 },
+    { 0, 0, 2930, 1, 0, 0 },
+    { 0, 0, 2931, 1, 0, 0 },
+    { 0, 0, 2932, 1, 0, 0 },
+    { 0, 0, 2933, 1, 0, 0 },
+    { 0, 0, 2934, 1, 0, 0 },
+    { 0, 0, 2935, 1, 0, 0 },
+    { 0, 0, 2936, 1, 0, 0 },
+    { 0, 0, 2937, 1, 0, 0 },
+    { 0, 0, 2938, 1, 0, 0 },
+    { 0, 0, 2939, 1, 0, 0 },
+    { 0, 0, 2940, 1, 0, 0 },
+    { 0, 0, 2941, 1, 0, 0 },
+    { 0, 0, 2942, 1, 0, 0 },
+    { 0, 0, 2943, 1, 0, 0 },
+    { 0, 0, 2944, 1, 0, 0 },
+    { 0, 0, 2945, 1, 0, 0 },
+    { 0, 0, 2946, 1, 0, 0 },
+    { 0, 0, 2947, 1, 0, 0 },
+    { 0, 0, 2948, 1, 0, 0 },
+    { 0, 0, 2949, 1, 0, 0 },
+    { 0, 0, 2950, 1, 0, 0 },
+    { 0, 0, 2951, 1, 0, 0 },
+    { 0, 0, 2952, 1, 0, 0 },
+    { 0, 0, 2953, 1, 0, 0 },
+    { 0, 0, 2954, 1, 0, 0 },
+    { 0, 0, 2955, 1, 0, 0 },
+    { 0, 0, 2956, 1, 0, 0 },
+    { 0, 0, 2957, 1, 0, 0 },
+    { 0, 0, 2958, 1, 0, 0 },
+    { 0, 0, 2959, 1, 0, 0 },
+    { 0, 0, 2960, 1, 0, 0 },
+    { 0, 0, 2961, 1, 0, 0 },
+    { 0, 0, 2962, 1, 0, 0 },
+    { 0, 0, 2963, 1, 0, 0 },
+    { 0, 0, 2964, 1, 0, 0 },
+    { 0, 0, 2965, 1, 0, 0 },
+    { 0, 0, 2966, 1, 0, 0 },
+    { 0, 0, 2967, 1, 0, 0 },
+    { 0, 0, 2968, 1, 0, 0 },
+    { 0, 0, 2969, 1, 0, 0 },
+    { 0, 0, 2970, 1, 0, 0 },
+    { 0, 0, 2971, 1, 0, 0 },
+    { 0, 0, 2972, 1, 0, 0 },
+    { 0, 0, 2973, 1, 0, 0 },
+    { 0, 0, 2974, 1, 0, 0 },
+    { 0, 0, 2975, 1, 0, 0 },
+    { 0, 0, 2976, 1, 0, 0 },
+    { 0, 0, 2977, 1, 0, 0 },
+    { 0, 0, 2978, 1, 0, 0 },
+    { 0, 0, 2979, 1, 0, 0 },
+    { 0, 0, 2980, 1, 0, 0 },
+    { 0, 0, 2981, 1, 0, 0 },
+    { 0, 0, 2982, 1, 0, 0 },
+    { 0, 0, 2983, 1, 0, 0 },
+    { 0, 0, 2984, 1, 0, 0 },
+    { 0, 0, 2985, 1, 0, 0 },
+    { 0, 0, 2986, 1, 0, 0 },
+    { 0, 0, 2987, 1, 0, 0 },
+    { 0, 0, 2988, 1, 0, 0 },
+    { 0, 0, 2989, 1, 0, 0 },
+    { 0, 0, 2990, 1, 0, 0 },
+    { 0, 0, 2991, 1, 0, 0 },
+    { 0, 0, 2992, 1, 0, 0 },
+    { 0, 0, 2993, 1, 0, 0 },
+    { 0, 0, 2994, 1, 0, 0 },
+    { 0, 0, 2995, 1, 0, 0 },
+    { 0, 0, 2996, 1, 0, 0 },
+    { 0, 0, 2997, 1, 0, 0 },
+    { 0, 0, 2998, 1, 0, 0 },
+    { 0, 0, 2999, 1, 0, 0 },
+    { 0, 0, 3000, 1, 0, 0 },
+    { 0, 0, 3001, 1, 0, 0 },
+    { 0, 0, 3002, 1, 0, 0 },
+    { 0, 0, 3003, 1, 0, 0 },
+    { 0, 0, 3004, 1, 0, 0 },
+    { 0, 0, 3005, 1, 0, 0 },
+    { 0, 0, 3006, 1, 0, 0 },
+    { 0, 0, 3007, 1, 0, 0 },
+    { 0, 0, 3008, 1, 0, 0 },
+    { 0, 0, 3009, 1, 0, 0 },
+    { 0, 0, 3010, 1, 0, 0 },
+    { 0, 0, 3011, 1, 0, 0 },
+    { 0, 0, 3012, 1, 0, 0 },
+    { 0, 0, 3013, 1, 0, 0 },
+    { 0, 0, 3014, 1, 0, 0 },
+    { 0, 0, 3015, 1, 0, 0 },
+    { 0, 0, 3016, 1, 0, 0 },
+    { 0, 0, 3017, 1, 0, 0 },
+    { 0, 0, 3018, 1, 0, 0 },
+    { 0, 0, 3019, 1, 0, 0 },
+    { 0, 0, 3020, 1, 0, 0 },
+    { 0, 0, 3021, 1, 0, 0 },
+    { 0, 0, 3022, 1, 0, 0 },
+    { 0, 0, 3023, 1, 0, 0 },
+    { 0, 0, 3024, 1, 0, 0 },
+    { 0, 0, 3025, 1, 0, 0 },
+    { 0, 0, 3026, 1, 0, 0 },
+    { 0, 0, 3027, 1, 0, 0 },
+    { 0, 0, 3028, 1, 0, 0 },
+    { 0, 0, 3029, 1, 0, 0 },
+    { 0, 0, 3030, 1, 0, 0 },
+    { 0, 0, 3031, 1, 0, 0 },
+    { 0, 0, 3032, 1, 0, 0 },
+    { 0, 0, 3033, 1, 0, 0 },
+    { 0, 0, 3034, 1, 0, 0 },
+    { 0, 0, 3035, 1, 0, 0 },
+    { 0, 0, 3036, 1, 0, 0 },
+    { 0, 0, 3037, 1, 0, 0 },
+    { 0, 0, 3038, 1, 0, 0 },
+    { 0, 0, 3039, 1, 0, 0 },
+    { 0, 0, 3040, 1, 0, 0 },
+    { 0, 0, 3041, 1, 0, 0 },
+    { 0, 0, 3042, 1, 0, 0 },
+    { 0, 0, 3043, 1, 0, 0 },
+    { 0, 0, 3044, 1, 0, 0 },
+    { 0, 0, 3045, 1, 0, 0 },
+    { 0, 0, 3046, 1, 0, 0 },
+    { 0, 0, 3047, 1, 0, 0 },
+    { 0, 0, 3048, 1, 0, 0 },
+    { 0, 0, 3049, 1, 0, 0 },
+    { 0, 0, 3050, 1, 0, 0 },
+    { 0, 0, 3051, 1, 0, 0 },
+    { 0, 0, 3052, 1, 0, 0 },
+    { 0, 0, 3053, 1, 0, 0 },
+    { 0, 0, 3054, 1, 0, 0 },
+    { 0, 0, 3055, 1, 0, 0 },
+    { 0, 0, 3056, 1, 0, 0 },
+    { 0, 0, 3057, 1, 0, 0 },
+    { 0, 0, 3058, 1, 0, 0 },
+    { 0, 0, 3059, 1, 0, 0 },
+    { 0, 0, 3060, 1, 0, 0 },
+    { 0, 0, 3061, 1, 0, 0 },
+    { 0, 0, 3062, 1, 0, 0 },
+    { 0, 0, 3063, 1, 0, 0 },
+    { 0, 0, 3064, 1, 0, 0 },
+    { 0, 0, 3065, 1, 0, 0 },
+    { 0, 0, 3066, 1, 0, 0 },
+    { 0, 0, 3067, 1, 0, 0 },
+    { 0, 0, 3068, 1, 0, 0 },
+    { 0, 0, 3069, 1, 0, 0 },
+    { 0, 0, 3070, 1, 0, 0 },
+    { 0, 0, 3071, 1, 0, 0 },
+    { 0, 0, 3072, 1, 0, 0 },
+    { 0, 0, 3073, 1, 0, 0 },
+    { 0, 0, 3074, 1, 0, 0 },
+    { 0, 0, 3075, 1, 0, 0 },
+    { 0, 0, 3076, 1, 0, 0 },
+    { 0, 0, 3077, 1, 0, 0 },
+    { 0, 0, 3078, 1, 0, 0 },
+    { 0, 0, 3079, 1, 0, 0 },
+    { 0, 0, 3080, 1, 0, 0 },
+    { 0, 0, 3081, 1, 0, 0 },
+    { 0, 0, 3082, 1, 0, 0 },
+    { 0, 0, 3083, 1, 0, 0 },
+    { 0, 0, 3084, 1, 0, 0 },
+    { 0, 0, 3085, 1, 0, 0 },
+    { 0, 0, 3086, 1, 0, 0 },
+    { 0, 0, 3087, 1, 0, 0 },
+    { 0, 0, 3088, 1, 0, 0 },
+    { 0, 0, 3089, 1, 0, 0 },
+    { 0, 0, 3090, 1, 0, 0 },
+    { 0, 0, 3091, 1, 0, 0 },
+    { 0, 0, 3092, 1, 0, 0 },
+    { 0, 0, 3093, 1, 0, 0 },
+    { 0, 0, 3094, 1, 0, 0 },
+    { 0, 0, 3095, 1, 0, 0 },
+    { 0, 0, 3096, 1, 0, 0 },
+    { 0, 0, 3097, 1, 0, 0 },
+    { 0, 0, 3098, 1, 0, 0 },
+    { 0, 0, 3099, 1, 0, 0 },
+    { 0, 0, 3100, 1, 0, 0 },
+    { 0, 0, 3101, 1, 0, 0 },
+    { 0, 0, 3102, 1, 0, 0 },
+    { 0, 0, 3103, 1, 0, 0 },
+    { 0, 0, 3104, 1, 0, 0 },
+    { 0, 0, 3105, 1, 0, 0 },
+    { 0, 0, 3106, 1, 0, 0 },
+    { 0, 0, 3107, 1, 0, 0 },
+    { 0, 0, 3108, 1, 0, 0 },
+    { 0, 0, 3109, 1, 0, 0 },
+    { 0, 0, 3110, 1, 0, 0 },
+    { 0, 0, 3111, 1, 0, 0 },
+    { 0, 0, 3112, 1, 0, 0 },
+    { 0, 0, 3113, 1, 0, 0 },
+    { 0, 0, 3114, 1, 0, 0 },
+    { 0, 0, 3115, 1, 0, 0 },
+    { 0, 0, 3116, 1, 0, 0 },
+    { 0, 0, 3117, 1, 0, 0 },
+    { 0, 0, 3118, 1, 0, 0 },
+    { 0, 0, 3119, 1, 0, 0 },
+    { 0, 0, 3120, 1, 0, 0 },
+    { 0, 0, 3121, 1, 0, 0 },
+    { 0, 0, 3122, 1, 0, 0 },
+    { 0, 0, 3123, 1, 0, 0 },
+    { 0, 0, 3124, 1, 0, 0 },
+    { 0, 0, 3125, 1, 0, 0 },
+    { 0, 0, 3126, 1, 0, 0 },
+    { 0, 0, 3127, 1, 0, 0 },
+    { 0, 0, 3128, 1, 0, 0 },
+    { 0, 0, 3129, 1, 0, 0 },
+    { 0, 0, 3130, 1, 0, 0 },
+    { 0, 0, 3131, 1, 0, 0 },
+    { 0, 0, 3132, 1, 0, 0 },
+    { 0, 0, 3133, 1, 0, 0 },
+    { 0, 0, 3134, 1, 0, 0 },
+    { 0, 0, 3135, 1, 0, 0 },
+    { 0, 0, 3136, 1, 0, 0 },
+    { 0, 0, 3137, 1, 0, 0 },
+    { 0, 0, 3138, 1, 0, 0 },
+    { 0, 0, 3139, 1, 0, 0 },
+    { 0, 0, 3140, 1, 0, 0 },
+    { 0, 0, 3141, 1, 0, 0 },
+    { 0, 0, 3142, 1, 0, 0 },
+    { 0, 0, 3143, 1, 0, 0 },
+    { 0, 0, 3144, 1, 0, 0 },
+    { 0, 0, 3145, 1, 0, 0 },
+    { 0, 0, 3146, 1, 0, 0 },
+    { 0, 0, 3147, 1, 0, 0 },
+    { 0, 0, 3148, 1, 0, 0 },
+    { 0, 0, 3149, 1, 0, 0 },
+    { 0, 0, 3150, 1, 0, 0 },
+    { 0, 0, 3151, 1, 0, 0 },
+    { 0, 0, 3152, 1, 0, 0 },
+    { 0, 0, 3153, 1, 0, 0 },
+    { 0, 0, 3154, 1, 0, 0 },
+    { 0, 0, 3155, 1, 0, 0 },
+    { 0, 0, 3156, 1, 0, 0 },
+    { 0, 0, 3157, 1, 0, 0 },
+    { 0, 0, 3158, 1, 0, 0 },
+    { 0, 0, 3159, 1, 0, 0 },
+    { 0, 0, 3160, 1, 0, 0 },
+    { 0, 0, 3161, 1, 0, 0 },
+    { 0, 0, 3162, 1, 0, 0 },
+    { 0, 0, 3163, 1, 0, 0 },
+    { 0, 0, 3164, 1, 0, 0 },
+    { 0, 0, 3165, 1, 0, 0 },
+    { 0, 0, 3166, 1, 0, 0 },
+    { 0, 0, 3167, 1, 0, 0 },
+    { 0, 0, 3168, 1, 0, 0 },
+    { 0, 0, 3169, 1, 0, 0 },
+    { 0, 0, 3170, 1, 0, 0 },
+    { 0, 0, 3171, 1, 0, 0 },
+    { 0, 0, 3172, 1, 0, 0 },
+    { 0, 0, 3173, 1, 0, 0 },
+    { 0, 0, 3174, 1, 0, 0 },
+    { 0, 0, 3175, 1, 0, 0 },
+    { 0, 0, 3176, 1, 0, 0 },
+    { 0, 0, 3177, 1, 0, 0 },
+    { 0, 0, 3178, 1, 0, 0 },
+    { 0, 0, 3179, 1, 0, 0 },
+    { 0, 0, 3180, 1, 0, 0 },
+    { 0, 0, 3181, 1, 0, 0 },
+    { 0, 0, 3182, 1, 0, 0 },
+    { 0, 0, 3183, 1, 0, 0 },
+    { 0, 0, 3184, 1, 0, 0 },
+    { 0, 0, 3185, 1, 0, 0 },
+    { 0, 0, 3186, 1, 0, 0 },
+    { 0, 0, 3187, 1, 0, 0 },
+    { 0, 0, 3188, 1, 0, 0 },
+    { 0, 0, 3189, 1, 0, 0 },
+    { 0, 0, 3190, 1, 0, 0 },
+    { 0, 0, 3191, 1, 0, 0 },
+    { 0, 0, 3192, 1, 0, 0 },
+    { 0, 0, 3193, 1, 0, 0 },
+    { 0, 0, 3194, 1, 0, 0 },
+    { 0, 0, 3195, 1, 0, 0 },
+    { 0, 0, 3196, 1, 0, 0 },
+    { 0, 0, 3197, 1, 0, 0 },
+    { 0, 0, 3198, 1, 0, 0 },
+    { 0, 0, 3199, 1, 0, 0 },
+    { 0, 0, 3200, 1, 0, 0 },
+    { 0, 0, 3201, 1, 0, 0 },
+    { 0, 0, 3202, 1, 0, 0 },
+    { 0, 0, 3203, 1, 0, 0 },
+    { 0, 0, 3204, 1, 0, 0 },
+    { 0, 0, 3205, 1, 0, 0 },
+    { 0, 0, 3206, 1, 0, 0 },
+    { 0, 0, 3207, 1, 0, 0 },
+    { 0, 0, 3208, 1, 0, 0 },
+    { 0, 0, 3209, 1, 0, 0 },
+    { 0, 0, 3210, 1, 0, 0 },
+    { 0, 0, 3211, 1, 0, 0 },
+    { 0, 0, 3212, 1, 0, 0 },
+    { 0, 0, 3213, 1, 0, 0 },
+    { 0, 0, 3214, 1, 0, 0 },
+    { 0, 0, 3215, 1, 0, 0 },
+    { 0, 0, 3216, 1, 0, 0 },
+    { 0, 0, 3217, 1, 0, 0 },
+    { 0, 0, 3218, 1, 0, 0 },
+    { 0, 0, 3219, 1, 0, 0 },
+    { 0, 0, 3220, 1, 0, 0 },
+    { 0, 0, 3221, 1, 0, 0 },
+    { 0, 0, 3222, 1, 0, 0 },
+    { 0, 0, 3223, 1, 0, 0 },
+    { 0, 0, 3224, 1, 0, 0 },
+    { 0, 0, 3225, 1, 0, 0 },
+    { 0, 0, 3226, 1, 0, 0 },
+    { 0, 0, 3227, 1, 0, 0 },
+    { 0, 0, 3228, 1, 0, 0 },
+    { 0, 0, 3229, 1, 0, 0 },
+    { 0, 0, 3230, 1, 0, 0 },
+    { 0, 0, 3231, 1, 0, 0 },
+    { 0, 0, 3232, 1, 0, 0 },
+    { 0, 0, 3233, 1, 0, 0 },
+    { 0, 0, 3234, 1, 0, 0 },
+    { 0, 0, 3235, 1, 0, 0 },
+    { 0, 0, 3236, 1, 0, 0 },
+    { 0, 0, 3237, 1, 0, 0 },
+    { 0, 0, 3238, 1, 0, 0 },
+    { 0, 0, 3239, 1, 0, 0 },
+    { 0, 0, 3240, 1, 0, 0 },
+    { 0, 0, 3241, 1, 0, 0 },
+    { 0, 0, 3242, 1, 0, 0 },
+    { 0, 0, 3243, 1, 0, 0 },
+    { 0, 0, 3244, 1, 0, 0 },
+    { 0, 0, 3245, 1, 0, 0 },
+    { 0, 0, 3246, 1, 0, 0 },
+    { 0, 0, 3247, 1, 0, 0 },
+    { 0, 0, 3248, 1, 0, 0 },
+    { 0, 0, 3249, 1, 0, 0 },
+    { 0, 0, 3250, 1, 0, 0 },
+    { 0, 0, 3251, 1, 0, 0 },
+    { 0, 0, 3252, 1, 0, 0 },
+    { 0, 0, 3253, 1, 0, 0 },
+    { 0, 0, 3254, 1, 0, 0 },
+    { 0, 0, 3255, 1, 0, 0 },
+    { 0, 0, 3256, 1, 0, 0 },
+    { 0, 0, 3257, 1, 0, 0 },
+    { 0, 0, 3258, 1, 0, 0 },
+    { 0, 0, 3259, 1, 0, 0 },
+    { 0, 0, 3260, 1, 0, 0 },
+    { 0, 0, 3261, 1, 0, 0 },
+    { 0, 0, 3262, 1, 0, 0 },
+    { 0, 0, 3263, 1, 0, 0 },
+    { 0, 0, 3264, 1, 0, 0 },
+    { 0, 0, 3265, 1, 0, 0 },
+    { 0, 0, 3266, 1, 0, 0 },
+    { 0, 0, 3267, 1, 0, 0 },
+    { 0, 0, 3268, 1, 0, 0 },
+};
+
+
+static const u32 unicodeDecompositions[3269] =
+{
+          0,      65,     768,      65,     769,      65,     770,      65,
+        771,      65,     776,      65,     778,      67,     807,      69,
+        768,      69,     769,      69,     770,      69,     776,      73,
+        768,      73,     769,      73,     770,      73,     776,      78,
+        771,      79,     768,      79,     769,      79,     770,      79,
+        771,      79,     776,      85,     768,      85,     769,      85,
+        770,      85,     776,      89,     769,      97,     768,      97,
+        769,      97,     770,      97,     771,      97,     776,      97,
+        778,      99,     807,     101,     768,     101,     769,     101,
+        770,     101,     776,     105,     768,     105,     769,     105,
+        770,     105,     776,     110,     771,     111,     768,     111,
+        769,     111,     770,     111,     771,     111,     776,     117,
+        768,     117,     769,     117,     770,     117,     776,     121,
+        769,     121,     776,      65,     772,      97,     772,      65,
+        774,      97,     774,      65,     808,      97,     808,      67,
+        769,      99,     769,      67,     770,      99,     770,      67,
+        775,      99,     775,      67,     780,      99,     780,      68,
+        780,     100,     780,      69,     772,     101,     772,      69,
+        774,     101,     774,      69,     775,     101,     775,      69,
+        808,     101,     808,      69,     780,     101,     780,      71,
+        770,     103,     770,      71,     774,     103,     774,      71,
+        775,     103,     775,      71,     807,     103,     807,      72,
+        770,     104,     770,      73,     771,     105,     771,      73,
+        772,     105,     772,      73,     774,     105,     774,      73,
+        808,     105,     808,      73,     775,      74,     770,     106,
+        770,      75,     807,     107,     807,      76,     769,     108,
+        769,      76,     807,     108,     807,      76,     780,     108,
+        780,      78,     769,     110,     769,      78,     807,     110,
+        807,      78,     780,     110,     780,      79,     772,     111,
+        772,      79,     774,     111,     774,      79,     779,     111,
+        779,      82,     769,     114,     769,      82,     807,     114,
+        807,      82,     780,     114,     780,      83,     769,     115,
+        769,      83,     770,     115,     770,      83,     807,     115,
+        807,      83,     780,     115,     780,      84,     807,     116,
+        807,      84,     780,     116,     780,      85,     771,     117,
+        771,      85,     772,     117,     772,      85,     774,     117,
+        774,      85,     778,     117,     778,      85,     779,     117,
+        779,      85,     808,     117,     808,      87,     770,     119,
+        770,      89,     770,     121,     770,      89,     776,      90,
+        769,     122,     769,      90,     775,     122,     775,      90,
+        780,     122,     780,      79,     795,     111,     795,      85,
+        795,     117,     795,      65,     780,      97,     780,      73,
+        780,     105,     780,      79,     780,     111,     780,      85,
+        780,     117,     780,      85,     776,     772,     117,     776,
+        772,      85,     776,     769,     117,     776,     769,      85,
+        776,     780,     117,     776,     780,      85,     776,     768,
+        117,     776,     768,      65,     776,     772,      97,     776,
+        772,      65,     775,     772,      97,     775,     772,     198,
+        772,     230,     772,      71,     780,     103,     780,      75,
+        780,     107,     780,      79,     808,     111,     808,      79,
+        808,     772,     111,     808,     772,     439,     780,     658,
+        780,     106,     780,      71,     769,     103,     769,      78,
+        768,     110,     768,      65,     778,     769,      97,     778,
+        769,     198,     769,     230,     769,     216,     769,     248,
+        769,      65,     783,      97,     783,      65,     785,      97,
+        785,      69,     783,     101,     783,      69,     785,     101,
+        785,      73,     783,     105,     783,      73,     785,     105,
+        785,      79,     783,     111,     783,      79,     785,     111,
+        785,      82,     783,     114,     783,      82,     785,     114,
+        785,      85,     783,     117,     783,      85,     785,     117,
+        785,      83,     806,     115,     806,      84,     806,     116,
+        806,      72,     780,     104,     780,      65,     775,      97,
+        775,      69,     807,     101,     807,      79,     776,     772,
+        111,     776,     772,      79,     771,     772,     111,     771,
+        772,      79,     775,     111,     775,      79,     775,     772,
+        111,     775,     772,      89,     772,     121,     772,     768,
+        769,     787,     776,     769,     697,      59,     168,     769,
+        913,     769,     183,     917,     769,     919,     769,     921,
+        769,     927,     769,     933,     769,     937,     769,     953,
+        776,     769,     921,     776,     933,     776,     945,     769,
+        949,     769,     951,     769,     953,     769,     965,     776,
+        769,     953,     776,     965,     776,     959,     769,     965,
+        769,     969,     769,     978,     769,     978,     776,    1045,
+        768,    1045,     776,    1043,     769,    1030,     776,    1050,
+        769,    1048,     768,    1059,     774,    1048,     774,    1080,
+        774,    1077,     768,    1077,     776,    1075,     769,    1110,
+        776,    1082,     769,    1080,     768,    1091,     774,    1140,
+        783,    1141,     783,    1046,     774,    1078,     774,    1040,
+        774,    1072,     774,    1040,     776,    1072,     776,    1045,
+        774,    1077,     774,    1240,     776,    1241,     776,    1046,
+        776,    1078,     776,    1047,     776,    1079,     776,    1048,
+        772,    1080,     772,    1048,     776,    1080,     776,    1054,
+        776,    1086,     776,    1256,     776,    1257,     776,    1069,
+        776,    1101,     776,    1059,     772,    1091,     772,    1059,
+        776,    1091,     776,    1059,     779,    1091,     779,    1063,
+        776,    1095,     776,    1067,     776,    1099,     776,    1575,
+       1619,    1575,    1620,    1608,    1620,    1575,    1621,    1610,
+       1620,    1749,    1620,    1729,    1620,    1746,    1620,    2344,
+       2364,    2352,    2364,    2355,    2364,    2325,    2364,    2326,
+       2364,    2327,    2364,    2332,    2364,    2337,    2364,    2338,
+       2364,    2347,    2364,    2351,    2364,    2503,    2494,    2503,
+       2519,    2465,    2492,    2466,    2492,    2479,    2492,    2610,
+       2620,    2616,    2620,    2582,    2620,    2583,    2620,    2588,
+       2620,    2603,    2620,    2887,    2902,    2887,    2878,    2887,
+       2903,    2849,    2876,    2850,    2876,    2962,    3031,    3014,
+       3006,    3015,    3006,    3014,    3031,    3142,    3158,    3263,
+       3285,    3270,    3285,    3270,    3286,    3270,    3266,    3270,
+       3266,    3285,    3398,    3390,    3399,    3390,    3398,    3415,
+       3545,    3530,    3545,    3535,    3545,    3535,    3530,    3545,
+       3551,    3906,    4023,    3916,    4023,    3921,    4023,    3926,
+       4023,    3931,    4023,    3904,    4021,    3953,    3954,    3953,
+       3956,    4018,    3968,    4019,    3968,    3953,    3968,    3986,
+       4023,    3996,    4023,    4001,    4023,    4006,    4023,    4011,
+       4023,    3984,    4021,    4133,    4142,    6917,    6965,    6919,
+       6965,    6921,    6965,    6923,    6965,    6925,    6965,    6929,
+       6965,    6970,    6965,    6972,    6965,    6974,    6965,    6975,
+       6965,    6978,    6965,      65,     805,      97,     805,      66,
+        775,      98,     775,      66,     803,      98,     803,      66,
+        817,      98,     817,      67,     807,     769,      99,     807,
+        769,      68,     775,     100,     775,      68,     803,     100,
+        803,      68,     817,     100,     817,      68,     807,     100,
+        807,      68,     813,     100,     813,      69,     772,     768,
+        101,     772,     768,      69,     772,     769,     101,     772,
+        769,      69,     813,     101,     813,      69,     816,     101,
+        816,      69,     807,     774,     101,     807,     774,      70,
+        775,     102,     775,      71,     772,     103,     772,      72,
+        775,     104,     775,      72,     803,     104,     803,      72,
+        776,     104,     776,      72,     807,     104,     807,      72,
+        814,     104,     814,      73,     816,     105,     816,      73,
+        776,     769,     105,     776,     769,      75,     769,     107,
+        769,      75,     803,     107,     803,      75,     817,     107,
+        817,      76,     803,     108,     803,      76,     803,     772,
+        108,     803,     772,      76,     817,     108,     817,      76,
+        813,     108,     813,      77,     769,     109,     769,      77,
+        775,     109,     775,      77,     803,     109,     803,      78,
+        775,     110,     775,      78,     803,     110,     803,      78,
+        817,     110,     817,      78,     813,     110,     813,      79,
+        771,     769,     111,     771,     769,      79,     771,     776,
+        111,     771,     776,      79,     772,     768,     111,     772,
+        768,      79,     772,     769,     111,     772,     769,      80,
+        769,     112,     769,      80,     775,     112,     775,      82,
+        775,     114,     775,      82,     803,     114,     803,      82,
+        803,     772,     114,     803,     772,      82,     817,     114,
+        817,      83,     775,     115,     775,      83,     803,     115,
+        803,      83,     769,     775,     115,     769,     775,      83,
+        780,     775,     115,     780,     775,      83,     803,     775,
+        115,     803,     775,      84,     775,     116,     775,      84,
+        803,     116,     803,      84,     817,     116,     817,      84,
+        813,     116,     813,      85,     804,     117,     804,      85,
+        816,     117,     816,      85,     813,     117,     813,      85,
+        771,     769,     117,     771,     769,      85,     772,     776,
+        117,     772,     776,      86,     771,     118,     771,      86,
+        803,     118,     803,      87,     768,     119,     768,      87,
+        769,     119,     769,      87,     776,     119,     776,      87,
+        775,     119,     775,      87,     803,     119,     803,      88,
+        775,     120,     775,      88,     776,     120,     776,      89,
+        775,     121,     775,      90,     770,     122,     770,      90,
+        803,     122,     803,      90,     817,     122,     817,     104,
+        817,     116,     776,     119,     778,     121,     778,     383,
+        775,      65,     803,      97,     803,      65,     777,      97,
+        777,      65,     770,     769,      97,     770,     769,      65,
+        770,     768,      97,     770,     768,      65,     770,     777,
+         97,     770,     777,      65,     770,     771,      97,     770,
+        771,      65,     803,     770,      97,     803,     770,      65,
+        774,     769,      97,     774,     769,      65,     774,     768,
+         97,     774,     768,      65,     774,     777,      97,     774,
+        777,      65,     774,     771,      97,     774,     771,      65,
+        803,     774,      97,     803,     774,      69,     803,     101,
+        803,      69,     777,     101,     777,      69,     771,     101,
+        771,      69,     770,     769,     101,     770,     769,      69,
+        770,     768,     101,     770,     768,      69,     770,     777,
+        101,     770,     777,      69,     770,     771,     101,     770,
+        771,      69,     803,     770,     101,     803,     770,      73,
+        777,     105,     777,      73,     803,     105,     803,      79,
+        803,     111,     803,      79,     777,     111,     777,      79,
+        770,     769,     111,     770,     769,      79,     770,     768,
+        111,     770,     768,      79,     770,     777,     111,     770,
+        777,      79,     770,     771,     111,     770,     771,      79,
+        803,     770,     111,     803,     770,      79,     795,     769,
+        111,     795,     769,      79,     795,     768,     111,     795,
+        768,      79,     795,     777,     111,     795,     777,      79,
+        795,     771,     111,     795,     771,      79,     795,     803,
+        111,     795,     803,      85,     803,     117,     803,      85,
+        777,     117,     777,      85,     795,     769,     117,     795,
+        769,      85,     795,     768,     117,     795,     768,      85,
+        795,     777,     117,     795,     777,      85,     795,     771,
+        117,     795,     771,      85,     795,     803,     117,     795,
+        803,      89,     768,     121,     768,      89,     803,     121,
+        803,      89,     777,     121,     777,      89,     771,     121,
+        771,     945,     787,     945,     788,     945,     787,     768,
+        945,     788,     768,     945,     787,     769,     945,     788,
+        769,     945,     787,     834,     945,     788,     834,     913,
+        787,     913,     788,     913,     787,     768,     913,     788,
+        768,     913,     787,     769,     913,     788,     769,     913,
+        787,     834,     913,     788,     834,     949,     787,     949,
+        788,     949,     787,     768,     949,     788,     768,     949,
+        787,     769,     949,     788,     769,     917,     787,     917,
+        788,     917,     787,     768,     917,     788,     768,     917,
+        787,     769,     917,     788,     769,     951,     787,     951,
+        788,     951,     787,     768,     951,     788,     768,     951,
+        787,     769,     951,     788,     769,     951,     787,     834,
+        951,     788,     834,     919,     787,     919,     788,     919,
+        787,     768,     919,     788,     768,     919,     787,     769,
+        919,     788,     769,     919,     787,     834,     919,     788,
+        834,     953,     787,     953,     788,     953,     787,     768,
+        953,     788,     768,     953,     787,     769,     953,     788,
+        769,     953,     787,     834,     953,     788,     834,     921,
+        787,     921,     788,     921,     787,     768,     921,     788,
+        768,     921,     787,     769,     921,     788,     769,     921,
+        787,     834,     921,     788,     834,     959,     787,     959,
+        788,     959,     787,     768,     959,     788,     768,     959,
+        787,     769,     959,     788,     769,     927,     787,     927,
+        788,     927,     787,     768,     927,     788,     768,     927,
+        787,     769,     927,     788,     769,     965,     787,     965,
+        788,     965,     787,     768,     965,     788,     768,     965,
+        787,     769,     965,     788,     769,     965,     787,     834,
+        965,     788,     834,     933,     788,     933,     788,     768,
+        933,     788,     769,     933,     788,     834,     969,     787,
+        969,     788,     969,     787,     768,     969,     788,     768,
+        969,     787,     769,     969,     788,     769,     969,     787,
+        834,     969,     788,     834,     937,     787,     937,     788,
+        937,     787,     768,     937,     788,     768,     937,     787,
+        769,     937,     788,     769,     937,     787,     834,     937,
+        788,     834,     945,     768,     949,     768,     951,     768,
+        953,     768,     959,     768,     965,     768,     969,     768,
+        945,     787,     837,     945,     788,     837,     945,     787,
+        768,     837,     945,     788,     768,     837,     945,     787,
+        769,     837,     945,     788,     769,     837,     945,     787,
+        834,     837,     945,     788,     834,     837,     913,     787,
+        837,     913,     788,     837,     913,     787,     768,     837,
+        913,     788,     768,     837,     913,     787,     769,     837,
+        913,     788,     769,     837,     913,     787,     834,     837,
+        913,     788,     834,     837,     951,     787,     837,     951,
+        788,     837,     951,     787,     768,     837,     951,     788,
+        768,     837,     951,     787,     769,     837,     951,     788,
+        769,     837,     951,     787,     834,     837,     951,     788,
+        834,     837,     919,     787,     837,     919,     788,     837,
+        919,     787,     768,     837,     919,     788,     768,     837,
+        919,     787,     769,     837,     919,     788,     769,     837,
+        919,     787,     834,     837,     919,     788,     834,     837,
+        969,     787,     837,     969,     788,     837,     969,     787,
+        768,     837,     969,     788,     768,     837,     969,     787,
+        769,     837,     969,     788,     769,     837,     969,     787,
+        834,     837,     969,     788,     834,     837,     937,     787,
+        837,     937,     788,     837,     937,     787,     768,     837,
+        937,     788,     768,     837,     937,     787,     769,     837,
+        937,     788,     769,     837,     937,     787,     834,     837,
+        937,     788,     834,     837,     945,     774,     945,     772,
+        945,     768,     837,     945,     837,     945,     769,     837,
+        945,     834,     945,     834,     837,     913,     774,     913,
+        772,     913,     768,     913,     837,     953,     168,     834,
+        951,     768,     837,     951,     837,     951,     769,     837,
+        951,     834,     951,     834,     837,     917,     768,     919,
+        768,     919,     837,    8127,     768,    8127,     769,    8127,
+        834,     953,     774,     953,     772,     953,     776,     768,
+        953,     834,     953,     776,     834,     921,     774,     921,
+        772,     921,     768,    8190,     768,    8190,     769,    8190,
+        834,     965,     774,     965,     772,     965,     776,     768,
+        961,     787,     961,     788,     965,     834,     965,     776,
+        834,     933,     774,     933,     772,     933,     768,     929,
+        788,     168,     768,      96,     969,     768,     837,     969,
+        837,     969,     769,     837,     969,     834,     969,     834,
+        837,     927,     768,     937,     768,     937,     837,     180,
+       8194,    8195,     937,      75,    8592,     824,    8594,     824,
+       8596,     824,    8656,     824,    8660,     824,    8658,     824,
+       8707,     824,    8712,     824,    8715,     824,    8739,     824,
+       8741,     824,    8764,     824,    8771,     824,    8773,     824,
+       8776,     824,      61,     824,    8801,     824,    8781,     824,
+         60,     824,      62,     824,    8804,     824,    8805,     824,
+       8818,     824,    8819,     824,    8822,     824,    8823,     824,
+       8826,     824,    8827,     824,    8834,     824,    8835,     824,
+       8838,     824,    8839,     824,    8866,     824,    8872,     824,
+       8873,     824,    8875,     824,    8828,     824,    8829,     824,
+       8849,     824,    8850,     824,    8882,     824,    8883,     824,
+       8884,     824,    8885,     824,   12296,   12297,   10973,     824,
+      12363,   12441,   12365,   12441,   12367,   12441,   12369,   12441,
+      12371,   12441,   12373,   12441,   12375,   12441,   12377,   12441,
+      12379,   12441,   12381,   12441,   12383,   12441,   12385,   12441,
+      12388,   12441,   12390,   12441,   12392,   12441,   12399,   12441,
+      12399,   12442,   12402,   12441,   12402,   12442,   12405,   12441,
+      12405,   12442,   12408,   12441,   12408,   12442,   12411,   12441,
+      12411,   12442,   12358,   12441,   12445,   12441,   12459,   12441,
+      12461,   12441,   12463,   12441,   12465,   12441,   12467,   12441,
+      12469,   12441,   12471,   12441,   12473,   12441,   12475,   12441,
+      12477,   12441,   12479,   12441,   12481,   12441,   12484,   12441,
+      12486,   12441,   12488,   12441,   12495,   12441,   12495,   12442,
+      12498,   12441,   12498,   12442,   12501,   12441,   12501,   12442,
+      12504,   12441,   12504,   12442,   12507,   12441,   12507,   12442,
+      12454,   12441,   12527,   12441,   12528,   12441,   12529,   12441,
+      12530,   12441,   12541,   12441,   35912,   26356,   36554,   36040,
+      28369,   20018,   21477,   40860,   22865,   37329,   21895,   22856,
+      25078,   30313,   32645,   34367,   34746,   35064,   37007,   27138,
+      27931,   28889,   29662,   33853,   37226,   39409,   20098,   21365,
+      27396,   29211,   34349,   40478,   23888,   28651,   34253,   35172,
+      25289,   33240,   34847,   24266,   26391,   28010,   29436,   37070,
+      20358,   20919,   21214,   25796,   27347,   29200,   30439,   32769,
+      34310,   34396,   36335,   38706,   39791,   40442,   30860,   31103,
+      32160,   33737,   37636,   40575,   35542,   22751,   24324,   31840,
+      32894,   29282,   30922,   36034,   38647,   22744,   23650,   27155,
+      28122,   28431,   32047,   32311,   38475,   21202,   32907,   20956,
+      20940,   31260,   32190,   33777,   38517,   35712,   25295,   35582,
+      20025,   23527,   24594,   29575,   30064,   21271,   30971,   20415,
+      24489,   19981,   27852,   25976,   32034,   21443,   22622,   30465,
+      33865,   35498,   27578,   36784,   27784,   25342,   33509,   25504,
+      30053,   20142,   20841,   20937,   26753,   31975,   33391,   35538,
+      37327,   21237,   21570,   22899,   24300,   26053,   28670,   31018,
+      38317,   39530,   40599,   40654,   21147,   26310,   27511,   36706,
+      24180,   24976,   25088,   25754,   28451,   29001,   29833,   31178,
+      32244,   32879,   36646,   34030,   36899,   37706,   21015,   21155,
+      21693,   28872,   35010,   24265,   24565,   25467,   27566,   31806,
+      29557,   20196,   22265,   23994,   24604,   29618,   29801,   32666,
+      32838,   37428,   38646,   38728,   38936,   20363,   31150,   37300,
+      38584,   24801,   20102,   20698,   23534,   23615,   26009,   29134,
+      30274,   34044,   36988,   40845,   26248,   38446,   21129,   26491,
+      26611,   27969,   28316,   29705,   30041,   30827,   32016,   39006,
+      20845,   25134,   38520,   20523,   23833,   28138,   36650,   24459,
+      24900,   26647,   38534,   21033,   21519,   23653,   26131,   26446,
+      26792,   27877,   29702,   30178,   32633,   35023,   35041,   37324,
+      38626,   21311,   28346,   21533,   29136,   29848,   34298,   38563,
+      40023,   40607,   26519,   28107,   33256,   31435,   31520,   31890,
+      29376,   28825,   35672,   20160,   33590,   21050,   20999,   24230,
+      25299,   31958,   23429,   27934,   26292,   36667,   34892,   38477,
+      35211,   24275,   20800,   21952,   22618,   26228,   20958,   29482,
+      30410,   31036,   31070,   31077,   31119,   38742,   31934,   32701,
+      34322,   35576,   36920,   37117,   39151,   39164,   39208,   40372,
+      37086,   38583,   20398,   20711,   20813,   21193,   21220,   21329,
+      21917,   22022,   22120,   22592,   22696,   23652,   23662,   24724,
+      24936,   24974,   25074,   25935,   26082,   26257,   26757,   28023,
+      28186,   28450,   29038,   29227,   29730,   30865,   31038,   31049,
+      31048,   31056,   31062,   31069,   31117,   31118,   31296,   31361,
+      31680,   32265,   32321,   32626,   32773,   33261,   33401,   33879,
+      35088,   35222,   35585,   35641,   36051,   36104,   36790,   38627,
+      38911,   38971,   24693,  148206,   33304,   20006,   20917,   20840,
+      20352,   20805,   20864,   21191,   21242,   21845,   21913,   21986,
+      22707,   22852,   22868,   23138,   23336,   24274,   24281,   24425,
+      24493,   24792,   24910,   24840,   24928,   25140,   25540,   25628,
+      25682,   25942,   26395,   26454,   27513,   28379,   28363,   28702,
+      30631,   29237,   29359,   29809,   29958,   30011,   30237,   30239,
+      30427,   30452,   30538,   30528,   30924,   31409,   31867,   32091,
+      32574,   33618,   33775,   34681,   35137,   35206,   35519,   35531,
+      35565,   35722,   36664,   36978,   37273,   37494,   38524,   38875,
+      38923,   39698,  141386,  141380,  144341,   15261,   16408,   16441,
+     152137,  154832,  163539,   40771,   40846,    1497,    1460,    1522,
+       1463,    1513,    1473,    1513,    1474,    1513,    1468,    1473,
+       1513,    1468,    1474,    1488,    1463,    1488,    1464,    1488,
+       1468,    1489,    1468,    1490,    1468,    1491,    1468,    1492,
+       1468,    1493,    1468,    1494,    1468,    1496,    1468,    1497,
+       1468,    1498,    1468,    1499,    1468,    1500,    1468,    1502,
+       1468,    1504,    1468,    1505,    1468,    1507,    1468,    1508,
+       1468,    1510,    1468,    1511,    1468,    1512,    1468,    1513,
+       1468,    1514,    1468,    1493,    1465,    1489,    1471,    1499,
+       1471,    1508,    1471,   69785,   69818,   69787,   69818,   69797,
+      69818,   69937,   69927,   69938,   69927,   70471,   70462,   70471,
+      70487,   70841,   70842,   70841,   70832,   70841,   70845,   71096,
+      71087,   71097,   71087,   71989,   71984,  119127,  119141,  119128,
+     119141,  119128,  119141,  119150,  119128,  119141,  119151,  119128,
+     119141,  119152,  119128,  119141,  119153,  119128,  119141,  119154,
+     119225,  119141,  119226,  119141,  119225,  119141,  119150,  119226,
+     119141,  119150,  119225,  119141,  119151,  119226,  119141,  119151,
+      20029,   20024,   20033,  131362,   20320,   20411,   20482,   20602,
+      20633,   20687,   13470,  132666,   20820,   20836,   20855,  132380,
+      13497,   20839,   20877,  132427,   20887,   20900,   20172,   20908,
+     168415,   20981,   20995,   13535,   21051,   21062,   21106,   21111,
+      13589,   21253,   21254,   21321,   21338,   21363,   21373,   21375,
+     133676,   28784,   21450,   21471,  133987,   21483,   21489,   21510,
+      21662,   21560,   21576,   21608,   21666,   21750,   21776,   21843,
+      21859,   21892,   21931,   21939,   21954,   22294,   22295,   22097,
+      22132,   22766,   22478,   22516,   22541,   22411,   22578,   22577,
+      22700,  136420,   22770,   22775,   22790,   22810,   22818,   22882,
+     136872,  136938,   23020,   23067,   23079,   23000,   23142,   14062,
+      14076,   23304,   23358,  137672,   23491,   23512,   23539,  138008,
+      23551,   23558,   24403,   23586,   14209,   23648,   23744,   23693,
+     138724,   23875,  138726,   23918,   23915,   23932,   24033,   24034,
+      14383,   24061,   24104,   24125,   24169,   14434,  139651,   14460,
+      24240,   24243,   24246,  172946,   24318,  140081,   33281,   24354,
+      14535,  144056,  156122,   24418,   24427,   14563,   24474,   24525,
+      24535,   24569,   24705,   14650,   14620,  141012,   24775,   24904,
+      24908,   24954,   25010,   24996,   25007,   25054,   25104,   25115,
+      25181,   25265,   25300,   25424,  142092,   25405,   25340,   25448,
+      25475,   25572,  142321,   25634,   25541,   25513,   14894,   25705,
+      25726,   25757,   25719,   14956,   25964,  143370,   26083,   26360,
+      26185,   15129,   15112,   15076,   20882,   20885,   26368,   26268,
+      32941,   17369,   26401,   26462,   26451,  144323,   15177,   26618,
+      26501,   26706,  144493,   26766,   26655,   26900,   26946,   27043,
+      27114,   27304,  145059,   27355,   15384,   27425,  145575,   27476,
+      15438,   27506,   27551,   27579,  146061,  138507,  146170,   27726,
+     146620,   27839,   27853,   27751,   27926,   27966,   28009,   28024,
+      28037,  146718,   27956,   28207,   28270,   15667,   28359,  147153,
+      28153,   28526,  147294,  147342,   28614,   28729,   28699,   15766,
+      28746,   28797,   28791,   28845,  132389,   28997,  148067,   29084,
+     148395,   29224,   29264,  149000,   29312,   29333,  149301,  149524,
+      29562,   29579,   16044,   29605,   16056,   29767,   29788,   29829,
+      29898,   16155,   29988,  150582,   30014,  150674,  139679,   30224,
+     151457,  151480,  151620,   16380,   16392,  151795,  151794,  151833,
+     151859,   30494,   30495,   30603,   16454,   16534,  152605,   30798,
+      16611,  153126,  153242,  153285,   31211,   16687,   31306,   31311,
+     153980,  154279,   31470,   16898,  154539,   31686,   31689,   16935,
+     154752,   31954,   17056,   31976,   31971,   32000,  155526,   32099,
+      17153,   32199,   32258,   32325,   17204,  156200,  156231,   17241,
+     156377,   32634,  156478,   32661,   32762,  156890,  156963,   32864,
+     157096,   32880,  144223,   17365,   32946,   33027,   17419,   33086,
+      23221,  157607,  157621,  144275,  144284,   33284,   36766,   17515,
+      33425,   33419,   33437,   21171,   33457,   33459,   33469,   33510,
+     158524,   33565,   33635,   33709,   33571,   33725,   33767,   33619,
+      33738,   33740,   33756,  158774,  159083,  158933,   17707,   34033,
+      34035,   34070,  160714,   34148,  159532,   17757,   17761,  159665,
+     159954,   17771,   34384,   34407,   34409,   34473,   34440,   34574,
+      34530,   34600,   34667,   34694,   17879,   34785,   34817,   17913,
+      34912,   34915,  161383,   35031,   35038,   17973,   35066,   13499,
+     161966,  162150,   18110,   18119,   35488,   35925,  162984,   36011,
+      36033,   36123,   36215,  163631,  133124,   36299,   36284,   36336,
+     133342,   36564,  165330,  165357,   37012,   37105,   37137,  165678,
+      37147,   37432,   37591,   37592,   37500,   37881,   37909,  166906,
+      38283,   18837,   38327,  167287,   18918,   38595,   23986,   38691,
+     168261,  168474,   19054,   19062,   38880,  168970,   19122,  169110,
+      38953,  169398,   39138,   19251,   39209,   39335,   39362,   39422,
+      19406,  170800,   40000,   40189,   19662,   19693,   40295,  172238,
+      19704,  172293,  172558,  172689,   40635,   19798,   40697,   40702,
+      40709,   40719,   40726,   40763,  173568,
+};
+
+
+static const UnicodeComposition unicodeCompositions[UNICODE_COMPOSITIONS] =
+{
+    { 0x0003c, 0x00338, 0x0226e },
+    { 0x0003d, 0x00338, 0x02260 },
+    { 0x0003e, 0x00338, 0x0226f },
+    { 0x00041, 0x00300, 0x000c0 },
+    { 0x00041, 0x00301, 0x000c1 },
+    { 0x00041, 0x00302, 0x000c2 },
+    { 0x00041, 0x00303, 0x000c3 },
+    { 0x00041, 0x00304, 0x00100 },
+    { 0x00041, 0x00306, 0x00102 },
+    { 0x00041, 0x00307, 0x00226 },
+    { 0x00041, 0x00308, 0x000c4 },
+    { 0x00041, 0x00309, 0x01ea2 },
+    { 0x00041, 0x0030a, 0x000c5 },
+    { 0x00041, 0x0030c, 0x001cd },
+    { 0x00041, 0x0030f, 0x00200 },
+    { 0x00041, 0x00311, 0x00202 },
+    { 0x00041, 0x00323, 0x01ea0 },
+    { 0x00041, 0x00325, 0x01e00 },
+    { 0x00041, 0x00328, 0x00104 },
+    { 0x00042, 0x00307, 0x01e02 },
+    { 0x00042, 0x00323, 0x01e04 },
+    { 0x00042, 0x00331, 0x01e06 },
+    { 0x00043, 0x00301, 0x00106 },
+    { 0x00043, 0x00302, 0x00108 },
+    { 0x00043, 0x00307, 0x0010a },
+    { 0x00043, 0x0030c, 0x0010c },
+    { 0x00043, 0x00327, 0x000c7 },
+    { 0x00044, 0x00307, 0x01e0a },
+    { 0x00044, 0x0030c, 0x0010e },
+    { 0x00044, 0x00323, 0x01e0c },
+    { 0x00044, 0x00327, 0x01e10 },
+    { 0x00044, 0x0032d, 0x01e12 },
+    { 0x00044, 0x00331, 0x01e0e },
+    { 0x00045, 0x00300, 0x000c8 },
+    { 0x00045, 0x00301, 0x000c9 },
+    { 0x00045, 0x00302, 0x000ca },
+    { 0x00045, 0x00303, 0x01ebc },
+    { 0x00045, 0x00304, 0x00112 },
+    { 0x00045, 0x00306, 0x00114 },
+    { 0x00045, 0x00307, 0x00116 },
+    { 0x00045, 0x00308, 0x000cb },
+    { 0x00045, 0x00309, 0x01eba },
+    { 0x00045, 0x0030c, 0x0011a },
+    { 0x00045, 0x0030f, 0x00204 },
+    { 0x00045, 0x00311, 0x00206 },
+    { 0x00045, 0x00323, 0x01eb8 },
+    { 0x00045, 0x00327, 0x00228 },
+    { 0x00045, 0x00328, 0x00118 },
+    { 0x00045, 0x0032d, 0x01e18 },
+    { 0x00045, 0x00330, 0x01e1a },
+    { 0x00046, 0x00307, 0x01e1e },
+    { 0x00047, 0x00301, 0x001f4 },
+    { 0x00047, 0x00302, 0x0011c },
+    { 0x00047, 0x00304, 0x01e20 },
+    { 0x00047, 0x00306, 0x0011e },
+    { 0x00047, 0x00307, 0x00120 },
+    { 0x00047, 0x0030c, 0x001e6 },
+    { 0x00047, 0x00327, 0x00122 },
+    { 0x00048, 0x00302, 0x00124 },
+    { 0x00048, 0x00307, 0x01e22 },
+    { 0x00048, 0x00308, 0x01e26 },
+    { 0x00048, 0x0030c, 0x0021e },
+    { 0x00048, 0x00323, 0x01e24 },
+    { 0x00048, 0x00327, 0x01e28 },
+    { 0x00048, 0x0032e, 0x01e2a },
+    { 0x00049, 0x00300, 0x000cc },
+    { 0x00049, 0x00301, 0x000cd },
+    { 0x00049, 0x00302, 0x000ce },
+    { 0x00049, 0x00303, 0x00128 },
+    { 0x00049, 0x00304, 0x0012a },
+    { 0x00049, 0x00306, 0x0012c },
+    { 0x00049, 0x00307, 0x00130 },
+    { 0x00049, 0x00308, 0x000cf },
+    { 0x00049, 0x00309, 0x01ec8 },
+    { 0x00049, 0x0030c, 0x001cf },
+    { 0x00049, 0x0030f, 0x00208 },
+    { 0x00049, 0x00311, 0x0020a },
+    { 0x00049, 0x00323, 0x01eca },
+    { 0x00049, 0x00328, 0x0012e },
+    { 0x00049, 0x00330, 0x01e2c },
+    { 0x0004a, 0x00302, 0x00134 },
+    { 0x0004b, 0x00301, 0x01e30 },
+    { 0x0004b, 0x0030c, 0x001e8 },
+    { 0x0004b, 0x00323, 0x01e32 },
+    { 0x0004b, 0x00327, 0x00136 },
+    { 0x0004b, 0x00331, 0x01e34 },
+    { 0x0004c, 0x00301, 0x00139 },
+    { 0x0004c, 0x0030c, 0x0013d },
+    { 0x0004c, 0x00323, 0x01e36 },
+    { 0x0004c, 0x00327, 0x0013b },
+    { 0x0004c, 0x0032d, 0x01e3c },
+    { 0x0004c, 0x00331, 0x01e3a },
+    { 0x0004d, 0x00301, 0x01e3e },
+    { 0x0004d, 0x00307, 0x01e40 },
+    { 0x0004d, 0x00323, 0x01e42 },
+    { 0x0004e, 0x00300, 0x001f8 },
+    { 0x0004e, 0x00301, 0x00143 },
+    { 0x0004e, 0x00303, 0x000d1 },
+    { 0x0004e, 0x00307, 0x01e44 },
+    { 0x0004e, 0x0030c, 0x00147 },
+    { 0x0004e, 0x00323, 0x01e46 },
+    { 0x0004e, 0x00327, 0x00145 },
+    { 0x0004e, 0x0032d, 0x01e4a },
+    { 0x0004e, 0x00331, 0x01e48 },
+    { 0x0004f, 0x00300, 0x000d2 },
+    { 0x0004f, 0x00301, 0x000d3 },
+    { 0x0004f, 0x00302, 0x000d4 },
+    { 0x0004f, 0x00303, 0x000d5 },
+    { 0x0004f, 0x00304, 0x0014c },
+    { 0x0004f, 0x00306, 0x0014e },
+    { 0x0004f, 0x00307, 0x0022e },
+    { 0x0004f, 0x00308, 0x000d6 },
+    { 0x0004f, 0x00309, 0x01ece },
+    { 0x0004f, 0x0030b, 0x00150 },
+    { 0x0004f, 0x0030c, 0x001d1 },
+    { 0x0004f, 0x0030f, 0x0020c },
+    { 0x0004f, 0x00311, 0x0020e },
+    { 0x0004f, 0x0031b, 0x001a0 },
+    { 0x0004f, 0x00323, 0x01ecc },
+    { 0x0004f, 0x00328, 0x001ea },
+    { 0x00050, 0x00301, 0x01e54 },
+    { 0x00050, 0x00307, 0x01e56 },
+    { 0x00052, 0x00301, 0x00154 },
+    { 0x00052, 0x00307, 0x01e58 },
+    { 0x00052, 0x0030c, 0x00158 },
+    { 0x00052, 0x0030f, 0x00210 },
+    { 0x00052, 0x00311, 0x00212 },
+    { 0x00052, 0x00323, 0x01e5a },
+    { 0x00052, 0x00327, 0x00156 },
+    { 0x00052, 0x00331, 0x01e5e },
+    { 0x00053, 0x00301, 0x0015a },
+    { 0x00053, 0x00302, 0x0015c },
+    { 0x00053, 0x00307, 0x01e60 },
+    { 0x00053, 0x0030c, 0x00160 },
+    { 0x00053, 0x00323, 0x01e62 },
+    { 0x00053, 0x00326, 0x00218 },
+    { 0x00053, 0x00327, 0x0015e },
+    { 0x00054, 0x00307, 0x01e6a },
+    { 0x00054, 0x0030c, 0x00164 },
+    { 0x00054, 0x00323, 0x01e6c },
+    { 0x00054, 0x00326, 0x0021a },
+    { 0x00054, 0x00327, 0x00162 },
+    { 0x00054, 0x0032d, 0x01e70 },
+    { 0x00054, 0x00331, 0x01e6e },
+    { 0x00055, 0x00300, 0x000d9 },
+    { 0x00055, 0x00301, 0x000da },
+    { 0x00055, 0x00302, 0x000db },
+    { 0x00055, 0x00303, 0x00168 },
+    { 0x00055, 0x00304, 0x0016a },
+    { 0x00055, 0x00306, 0x0016c },
+    { 0x00055, 0x00308, 0x000dc },
+    { 0x00055, 0x00309, 0x01ee6 },
+    { 0x00055, 0x0030a, 0x0016e },
+    { 0x00055, 0x0030b, 0x00170 },
+    { 0x00055, 0x0030c, 0x001d3 },
+    { 0x00055, 0x0030f, 0x00214 },
+    { 0x00055, 0x00311, 0x00216 },
+    { 0x00055, 0x0031b, 0x001af },
+    { 0x00055, 0x00323, 0x01ee4 },
+    { 0x00055, 0x00324, 0x01e72 },
+    { 0x00055, 0x00328, 0x00172 },
+    { 0x00055, 0x0032d, 0x01e76 },
+    { 0x00055, 0x00330, 0x01e74 },
+    { 0x00056, 0x00303, 0x01e7c },
+    { 0x00056, 0x00323, 0x01e7e },
+    { 0x00057, 0x00300, 0x01e80 },
+    { 0x00057, 0x00301, 0x01e82 },
+    { 0x00057, 0x00302, 0x00174 },
+    { 0x00057, 0x00307, 0x01e86 },
+    { 0x00057, 0x00308, 0x01e84 },
+    { 0x00057, 0x00323, 0x01e88 },
+    { 0x00058, 0x00307, 0x01e8a },
+    { 0x00058, 0x00308, 0x01e8c },
+    { 0x00059, 0x00300, 0x01ef2 },
+    { 0x00059, 0x00301, 0x000dd },
+    { 0x00059, 0x00302, 0x00176 },
+    { 0x00059, 0x00303, 0x01ef8 },
+    { 0x00059, 0x00304, 0x00232 },
+    { 0x00059, 0x00307, 0x01e8e },
+    { 0x00059, 0x00308, 0x00178 },
+    { 0x00059, 0x00309, 0x01ef6 },
+    { 0x00059, 0x00323, 0x01ef4 },
+    { 0x0005a, 0x00301, 0x00179 },
+    { 0x0005a, 0x00302, 0x01e90 },
+    { 0x0005a, 0x00307, 0x0017b },
+    { 0x0005a, 0x0030c, 0x0017d },
+    { 0x0005a, 0x00323, 0x01e92 },
+    { 0x0005a, 0x00331, 0x01e94 },
+    { 0x00061, 0x00300, 0x000e0 },
+    { 0x00061, 0x00301, 0x000e1 },
+    { 0x00061, 0x00302, 0x000e2 },
+    { 0x00061, 0x00303, 0x000e3 },
+    { 0x00061, 0x00304, 0x00101 },
+    { 0x00061, 0x00306, 0x00103 },
+    { 0x00061, 0x00307, 0x00227 },
+    { 0x00061, 0x00308, 0x000e4 },
+    { 0x00061, 0x00309, 0x01ea3 },
+    { 0x00061, 0x0030a, 0x000e5 },
+    { 0x00061, 0x0030c, 0x001ce },
+    { 0x00061, 0x0030f, 0x00201 },
+    { 0x00061, 0x00311, 0x00203 },
+    { 0x00061, 0x00323, 0x01ea1 },
+    { 0x00061, 0x00325, 0x01e01 },
+    { 0x00061, 0x00328, 0x00105 },
+    { 0x00062, 0x00307, 0x01e03 },
+    { 0x00062, 0x00323, 0x01e05 },
+    { 0x00062, 0x00331, 0x01e07 },
+    { 0x00063, 0x00301, 0x00107 },
+    { 0x00063, 0x00302, 0x00109 },
+    { 0x00063, 0x00307, 0x0010b },
+    { 0x00063, 0x0030c, 0x0010d },
+    { 0x00063, 0x00327, 0x000e7 },
+    { 0x00064, 0x00307, 0x01e0b },
+    { 0x00064, 0x0030c, 0x0010f },
+    { 0x00064, 0x00323, 0x01e0d },
+    { 0x00064, 0x00327, 0x01e11 },
+    { 0x00064, 0x0032d, 0x01e13 },
+    { 0x00064, 0x00331, 0x01e0f },
+    { 0x00065, 0x00300, 0x000e8 },
+    { 0x00065, 0x00301, 0x000e9 },
+    { 0x00065, 0x00302, 0x000ea },
+    { 0x00065, 0x00303, 0x01ebd },
+    { 0x00065, 0x00304, 0x00113 },
+    { 0x00065, 0x00306, 0x00115 },
+    { 0x00065, 0x00307, 0x00117 },
+    { 0x00065, 0x00308, 0x000eb },
+    { 0x00065, 0x00309, 0x01ebb },
+    { 0x00065, 0x0030c, 0x0011b },
+    { 0x00065, 0x0030f, 0x00205 },
+    { 0x00065, 0x00311, 0x00207 },
+    { 0x00065, 0x00323, 0x01eb9 },
+    { 0x00065, 0x00327, 0x00229 },
+    { 0x00065, 0x00328, 0x00119 },
+    { 0x00065, 0x0032d, 0x01e19 },
+    { 0x00065, 0x00330, 0x01e1b },
+    { 0x00066, 0x00307, 0x01e1f },
+    { 0x00067, 0x00301, 0x001f5 },
+    { 0x00067, 0x00302, 0x0011d },
+    { 0x00067, 0x00304, 0x01e21 },
+    { 0x00067, 0x00306, 0x0011f },
+    { 0x00067, 0x00307, 0x00121 },
+    { 0x00067, 0x0030c, 0x001e7 },
+    { 0x00067, 0x00327, 0x00123 },
+    { 0x00068, 0x00302, 0x00125 },
+    { 0x00068, 0x00307, 0x01e23 },
+    { 0x00068, 0x00308, 0x01e27 },
+    { 0x00068, 0x0030c, 0x0021f },
+    { 0x00068, 0x00323, 0x01e25 },
+    { 0x00068, 0x00327, 0x01e29 },
+    { 0x00068, 0x0032e, 0x01e2b },
+    { 0x00068, 0x00331, 0x01e96 },
+    { 0x00069, 0x00300, 0x000ec },
+    { 0x00069, 0x00301, 0x000ed },
+    { 0x00069, 0x00302, 0x000ee },
+    { 0x00069, 0x00303, 0x00129 },
+    { 0x00069, 0x00304, 0x0012b },
+    { 0x00069, 0x00306, 0x0012d },
+    { 0x00069, 0x00308, 0x000ef },
+    { 0x00069, 0x00309, 0x01ec9 },
+    { 0x00069, 0x0030c, 0x001d0 },
+    { 0x00069, 0x0030f, 0x00209 },
+    { 0x00069, 0x00311, 0x0020b },
+    { 0x00069, 0x00323, 0x01ecb },
+    { 0x00069, 0x00328, 0x0012f },
+    { 0x00069, 0x00330, 0x01e2d },
+    { 0x0006a, 0x00302, 0x00135 },
+    { 0x0006a, 0x0030c, 0x001f0 },
+    { 0x0006b, 0x00301, 0x01e31 },
+    { 0x0006b, 0x0030c, 0x001e9 },
+    { 0x0006b, 0x00323, 0x01e33 },
+    { 0x0006b, 0x00327, 0x00137 },
+    { 0x0006b, 0x00331, 0x01e35 },
+    { 0x0006c, 0x00301, 0x0013a },
+    { 0x0006c, 0x0030c, 0x0013e },
+    { 0x0006c, 0x00323, 0x01e37 },
+    { 0x0006c, 0x00327, 0x0013c },
+    { 0x0006c, 0x0032d, 0x01e3d },
+    { 0x0006c, 0x00331, 0x01e3b },
+    { 0x0006d, 0x00301, 0x01e3f },
+    { 0x0006d, 0x00307, 0x01e41 },
+    { 0x0006d, 0x00323, 0x01e43 },
+    { 0x0006e, 0x00300, 0x001f9 },
+    { 0x0006e, 0x00301, 0x00144 },
+    { 0x0006e, 0x00303, 0x000f1 },
+    { 0x0006e, 0x00307, 0x01e45 },
+    { 0x0006e, 0x0030c, 0x00148 },
+    { 0x0006e, 0x00323, 0x01e47 },
+    { 0x0006e, 0x00327, 0x00146 },
+    { 0x0006e, 0x0032d, 0x01e4b },
+    { 0x0006e, 0x00331, 0x01e49 },
+    { 0x0006f, 0x00300, 0x000f2 },
+    { 0x0006f, 0x00301, 0x000f3 },
+    { 0x0006f, 0x00302, 0x000f4 },
+    { 0x0006f, 0x00303, 0x000f5 },
+    { 0x0006f, 0x00304, 0x0014d },
+    { 0x0006f, 0x00306, 0x0014f },
+    { 0x0006f, 0x00307, 0x0022f },
+    { 0x0006f, 0x00308, 0x000f6 },
+    { 0x0006f, 0x00309, 0x01ecf },
+    { 0x0006f, 0x0030b, 0x00151 },
+    { 0x0006f, 0x0030c, 0x001d2 },
+    { 0x0006f, 0x0030f, 0x0020d },
+    { 0x0006f, 0x00311, 0x0020f },
+    { 0x0006f, 0x0031b, 0x001a1 },
+    { 0x0006f, 0x00323, 0x01ecd },
+    { 0x0006f, 0x00328, 0x001eb },
+    { 0x00070, 0x00301, 0x01e55 },
+    { 0x00070, 0x00307, 0x01e57 },
+    { 0x00072, 0x00301, 0x00155 },
+    { 0x00072, 0x00307, 0x01e59 },
+    { 0x00072, 0x0030c, 0x00159 },
+    { 0x00072, 0x0030f, 0x00211 },
+    { 0x00072, 0x00311, 0x00213 },
+    { 0x00072, 0x00323, 0x01e5b },
+    { 0x00072, 0x00327, 0x00157 },
+    { 0x00072, 0x00331, 0x01e5f },
+    { 0x00073, 0x00301, 0x0015b },
+    { 0x00073, 0x00302, 0x0015d },
+    { 0x00073, 0x00307, 0x01e61 },
+    { 0x00073, 0x0030c, 0x00161 },
+    { 0x00073, 0x00323, 0x01e63 },
+    { 0x00073, 0x00326, 0x00219 },
+    { 0x00073, 0x00327, 0x0015f },
+    { 0x00074, 0x00307, 0x01e6b },
+    { 0x00074, 0x00308, 0x01e97 },
+    { 0x00074, 0x0030c, 0x00165 },
+    { 0x00074, 0x00323, 0x01e6d },
+    { 0x00074, 0x00326, 0x0021b },
+    { 0x00074, 0x00327, 0x00163 },
+    { 0x00074, 0x0032d, 0x01e71 },
+    { 0x00074, 0x00331, 0x01e6f },
+    { 0x00075, 0x00300, 0x000f9 },
+    { 0x00075, 0x00301, 0x000fa },
+    { 0x00075, 0x00302, 0x000fb },
+    { 0x00075, 0x00303, 0x00169 },
+    { 0x00075, 0x00304, 0x0016b },
+    { 0x00075, 0x00306, 0x0016d },
+    { 0x00075, 0x00308, 0x000fc },
+    { 0x00075, 0x00309, 0x01ee7 },
+    { 0x00075, 0x0030a, 0x0016f },
+    { 0x00075, 0x0030b, 0x00171 },
+    { 0x00075, 0x0030c, 0x001d4 },
+    { 0x00075, 0x0030f, 0x00215 },
+    { 0x00075, 0x00311, 0x00217 },
+    { 0x00075, 0x0031b, 0x001b0 },
+    { 0x00075, 0x00323, 0x01ee5 },
+    { 0x00075, 0x00324, 0x01e73 },
+    { 0x00075, 0x00328, 0x00173 },
+    { 0x00075, 0x0032d, 0x01e77 },
+    { 0x00075, 0x00330, 0x01e75 },
+    { 0x00076, 0x00303, 0x01e7d },
+    { 0x00076, 0x00323, 0x01e7f },
+    { 0x00077, 0x00300, 0x01e81 },
+    { 0x00077, 0x00301, 0x01e83 },
+    { 0x00077, 0x00302, 0x00175 },
+    { 0x00077, 0x00307, 0x01e87 },
+    { 0x00077, 0x00308, 0x01e85 },
+    { 0x00077, 0x0030a, 0x01e98 },
+    { 0x00077, 0x00323, 0x01e89 },
+    { 0x00078, 0x00307, 0x01e8b },
+    { 0x00078, 0x00308, 0x01e8d },
+    { 0x00079, 0x00300, 0x01ef3 },
+    { 0x00079, 0x00301, 0x000fd },
+    { 0x00079, 0x00302, 0x00177 },
+    { 0x00079, 0x00303, 0x01ef9 },
+    { 0x00079, 0x00304, 0x00233 },
+    { 0x00079, 0x00307, 0x01e8f },
+    { 0x00079, 0x00308, 0x000ff },
+    { 0x00079, 0x00309, 0x01ef7 },
+    { 0x00079, 0x0030a, 0x01e99 },
+    { 0x00079, 0x00323, 0x01ef5 },
+    { 0x0007a, 0x00301, 0x0017a },
+    { 0x0007a, 0x00302, 0x01e91 },
+    { 0x0007a, 0x00307, 0x0017c },
+    { 0x0007a, 0x0030c, 0x0017e },
+    { 0x0007a, 0x00323, 0x01e93 },
+    { 0x0007a, 0x00331, 0x01e95 },
+    { 0x000a8, 0x00300, 0x01fed },
+    { 0x000a8, 0x00301, 0x00385 },
+    { 0x000a8, 0x00342, 0x01fc1 },
+    { 0x000c2, 0x00300, 0x01ea6 },
+    { 0x000c2, 0x00301, 0x01ea4 },
+    { 0x000c2, 0x00303, 0x01eaa },
+    { 0x000c2, 0x00309, 0x01ea8 },
+    { 0x000c4, 0x00304, 0x001de },
+    { 0x000c5, 0x00301, 0x001fa },
+    { 0x000c6, 0x00301, 0x001fc },
+    { 0x000c6, 0x00304, 0x001e2 },
+    { 0x000c7, 0x00301, 0x01e08 },
+    { 0x000ca, 0x00300, 0x01ec0 },
+    { 0x000ca, 0x00301, 0x01ebe },
+    { 0x000ca, 0x00303, 0x01ec4 },
+    { 0x000ca, 0x00309, 0x01ec2 },
+    { 0x000cf, 0x00301, 0x01e2e },
+    { 0x000d4, 0x00300, 0x01ed2 },
+    { 0x000d4, 0x00301, 0x01ed0 },
+    { 0x000d4, 0x00303, 0x01ed6 },
+    { 0x000d4, 0x00309, 0x01ed4 },
+    { 0x000d5, 0x00301, 0x01e4c },
+    { 0x000d5, 0x00304, 0x0022c },
+    { 0x000d5, 0x00308, 0x01e4e },
+    { 0x000d6, 0x00304, 0x0022a },
+    { 0x000d8, 0x00301, 0x001fe },
+    { 0x000dc, 0x00300, 0x001db },
+    { 0x000dc, 0x00301, 0x001d7 },
+    { 0x000dc, 0x00304, 0x001d5 },
+    { 0x000dc, 0x0030c, 0x001d9 },
+    { 0x000e2, 0x00300, 0x01ea7 },
+    { 0x000e2, 0x00301, 0x01ea5 },
+    { 0x000e2, 0x00303, 0x01eab },
+    { 0x000e2, 0x00309, 0x01ea9 },
+    { 0x000e4, 0x00304, 0x001df },
+    { 0x000e5, 0x00301, 0x001fb },
+    { 0x000e6, 0x00301, 0x001fd },
+    { 0x000e6, 0x00304, 0x001e3 },
+    { 0x000e7, 0x00301, 0x01e09 },
+    { 0x000ea, 0x00300, 0x01ec1 },
+    { 0x000ea, 0x00301, 0x01ebf },
+    { 0x000ea, 0x00303, 0x01ec5 },
+    { 0x000ea, 0x00309, 0x01ec3 },
+    { 0x000ef, 0x00301, 0x01e2f },
+    { 0x000f4, 0x00300, 0x01ed3 },
+    { 0x000f4, 0x00301, 0x01ed1 },
+    { 0x000f4, 0x00303, 0x01ed7 },
+    { 0x000f4, 0x00309, 0x01ed5 },
+    { 0x000f5, 0x00301, 0x01e4d },
+    { 0x000f5, 0x00304, 0x0022d },
+    { 0x000f5, 0x00308, 0x01e4f },
+    { 0x000f6, 0x00304, 0x0022b },
+    { 0x000f8, 0x00301, 0x001ff },
+    { 0x000fc, 0x00300, 0x001dc },
+    { 0x000fc, 0x00301, 0x001d8 },
+    { 0x000fc, 0x00304, 0x001d6 },
+    { 0x000fc, 0x0030c, 0x001da },
+    { 0x00102, 0x00300, 0x01eb0 },
+    { 0x00102, 0x00301, 0x01eae },
+    { 0x00102, 0x00303, 0x01eb4 },
+    { 0x00102, 0x00309, 0x01eb2 },
+    { 0x00103, 0x00300, 0x01eb1 },
+    { 0x00103, 0x00301, 0x01eaf },
+    { 0x00103, 0x00303, 0x01eb5 },
+    { 0x00103, 0x00309, 0x01eb3 },
+    { 0x00112, 0x00300, 0x01e14 },
+    { 0x00112, 0x00301, 0x01e16 },
+    { 0x00113, 0x00300, 0x01e15 },
+    { 0x00113, 0x00301, 0x01e17 },
+    { 0x0014c, 0x00300, 0x01e50 },
+    { 0x0014c, 0x00301, 0x01e52 },
+    { 0x0014d, 0x00300, 0x01e51 },
+    { 0x0014d, 0x00301, 0x01e53 },
+    { 0x0015a, 0x00307, 0x01e64 },
+    { 0x0015b, 0x00307, 0x01e65 },
+    { 0x00160, 0x00307, 0x01e66 },
+    { 0x00161, 0x00307, 0x01e67 },
+    { 0x00168, 0x00301, 0x01e78 },
+    { 0x00169, 0x00301, 0x01e79 },
+    { 0x0016a, 0x00308, 0x01e7a },
+    { 0x0016b, 0x00308, 0x01e7b },
+    { 0x0017f, 0x00307, 0x01e9b },
+    { 0x001a0, 0x00300, 0x01edc },
+    { 0x001a0, 0x00301, 0x01eda },
+    { 0x001a0, 0x00303, 0x01ee0 },
+    { 0x001a0, 0x00309, 0x01ede },
+    { 0x001a0, 0x00323, 0x01ee2 },
+    { 0x001a1, 0x00300, 0x01edd },
+    { 0x001a1, 0x00301, 0x01edb },
+    { 0x001a1, 0x00303, 0x01ee1 },
+    { 0x001a1, 0x00309, 0x01edf },
+    { 0x001a1, 0x00323, 0x01ee3 },
+    { 0x001af, 0x00300, 0x01eea },
+    { 0x001af, 0x00301, 0x01ee8 },
+    { 0x001af, 0x00303, 0x01eee },
+    { 0x001af, 0x00309, 0x01eec },
+    { 0x001af, 0x00323, 0x01ef0 },
+    { 0x001b0, 0x00300, 0x01eeb },
+    { 0x001b0, 0x00301, 0x01ee9 },
+    { 0x001b0, 0x00303, 0x01eef },
+    { 0x001b0, 0x00309, 0x01eed },
+    { 0x001b0, 0x00323, 0x01ef1 },
+    { 0x001b7, 0x0030c, 0x001ee },
+    { 0x001ea, 0x00304, 0x001ec },
+    { 0x001eb, 0x00304, 0x001ed },
+    { 0x00226, 0x00304, 0x001e0 },
+    { 0x00227, 0x00304, 0x001e1 },
+    { 0x00228, 0x00306, 0x01e1c },
+    { 0x00229, 0x00306, 0x01e1d },
+    { 0x0022e, 0x00304, 0x00230 },
+    { 0x0022f, 0x00304, 0x00231 },
+    { 0x00292, 0x0030c, 0x001ef },
+    { 0x00391, 0x00300, 0x01fba },
+    { 0x00391, 0x00301, 0x00386 },
+    { 0x00391, 0x00304, 0x01fb9 },
+    { 0x00391, 0x00306, 0x01fb8 },
+    { 0x00391, 0x00313, 0x01f08 },
+    { 0x00391, 0x00314, 0x01f09 },
+    { 0x00391, 0x00345, 0x01fbc },
+    { 0x00395, 0x00300, 0x01fc8 },
+    { 0x00395, 0x00301, 0x00388 },
+    { 0x00395, 0x00313, 0x01f18 },
+    { 0x00395, 0x00314, 0x01f19 },
+    { 0x00397, 0x00300, 0x01fca },
+    { 0x00397, 0x00301, 0x00389 },
+    { 0x00397, 0x00313, 0x01f28 },
+    { 0x00397, 0x00314, 0x01f29 },
+    { 0x00397, 0x00345, 0x01fcc },
+    { 0x00399, 0x00300, 0x01fda },
+    { 0x00399, 0x00301, 0x0038a },
+    { 0x00399, 0x00304, 0x01fd9 },
+    { 0x00399, 0x00306, 0x01fd8 },
+    { 0x00399, 0x00308, 0x003aa },
+    { 0x00399, 0x00313, 0x01f38 },
+    { 0x00399, 0x00314, 0x01f39 },
+    { 0x0039f, 0x00300, 0x01ff8 },
+    { 0x0039f, 0x00301, 0x0038c },
+    { 0x0039f, 0x00313, 0x01f48 },
+    { 0x0039f, 0x00314, 0x01f49 },
+    { 0x003a1, 0x00314, 0x01fec },
+    { 0x003a5, 0x00300, 0x01fea },
+    { 0x003a5, 0x00301, 0x0038e },
+    { 0x003a5, 0x00304, 0x01fe9 },
+    { 0x003a5, 0x00306, 0x01fe8 },
+    { 0x003a5, 0x00308, 0x003ab },
+    { 0x003a5, 0x00314, 0x01f59 },
+    { 0x003a9, 0x00300, 0x01ffa },
+    { 0x003a9, 0x00301, 0x0038f },
+    { 0x003a9, 0x00313, 0x01f68 },
+    { 0x003a9, 0x00314, 0x01f69 },
+    { 0x003a9, 0x00345, 0x01ffc },
+    { 0x003ac, 0x00345, 0x01fb4 },
+    { 0x003ae, 0x00345, 0x01fc4 },
+    { 0x003b1, 0x00300, 0x01f70 },
+    { 0x003b1, 0x00301, 0x003ac },
+    { 0x003b1, 0x00304, 0x01fb1 },
+    { 0x003b1, 0x00306, 0x01fb0 },
+    { 0x003b1, 0x00313, 0x01f00 },
+    { 0x003b1, 0x00314, 0x01f01 },
+    { 0x003b1, 0x00342, 0x01fb6 },
+    { 0x003b1, 0x00345, 0x01fb3 },
+    { 0x003b5, 0x00300, 0x01f72 },
+    { 0x003b5, 0x00301, 0x003ad },
+    { 0x003b5, 0x00313, 0x01f10 },
+    { 0x003b5, 0x00314, 0x01f11 },
+    { 0x003b7, 0x00300, 0x01f74 },
+    { 0x003b7, 0x00301, 0x003ae },
+    { 0x003b7, 0x00313, 0x01f20 },
+    { 0x003b7, 0x00314, 0x01f21 },
+    { 0x003b7, 0x00342, 0x01fc6 },
+    { 0x003b7, 0x00345, 0x01fc3 },
+    { 0x003b9, 0x00300, 0x01f76 },
+    { 0x003b9, 0x00301, 0x003af },
+    { 0x003b9, 0x00304, 0x01fd1 },
+    { 0x003b9, 0x00306, 0x01fd0 },
+    { 0x003b9, 0x00308, 0x003ca },
+    { 0x003b9, 0x00313, 0x01f30 },
+    { 0x003b9, 0x00314, 0x01f31 },
+    { 0x003b9, 0x00342, 0x01fd6 },
+    { 0x003bf, 0x00300, 0x01f78 },
+    { 0x003bf, 0x00301, 0x003cc },
+    { 0x003bf, 0x00313, 0x01f40 },
+    { 0x003bf, 0x00314, 0x01f41 },
+    { 0x003c1, 0x00313, 0x01fe4 },
+    { 0x003c1, 0x00314, 0x01fe5 },
+    { 0x003c5, 0x00300, 0x01f7a },
+    { 0x003c5, 0x00301, 0x003cd },
+    { 0x003c5, 0x00304, 0x01fe1 },
+    { 0x003c5, 0x00306, 0x01fe0 },
+    { 0x003c5, 0x00308, 0x003cb },
+    { 0x003c5, 0x00313, 0x01f50 },
+    { 0x003c5, 0x00314, 0x01f51 },
+    { 0x003c5, 0x00342, 0x01fe6 },
+    { 0x003c9, 0x00300, 0x01f7c },
+    { 0x003c9, 0x00301, 0x003ce },
+    { 0x003c9, 0x00313, 0x01f60 },
+    { 0x003c9, 0x00314, 0x01f61 },
+    { 0x003c9, 0x00342, 0x01ff6 },
+    { 0x003c9, 0x00345, 0x01ff3 },
+    { 0x003ca, 0x00300, 0x01fd2 },
+    { 0x003ca, 0x00301, 0x00390 },
+    { 0x003ca, 0x00342, 0x01fd7 },
+    { 0x003cb, 0x00300, 0x01fe2 },
+    { 0x003cb, 0x00301, 0x003b0 },
+    { 0x003cb, 0x00342, 0x01fe7 },
+    { 0x003ce, 0x00345, 0x01ff4 },
+    { 0x003d2, 0x00301, 0x003d3 },
+    { 0x003d2, 0x00308, 0x003d4 },
+    { 0x00406, 0x00308, 0x00407 },
+    { 0x00410, 0x00306, 0x004d0 },
+    { 0x00410, 0x00308, 0x004d2 },
+    { 0x00413, 0x00301, 0x00403 },
+    { 0x00415, 0x00300, 0x00400 },
+    { 0x00415, 0x00306, 0x004d6 },
+    { 0x00415, 0x00308, 0x00401 },
+    { 0x00416, 0x00306, 0x004c1 },
+    { 0x00416, 0x00308, 0x004dc },
+    { 0x00417, 0x00308, 0x004de },
+    { 0x00418, 0x00300, 0x0040d },
+    { 0x00418, 0x00304, 0x004e2 },
+    { 0x00418, 0x00306, 0x00419 },
+    { 0x00418, 0x00308, 0x004e4 },
+    { 0x0041a, 0x00301, 0x0040c },
+    { 0x0041e, 0x00308, 0x004e6 },
+    { 0x00423, 0x00304, 0x004ee },
+    { 0x00423, 0x00306, 0x0040e },
+    { 0x00423, 0x00308, 0x004f0 },
+    { 0x00423, 0x0030b, 0x004f2 },
+    { 0x00427, 0x00308, 0x004f4 },
+    { 0x0042b, 0x00308, 0x004f8 },
+    { 0x0042d, 0x00308, 0x004ec },
+    { 0x00430, 0x00306, 0x004d1 },
+    { 0x00430, 0x00308, 0x004d3 },
+    { 0x00433, 0x00301, 0x00453 },
+    { 0x00435, 0x00300, 0x00450 },
+    { 0x00435, 0x00306, 0x004d7 },
+    { 0x00435, 0x00308, 0x00451 },
+    { 0x00436, 0x00306, 0x004c2 },
+    { 0x00436, 0x00308, 0x004dd },
+    { 0x00437, 0x00308, 0x004df },
+    { 0x00438, 0x00300, 0x0045d },
+    { 0x00438, 0x00304, 0x004e3 },
+    { 0x00438, 0x00306, 0x00439 },
+    { 0x00438, 0x00308, 0x004e5 },
+    { 0x0043a, 0x00301, 0x0045c },
+    { 0x0043e, 0x00308, 0x004e7 },
+    { 0x00443, 0x00304, 0x004ef },
+    { 0x00443, 0x00306, 0x0045e },
+    { 0x00443, 0x00308, 0x004f1 },
+    { 0x00443, 0x0030b, 0x004f3 },
+    { 0x00447, 0x00308, 0x004f5 },
+    { 0x0044b, 0x00308, 0x004f9 },
+    { 0x0044d, 0x00308, 0x004ed },
+    { 0x00456, 0x00308, 0x00457 },
+    { 0x00474, 0x0030f, 0x00476 },
+    { 0x00475, 0x0030f, 0x00477 },
+    { 0x004d8, 0x00308, 0x004da },
+    { 0x004d9, 0x00308, 0x004db },
+    { 0x004e8, 0x00308, 0x004ea },
+    { 0x004e9, 0x00308, 0x004eb },
+    { 0x00627, 0x00653, 0x00622 },
+    { 0x00627, 0x00654, 0x00623 },
+    { 0x00627, 0x00655, 0x00625 },
+    { 0x00648, 0x00654, 0x00624 },
+    { 0x0064a, 0x00654, 0x00626 },
+    { 0x006c1, 0x00654, 0x006c2 },
+    { 0x006d2, 0x00654, 0x006d3 },
+    { 0x006d5, 0x00654, 0x006c0 },
+    { 0x00928, 0x0093c, 0x00929 },
+    { 0x00930, 0x0093c, 0x00931 },
+    { 0x00933, 0x0093c, 0x00934 },
+    { 0x009c7, 0x009be, 0x009cb },
+    { 0x009c7, 0x009d7, 0x009cc },
+    { 0x00b47, 0x00b3e, 0x00b4b },
+    { 0x00b47, 0x00b56, 0x00b48 },
+    { 0x00b47, 0x00b57, 0x00b4c },
+    { 0x00b92, 0x00bd7, 0x00b94 },
+    { 0x00bc6, 0x00bbe, 0x00bca },
+    { 0x00bc6, 0x00bd7, 0x00bcc },
+    { 0x00bc7, 0x00bbe, 0x00bcb },
+    { 0x00c46, 0x00c56, 0x00c48 },
+    { 0x00cbf, 0x00cd5, 0x00cc0 },
+    { 0x00cc6, 0x00cc2, 0x00cca },
+    { 0x00cc6, 0x00cd5, 0x00cc7 },
+    { 0x00cc6, 0x00cd6, 0x00cc8 },
+    { 0x00cca, 0x00cd5, 0x00ccb },
+    { 0x00d46, 0x00d3e, 0x00d4a },
+    { 0x00d46, 0x00d57, 0x00d4c },
+    { 0x00d47, 0x00d3e, 0x00d4b },
+    { 0x00dd9, 0x00dca, 0x00dda },
+    { 0x00dd9, 0x00dcf, 0x00ddc },
+    { 0x00dd9, 0x00ddf, 0x00dde },
+    { 0x00ddc, 0x00dca, 0x00ddd },
+    { 0x01025, 0x0102e, 0x01026 },
+    { 0x01b05, 0x01b35, 0x01b06 },
+    { 0x01b07, 0x01b35, 0x01b08 },
+    { 0x01b09, 0x01b35, 0x01b0a },
+    { 0x01b0b, 0x01b35, 0x01b0c },
+    { 0x01b0d, 0x01b35, 0x01b0e },
+    { 0x01b11, 0x01b35, 0x01b12 },
+    { 0x01b3a, 0x01b35, 0x01b3b },
+    { 0x01b3c, 0x01b35, 0x01b3d },
+    { 0x01b3e, 0x01b35, 0x01b40 },
+    { 0x01b3f, 0x01b35, 0x01b41 },
+    { 0x01b42, 0x01b35, 0x01b43 },
+    { 0x01e36, 0x00304, 0x01e38 },
+    { 0x01e37, 0x00304, 0x01e39 },
+    { 0x01e5a, 0x00304, 0x01e5c },
+    { 0x01e5b, 0x00304, 0x01e5d },
+    { 0x01e62, 0x00307, 0x01e68 },
+    { 0x01e63, 0x00307, 0x01e69 },
+    { 0x01ea0, 0x00302, 0x01eac },
+    { 0x01ea0, 0x00306, 0x01eb6 },
+    { 0x01ea1, 0x00302, 0x01ead },
+    { 0x01ea1, 0x00306, 0x01eb7 },
+    { 0x01eb8, 0x00302, 0x01ec6 },
+    { 0x01eb9, 0x00302, 0x01ec7 },
+    { 0x01ecc, 0x00302, 0x01ed8 },
+    { 0x01ecd, 0x00302, 0x01ed9 },
+    { 0x01f00, 0x00300, 0x01f02 },
+    { 0x01f00, 0x00301, 0x01f04 },
+    { 0x01f00, 0x00342, 0x01f06 },
+    { 0x01f00, 0x00345, 0x01f80 },
+    { 0x01f01, 0x00300, 0x01f03 },
+    { 0x01f01, 0x00301, 0x01f05 },
+    { 0x01f01, 0x00342, 0x01f07 },
+    { 0x01f01, 0x00345, 0x01f81 },
+    { 0x01f02, 0x00345, 0x01f82 },
+    { 0x01f03, 0x00345, 0x01f83 },
+    { 0x01f04, 0x00345, 0x01f84 },
+    { 0x01f05, 0x00345, 0x01f85 },
+    { 0x01f06, 0x00345, 0x01f86 },
+    { 0x01f07, 0x00345, 0x01f87 },
+    { 0x01f08, 0x00300, 0x01f0a },
+    { 0x01f08, 0x00301, 0x01f0c },
+    { 0x01f08, 0x00342, 0x01f0e },
+    { 0x01f08, 0x00345, 0x01f88 },
+    { 0x01f09, 0x00300, 0x01f0b },
+    { 0x01f09, 0x00301, 0x01f0d },
+    { 0x01f09, 0x00342, 0x01f0f },
+    { 0x01f09, 0x00345, 0x01f89 },
+    { 0x01f0a, 0x00345, 0x01f8a },
+    { 0x01f0b, 0x00345, 0x01f8b },
+    { 0x01f0c, 0x00345, 0x01f8c },
+    { 0x01f0d, 0x00345, 0x01f8d },
+    { 0x01f0e, 0x00345, 0x01f8e },
+    { 0x01f0f, 0x00345, 0x01f8f },
+    { 0x01f10, 0x00300, 0x01f12 },
+    { 0x01f10, 0x00301, 0x01f14 },
+    { 0x01f11, 0x00300, 0x01f13 },
+    { 0x01f11, 0x00301, 0x01f15 },
+    { 0x01f18, 0x00300, 0x01f1a },
+    { 0x01f18, 0x00301, 0x01f1c },
+    { 0x01f19, 0x00300, 0x01f1b },
+    { 0x01f19, 0x00301, 0x01f1d },
+    { 0x01f20, 0x00300, 0x01f22 },
+    { 0x01f20, 0x00301, 0x01f24 },
+    { 0x01f20, 0x00342, 0x01f26 },
+    { 0x01f20, 0x00345, 0x01f90 },
+    { 0x01f21, 0x00300, 0x01f23 },
+    { 0x01f21, 0x00301, 0x01f25 },
+    { 0x01f21, 0x00342, 0x01f27 },
+    { 0x01f21, 0x00345, 0x01f91 },
+    { 0x01f22, 0x00345, 0x01f92 },
+    { 0x01f23, 0x00345, 0x01f93 },
+    { 0x01f24, 0x00345, 0x01f94 },
+    { 0x01f25, 0x00345, 0x01f95 },
+    { 0x01f26, 0x00345, 0x01f96 },
+    { 0x01f27, 0x00345, 0x01f97 },
+    { 0x01f28, 0x00300, 0x01f2a },
+    { 0x01f28, 0x00301, 0x01f2c },
+    { 0x01f28, 0x00342, 0x01f2e },
+    { 0x01f28, 0x00345, 0x01f98 },
+    { 0x01f29, 0x00300, 0x01f2b },
+    { 0x01f29, 0x00301, 0x01f2d },
+    { 0x01f29, 0x00342, 0x01f2f },
+    { 0x01f29, 0x00345, 0x01f99 },
+    { 0x01f2a, 0x00345, 0x01f9a },
+    { 0x01f2b, 0x00345, 0x01f9b },
+    { 0x01f2c, 0x00345, 0x01f9c },
+    { 0x01f2d, 0x00345, 0x01f9d },
+    { 0x01f2e, 0x00345, 0x01f9e },
+    { 0x01f2f, 0x00345, 0x01f9f },
+    { 0x01f30, 0x00300, 0x01f32 },
+    { 0x01f30, 0x00301, 0x01f34 },
+    { 0x01f30, 0x00342, 0x01f36 },
+    { 0x01f31, 0x00300, 0x01f33 },
+    { 0x01f31, 0x00301, 0x01f35 },
+    { 0x01f31, 0x00342, 0x01f37 },
+    { 0x01f38, 0x00300, 0x01f3a },
+    { 0x01f38, 0x00301, 0x01f3c },
+    { 0x01f38, 0x00342, 0x01f3e },
+    { 0x01f39, 0x00300, 0x01f3b },
+    { 0x01f39, 0x00301, 0x01f3d },
+    { 0x01f39, 0x00342, 0x01f3f },
+    { 0x01f40, 0x00300, 0x01f42 },
+    { 0x01f40, 0x00301, 0x01f44 },
+    { 0x01f41, 0x00300, 0x01f43 },
+    { 0x01f41, 0x00301, 0x01f45 },
+    { 0x01f48, 0x00300, 0x01f4a },
+    { 0x01f48, 0x00301, 0x01f4c },
+    { 0x01f49, 0x00300, 0x01f4b },
+    { 0x01f49, 0x00301, 0x01f4d },
+    { 0x01f50, 0x00300, 0x01f52 },
+    { 0x01f50, 0x00301, 0x01f54 },
+    { 0x01f50, 0x00342, 0x01f56 },
+    { 0x01f51, 0x00300, 0x01f53 },
+    { 0x01f51, 0x00301, 0x01f55 },
+    { 0x01f51, 0x00342, 0x01f57 },
+    { 0x01f59, 0x00300, 0x01f5b },
+    { 0x01f59, 0x00301, 0x01f5d },
+    { 0x01f59, 0x00342, 0x01f5f },
+    { 0x01f60, 0x00300, 0x01f62 },
+    { 0x01f60, 0x00301, 0x01f64 },
+    { 0x01f60, 0x00342, 0x01f66 },
+    { 0x01f60, 0x00345, 0x01fa0 },
+    { 0x01f61, 0x00300, 0x01f63 },
+    { 0x01f61, 0x00301, 0x01f65 },
+    { 0x01f61, 0x00342, 0x01f67 },
+    { 0x01f61, 0x00345, 0x01fa1 },
+    { 0x01f62, 0x00345, 0x01fa2 },
+    { 0x01f63, 0x00345, 0x01fa3 },
+    { 0x01f64, 0x00345, 0x01fa4 },
+    { 0x01f65, 0x00345, 0x01fa5 },
+    { 0x01f66, 0x00345, 0x01fa6 },
+    { 0x01f67, 0x00345, 0x01fa7 },
+    { 0x01f68, 0x00300, 0x01f6a },
+    { 0x01f68, 0x00301, 0x01f6c },
+    { 0x01f68, 0x00342, 0x01f6e },
+    { 0x01f68, 0x00345, 0x01fa8 },
+    { 0x01f69, 0x00300, 0x01f6b },
+    { 0x01f69, 0x00301, 0x01f6d },
+    { 0x01f69, 0x00342, 0x01f6f },
+    { 0x01f69, 0x00345, 0x01fa9 },
+    { 0x01f6a, 0x00345, 0x01faa },
+    { 0x01f6b, 0x00345, 0x01fab },
+    { 0x01f6c, 0x00345, 0x01fac },
+    { 0x01f6d, 0x00345, 0x01fad },
+    { 0x01f6e, 0x00345, 0x01fae },
+    { 0x01f6f, 0x00345, 0x01faf },
+    { 0x01f70, 0x00345, 0x01fb2 },
+    { 0x01f74, 0x00345, 0x01fc2 },
+    { 0x01f7c, 0x00345, 0x01ff2 },
+    { 0x01fb6, 0x00345, 0x01fb7 },
+    { 0x01fbf, 0x00300, 0x01fcd },
+    { 0x01fbf, 0x00301, 0x01fce },
+    { 0x01fbf, 0x00342, 0x01fcf },
+    { 0x01fc6, 0x00345, 0x01fc7 },
+    { 0x01ff6, 0x00345, 0x01ff7 },
+    { 0x01ffe, 0x00300, 0x01fdd },
+    { 0x01ffe, 0x00301, 0x01fde },
+    { 0x01ffe, 0x00342, 0x01fdf },
+    { 0x02190, 0x00338, 0x0219a },
+    { 0x02192, 0x00338, 0x0219b },
+    { 0x02194, 0x00338, 0x021ae },
+    { 0x021d0, 0x00338, 0x021cd },
+    { 0x021d2, 0x00338, 0x021cf },
+    { 0x021d4, 0x00338, 0x021ce },
+    { 0x02203, 0x00338, 0x02204 },
+    { 0x02208, 0x00338, 0x02209 },
+    { 0x0220b, 0x00338, 0x0220c },
+    { 0x02223, 0x00338, 0x02224 },
+    { 0x02225, 0x00338, 0x02226 },
+    { 0x0223c, 0x00338, 0x02241 },
+    { 0x02243, 0x00338, 0x02244 },
+    { 0x02245, 0x00338, 0x02247 },
+    { 0x02248, 0x00338, 0x02249 },
+    { 0x0224d, 0x00338, 0x0226d },
+    { 0x02261, 0x00338, 0x02262 },
+    { 0x02264, 0x00338, 0x02270 },
+    { 0x02265, 0x00338, 0x02271 },
+    { 0x02272, 0x00338, 0x02274 },
+    { 0x02273, 0x00338, 0x02275 },
+    { 0x02276, 0x00338, 0x02278 },
+    { 0x02277, 0x00338, 0x02279 },
+    { 0x0227a, 0x00338, 0x02280 },
+    { 0x0227b, 0x00338, 0x02281 },
+    { 0x0227c, 0x00338, 0x022e0 },
+    { 0x0227d, 0x00338, 0x022e1 },
+    { 0x02282, 0x00338, 0x02284 },
+    { 0x02283, 0x00338, 0x02285 },
+    { 0x02286, 0x00338, 0x02288 },
+    { 0x02287, 0x00338, 0x02289 },
+    { 0x02291, 0x00338, 0x022e2 },
+    { 0x02292, 0x00338, 0x022e3 },
+    { 0x022a2, 0x00338, 0x022ac },
+    { 0x022a8, 0x00338, 0x022ad },
+    { 0x022a9, 0x00338, 0x022ae },
+    { 0x022ab, 0x00338, 0x022af },
+    { 0x022b2, 0x00338, 0x022ea },
+    { 0x022b3, 0x00338, 0x022eb },
+    { 0x022b4, 0x00338, 0x022ec },
+    { 0x022b5, 0x00338, 0x022ed },
+    { 0x03046, 0x03099, 0x03094 },
+    { 0x0304b, 0x03099, 0x0304c },
+    { 0x0304d, 0x03099, 0x0304e },
+    { 0x0304f, 0x03099, 0x03050 },
+    { 0x03051, 0x03099, 0x03052 },
+    { 0x03053, 0x03099, 0x03054 },
+    { 0x03055, 0x03099, 0x03056 },
+    { 0x03057, 0x03099, 0x03058 },
+    { 0x03059, 0x03099, 0x0305a },
+    { 0x0305b, 0x03099, 0x0305c },
+    { 0x0305d, 0x03099, 0x0305e },
+    { 0x0305f, 0x03099, 0x03060 },
+    { 0x03061, 0x03099, 0x03062 },
+    { 0x03064, 0x03099, 0x03065 },
+    { 0x03066, 0x03099, 0x03067 },
+    { 0x03068, 0x03099, 0x03069 },
+    { 0x0306f, 0x03099, 0x03070 },
+    { 0x0306f, 0x0309a, 0x03071 },
+    { 0x03072, 0x03099, 0x03073 },
+    { 0x03072, 0x0309a, 0x03074 },
+    { 0x03075, 0x03099, 0x03076 },
+    { 0x03075, 0x0309a, 0x03077 },
+    { 0x03078, 0x03099, 0x03079 },
+    { 0x03078, 0x0309a, 0x0307a },
+    { 0x0307b, 0x03099, 0x0307c },
+    { 0x0307b, 0x0309a, 0x0307d },
+    { 0x0309d, 0x03099, 0x0309e },
+    { 0x030a6, 0x03099, 0x030f4 },
+    { 0x030ab, 0x03099, 0x030ac },
+    { 0x030ad, 0x03099, 0x030ae },
+    { 0x030af, 0x03099, 0x030b0 },
+    { 0x030b1, 0x03099, 0x030b2 },
+    { 0x030b3, 0x03099, 0x030b4 },
+    { 0x030b5, 0x03099, 0x030b6 },
+    { 0x030b7, 0x03099, 0x030b8 },
+    { 0x030b9, 0x03099, 0x030ba },
+    { 0x030bb, 0x03099, 0x030bc },
+    { 0x030bd, 0x03099, 0x030be },
+    { 0x030bf, 0x03099, 0x030c0 },
+    { 0x030c1, 0x03099, 0x030c2 },
+    { 0x030c4, 0x03099, 0x030c5 },
+    { 0x030c6, 0x03099, 0x030c7 },
+    { 0x030c8, 0x03099, 0x030c9 },
+    { 0x030cf, 0x03099, 0x030d0 },
+    { 0x030cf, 0x0309a, 0x030d1 },
+    { 0x030d2, 0x03099, 0x030d3 },
+    { 0x030d2, 0x0309a, 0x030d4 },
+    { 0x030d5, 0x03099, 0x030d6 },
+    { 0x030d5, 0x0309a, 0x030d7 },
+    { 0x030d8, 0x03099, 0x030d9 },
+    { 0x030d8, 0x0309a, 0x030da },
+    { 0x030db, 0x03099, 0x030dc },
+    { 0x030db, 0x0309a, 0x030dd },
+    { 0x030ef, 0x03099, 0x030f7 },
+    { 0x030f0, 0x03099, 0x030f8 },
+    { 0x030f1, 0x03099, 0x030f9 },
+    { 0x030f2, 0x03099, 0x030fa },
+    { 0x030fd, 0x03099, 0x030fe },
+    { 0x11099, 0x110ba, 0x1109a },
+    { 0x1109b, 0x110ba, 0x1109c },
+    { 0x110a5, 0x110ba, 0x110ab },
+    { 0x11131, 0x11127, 0x1112e },
+    { 0x11132, 0x11127, 0x1112f },
+    { 0x11347, 0x1133e, 0x1134b },
+    { 0x11347, 0x11357, 0x1134c },
+    { 0x114b9, 0x114b0, 0x114bc },
+    { 0x114b9, 0x114ba, 0x114bb },
+    { 0x114b9, 0x114bd, 0x114be },
+    { 0x115b8, 0x115af, 0x115ba },
+    { 0x115b9, 0x115af, 0x115bb },
+    { 0x11935, 0x11930, 0x11938 },
+};
@@ -0,0 +1,101 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <stdlib.h>
+#include <string.h>
+#include "Arena.h"
+
+
+// The size of most blocks. Bigger allocations get a block to themselves.
+#define ARENA_BLOCK_SIZE            (256 * 1024)
+
+
+namespace
+{
+    // Each block starts with a link to the block before it.
+    typedef struct ArenaBlock
+    {
+        ArenaBlock     *previous;           // The block before, or NULL
+
+    } ArenaBlock;
+}
+
+
+// ----------------------------------------------------------------------------
+// Allocates from the current block, starting a new one when it's full.
+// ----------------------------------------------------------------------------
+void *ArenaAlloc(Arena &arena, size_t size, size_t align)
+{
+    size_t start = (arena.used + align - 1) & ~(align - 1);
+
+    if (arena.block == NULL || start + size > arena.size)
+    {
+        size_t blockSize = sizeof(ArenaBlock) + size + align;
+        if (blockSize < ARENA_BLOCK_SIZE)
+            blockSize = ARENA_BLOCK_SIZE;
+
+        u8 *block = (u8*)malloc(blockSize);
+        if (block == NULL)
+            return NULL;
+
+        ((ArenaBlock*)block)->previous = (ArenaBlock*)arena.block;
+
+        arena.block  = block;
+        arena.used   = sizeof(ArenaBlock);
+        arena.size   = blockSize;
+        arena.total += blockSize;
+
+        start = (arena.used + align - 1) & ~(align - 1);
+    }
+
+    arena.used = start + size;
+    return arena.block + start;
+}
+
+
+// ----------------------------------------------------------------------------
+// Copies a string into the arena.
+// ----------------------------------------------------------------------------
+char *ArenaString(Arena &arena, const char *string, size_t length)
+{
+    char *copy = (char*)ArenaAlloc(arena, length + 1);
+    if (copy)
+    {
+        memcpy(copy, string, length);
+        copy[length] = 0;
+    }
+
+    return copy;
+}
+
+
+// ----------------------------------------------------------------------------
+// Frees every block.
+// ----------------------------------------------------------------------------
+void ArenaFree(Arena &arena)
+{
+    ArenaBlock *block = (ArenaBlock*)arena.block;
+
+    while (block)
+    {
+        ArenaBlock *previous = block->previous;
+        free(block);
+        block = previous;
+    }
+
+    memset(&arena, 0, sizeof(Arena));
+}
@@ -0,0 +1,45 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <stddef.h>
+#include "ArcEntry.h"
+
+
+// A bump allocator for many small blocks that are all freed together, such
+// as the names found by a directory scan. Blocks can't be freed one by one.
+typedef struct Arena
+{
+    u8         *block;                      // The current block
+    size_t      used;                       // The bytes used in the current block
+    size_t      size;                       // The size of the current block
+    size_t      total;                      // The bytes allocated by every block
+
+} Arena;
+
+
+// Allocates size bytes, aligned to align, which must be a power of two.
+// Returns NULL if out of memory.
+void       *ArenaAlloc(Arena &arena, size_t size, size_t align = 1);
+
+// Copies length chars of a string into the arena and terminates it.
+char       *ArenaString(Arena &arena, const char *string, size_t length);
+
+// Frees every block.
+void        ArenaFree(Arena &arena);
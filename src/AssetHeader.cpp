@@ -0,0 +1,253 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+#include <map>
+#include <string>
+#include <algorithm>
+#include "AssetHeader.h"
+#include "Path.h"
+
+
+// Identifiers are lined up to this width.
+#define HEADER_COLUMN       40
+
+
+namespace
+{
+    // C++ keywords, which get a '_' added when a name makes one.
+    const char *keywords[] =
+    {
+        "alignas", "alignof", "and", "and_eq", "asm", "auto", "bitand", "bitor", "bool", "break",
+        "case", "catch", "char", "char16_t", "char32_t", "class", "compl", "const", "constexpr",
+        "const_cast", "continue", "decltype", "default", "delete", "do", "double", "dynamic_cast",
+        "else", "enum", "explicit", "export", "extern", "false", "float", "for", "friend", "goto",
+        "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "not_eq",
+        "nullptr", "operator", "or", "or_eq", "private", "protected", "public", "register",
+        "reinterpret_cast", "return", "short", "signed", "sizeof", "static", "static_assert",
+        "static_cast", "struct", "switch", "template", "this", "thread_local", "throw", "true",
+        "try", "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void",
+        "volatile", "wchar_t", "while", "xor", "xor_eq",
+    };
+
+
+    // ------------------------------------------------------------------------
+    // Orders assets by name, so the header reads like a directory listing.
+    // ------------------------------------------------------------------------
+    bool AssetNameLess(const AssetName &lhs, const AssetName &rhs)
+    {
+        return strcmp(lhs.name, rhs.name) < 0;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Adds a '_' to an identifier, unless it already ends with one.
+    // ------------------------------------------------------------------------
+    void AddSeparator(std::string &id)
+    {
+        if (id.empty() || id[id.size() - 1] != '_')
+        {
+            id += '_';
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Makes a C++ identifier from a UTF-8 name. Other ASCII characters become
+    // a '_', and runs of them are merged, so "textures/logo.png" becomes
+    // textures_logo_png. Other characters are spelt as code points, so
+    // "café.png" becomes caf_u00e9_png. An identifier starting with a '_' or
+    // a digit would be reserved or invalid, so "_Foo.png" becomes
+    // asset_Foo_png.
+    // ------------------------------------------------------------------------
+    void MakeIdentifier(const char *name, std::string &id)
+    {
+        id.clear();
+
+        for (const u8 *p=(const u8*)name; *p; )
+        {
+            u8 c = *p++;
+
+            if ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9'))
+            {
+                id += (char)c;
+                continue;
+            }
+
+            if (c < 0x80)
+            {
+                AddSeparator(id);
+                continue;
+            }
+
+            // Gather the sequence. Stray bytes are spelt as they are.
+            u32 count = (c >= 0xf0) ? 3 : (c >= 0xe0) ? 2 : (c >= 0xc0) ? 1 : 0;
+            u32 code  = c & (0x3f >> count);
+            u32 got   = 0;
+
+            while (got < count && (*p & 0xc0) == 0x80)
+            {
+                code = (code << 6) | (*p++ & 0x3f);
+                got++;
+            }
+
+            char spelt[16];
+            sprintf_s(spelt, sizeof(spelt), "u%04x", (count > 0 && got == count) ? code : c);
+
+            AddSeparator(id);
+            id += spelt;
+            id += '_';
+        }
+
+        // Trailing separators from code points aren't wanted.
+        if (!id.empty() && id[id.size() - 1] == '_')
+        {
+            id.erase(id.size() - 1);
+        }
+
+        // Only a letter may start it. The separator is kept to one '_', as a
+        // double underscore is reserved too.
+        if (id.empty() || id[0] == '_' || (id[0] >= '0' && id[0] <= '9'))
+        {
+            if (!id.empty() && id[0] == '_')
+            {
+                id.erase(0, 1);
+            }
+
+            id.insert(0, id.empty() ? "asset" : "asset_");
+        }
+
+        for (size_t i=0; i<sizeof(keywords) / sizeof(*keywords); i++)
+        {
+            if (id == keywords[i])
+            {
+                id += '_';
+                break;
+            }
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Writes the asset header.
+//
+// Names that make the same identifier, or make assetCount, all get their
+// hash added. An identifier then only ever names one asset: adding a clashing
+// name renames the existing constant, which breaks the build rather than
+// quietly pointing game code at the new asset.
+// ----------------------------------------------------------------------------
+bool WriteAssetHeader(const _TCHAR *filename, std::vector<AssetName> &assets)
+{
+    std::sort(assets.begin(), assets.end(), AssetNameLess);
+
+    std::map<std::string, u32> made;
+    std::vector<std::string>   ids(assets.size());
+    size_t                     width = 0;
+
+    // Count the names making each identifier. The header declares
+    // assetCount itself.
+    for (size_t i=0; i<assets.size(); i++)
+    {
+        MakeIdentifier(assets[i].name, ids[i]);
+        made[ids[i]]++;
+    }
+
+    made["assetCount"]++;
+
+    std::map<std::string, size_t> used;
+
+    for (size_t i=0; i<assets.size(); i++)
+    {
+        std::string &id = ids[i];
+
+        if (made[id] > 1)
+        {
+            char suffix[16];
+            sprintf_s(suffix, sizeof(suffix), "_%08x", assets[i].hash);
+            id += suffix;
+        }
+
+        // Names sharing a hash as well, or a name spelling out another's
+        // suffixed identifier, can still clash.
+        if (used.count(id) > 0)
+        {
+            printf("Asset names make the same identifier %s:\n%s\n%s\n", id.c_str(), assets[used[id]].name, assets[i].name);
+            return false;
+        }
+
+        used[id] = i;
+        width    = std::min(std::max(width, id.size()), (size_t)HEADER_COLUMN);
+    }
+
+    // The namespace is the header's filename, without the extension.
+    const _TCHAR *base = filename;
+    for (const _TCHAR *p=filename; *p; p++)
+    {
+        if (*p == L'\\' || *p == L'/')
+        {
+            base = p + 1;
+        }
+    }
+
+    std::string stem;
+    PathUtf8(base, stem);
+    stem = stem.substr(0, stem.rfind('.'));
+
+    std::string space;
+    MakeIdentifier(stem.c_str(), space);
+
+    FILE *fp = NULL;
+    _tfopen_s(&fp, filename, L"w");
+    if (fp == NULL)
+    {
+        printf("Failed to create header:\n%ls\n", filename);
+        return false;
+    }
+
+    fprintf(fp, "// Generated by pat. Do not edit.\n");
+    fprintf(fp, "//\n");
+    fprintf(fp, "// The hash and FAT entry index of each asset. Pass them to ArcFindAsset(),\n");
+    fprintf(fp, "// which uses the index when it's still right, and searches otherwise.\n");
+    fprintf(fp, "\n");
+    fprintf(fp, "#pragma once\n");
+    fprintf(fp, "\n\n");
+    fprintf(fp, "#include \"ArcReader.h\"\n");
+    fprintf(fp, "\n\n");
+    fprintf(fp, "namespace %s\n{\n", space.c_str());
+    fprintf(fp, "    constexpr u32 assetCount = %u;\n\n", (u32)assets.size());
+
+    // Line the names up in a column, unless they're very long.
+    for (size_t i=0; i<assets.size(); i++)
+    {
+        fprintf(fp, "    constexpr ArcAsset %-*s = { 0x%08x, %u };    // %s\n",
+                (int)width, ids[i].c_str(), assets[i].hash, assets[i].index, assets[i].name);
+    }
+
+    fprintf(fp, "}\n");
+
+    if (ferror(fp) || fclose(fp) != 0)
+    {
+        printf("Failed to write header:\n%ls\n", filename);
+        return false;
+    }
+
+    return true;
+}
@@ -0,0 +1,41 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+
+#pragma once
+
+
+#include <tchar.h>
+#include <vector>
+#include "ArcEntry.h"
+
+
+// An entry to name in the asset header.
+typedef struct AssetName
+{
+    const char *name;                       // The archive name
+    u32         hash;                       // The entry hash
+    u32         index;                      // The entry's index in the FAT
+
+} AssetName;
+
+
+// Writes a C++ header with a constant for each asset, giving its hash and
+// entry index. The namespace is named after the header file.
+//
+// filename == The full path of the header to write
+bool WriteAssetHeader(const _TCHAR *filename, std::vector<AssetName> &assets);
@@ -0,0 +1,325 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <string.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "Deflate.h"
+
+
+// The amount of input each thread deflates at a time.
+#define PARALLEL_DEFLATE_BLOCK      (1024 * 1024)
+
+// The deflate window. Each block is primed with this much of the one before.
+#define DEFLATE_WINDOW              (32 * 1024)
+
+// Default zlib memory level.
+#define DEFLATE_MEM_LEVEL           8
+
+
+namespace
+{
+    // One block of the input.
+    typedef struct DeflateBlock
+    {
+        const Bytef        *data;           // The block's input
+        uInt                size;           // The input size
+        uInt                dictionary;     // Bytes before data to prime with
+        bool                last;           // Ends the stream?
+        std::vector<Bytef>  out;            // The raw deflate output
+        uLong               adler;          // Adler-32 of the input
+        int                 err;            // The zlib result
+
+    } DeflateBlock;
+
+
+    // Shared state for the deflate threads.
+    typedef struct DeflateJob
+    {
+        std::vector<DeflateBlock>   blocks; // The blocks
+        std::atomic<size_t>         next;   // The next block to take
+        int                         level;  // The compression level
+
+    } DeflateJob;
+
+
+    // ------------------------------------------------------------------------
+    // Deflates one block to raw deflate data. Every block but the last ends
+    // with a sync flush, so the next block starts on a byte boundary.
+    // ------------------------------------------------------------------------
+    int DeflateBlockData(z_stream &stream, DeflateBlock &block)
+    {
+        int err = deflateReset(&stream);
+
+        // Prime with the end of the previous block, so matches can reach
+        // back across the join.
+        if (err == Z_OK && block.dictionary > 0)
+        {
+            err = deflateSetDictionary(&stream, block.data - block.dictionary, block.dictionary);
+        }
+
+        if (err != Z_OK)
+        {
+            return err;
+        }
+
+        block.out.resize(deflateBound(&stream, block.size) + 16);
+
+        stream.next_in   = (Bytef*)block.data;
+        stream.avail_in  = block.size;
+        stream.next_out  = &block.out[0];
+        stream.avail_out = (uInt)block.out.size();
+
+        int flush = block.last ? Z_FINISH : Z_SYNC_FLUSH;
+        err = deflate(&stream, flush);
+
+        // The bound allows for the flush marker, but grow if it falls short.
+        while (err == Z_OK && (stream.avail_in > 0 || stream.avail_out == 0 || block.last))
+        {
+            size_t used = block.out.size() - stream.avail_out;
+            block.out.resize(block.out.size() * 2);
+
+            stream.next_out  = &block.out[used];
+            stream.avail_out = (uInt)(block.out.size() - used);
+
+            err = deflate(&stream, flush);
+        }
+
+        if ((block.last && err != Z_STREAM_END) || (!block.last && err != Z_OK && err != Z_BUF_ERROR))
+        {
+            return (err == Z_OK || err == Z_STREAM_END) ? Z_BUF_ERROR : err;
+        }
+
+        block.out.resize(block.out.size() - stream.avail_out);
+        return Z_OK;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Deflate thread. Takes blocks until none are left.
+    // ------------------------------------------------------------------------
+    void DeflateThread(DeflateJob *job)
+    {
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+
+        int err = deflateInit2(&stream, job->level, Z_DEFLATED, -MAX_WBITS, DEFLATE_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+
+        for (size_t i=job->next++; i<job->blocks.size(); i=job->next++)
+        {
+            DeflateBlock &block = job->blocks[i];
+
+            block.adler = adler32(adler32(0, NULL, 0), block.data, block.size);
+            block.err   = (err == Z_OK) ? DeflateBlockData(stream, block) : err;
+        }
+
+        if (err == Z_OK)
+        {
+            deflateEnd(&stream);
+        }
+    }
+
+
+    // A zlib stream kept for a thread, with the level it was set up for.
+    typedef struct DeflateContext
+    {
+        z_stream    stream;                 // The stream
+        int         level;                  // Its compression level
+        bool        ready;                  // Has deflateInit() succeeded?
+
+        ~DeflateContext()
+        {
+            if (ready)
+                deflateEnd(&stream);
+        }
+
+    } DeflateContext;
+
+
+    thread_local DeflateContext deflateContext;
+
+
+    // ------------------------------------------------------------------------
+    // Makes the two byte zlib header for a level.
+    // ------------------------------------------------------------------------
+    u32 ZlibHeader(int level)
+    {
+        if (level == Z_DEFAULT_COMPRESSION)
+            level = 6;
+
+        u32 levelFlags = (level < 2) ? 0 : (level < 6) ? 1 : (level == 6) ? 2 : 3;
+        u32 header     = ((Z_DEFLATED + ((MAX_WBITS - 8) << 4)) << 8) | (levelFlags << 6);
+
+        return header + 31 - (header % 31);
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Gets the largest output DeflateParallel() can make. Each block can add a
+// flush marker to compressBound().
+// ----------------------------------------------------------------------------
+uLong DeflateParallelBound(uLong sourceLen)
+{
+    return compressBound(sourceLen) + (sourceLen / PARALLEL_DEFLATE_BLOCK + 1) * 16;
+}
+
+
+// ----------------------------------------------------------------------------
+// Compresses a buffer into one zlib stream using every core.
+//
+// Each block is raw deflated with the previous 32KB as its dictionary, so
+// the output is close to a single stream's. The blocks' Adler-32s are made
+// alongside and combined for the trailer.
+// ----------------------------------------------------------------------------
+int DeflateParallel(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level)
+{
+    u32 threadCount = std::thread::hardware_concurrency();
+
+    if (threadCount < 2 || sourceLen <= PARALLEL_DEFLATE_BLOCK)
+    {
+        return DeflateReuse(dest, destLen, source, sourceLen, level);
+    }
+
+
+    // Split the input.
+    DeflateJob job;
+    job.next  = 0;
+    job.level = level;
+    job.blocks.resize((sourceLen + PARALLEL_DEFLATE_BLOCK - 1) / PARALLEL_DEFLATE_BLOCK);
+
+    for (size_t i=0; i<job.blocks.size(); i++)
+    {
+        DeflateBlock &block = job.blocks[i];
+        uLong         start = (uLong)i * PARALLEL_DEFLATE_BLOCK;
+
+        block.data       = source + start;
+        block.size       = (uInt)((sourceLen - start < PARALLEL_DEFLATE_BLOCK) ? sourceLen - start : PARALLEL_DEFLATE_BLOCK);
+        block.dictionary = (start < DEFLATE_WINDOW) ? (uInt)start : DEFLATE_WINDOW;
+        block.last       = (i + 1 == job.blocks.size());
+        block.adler      = 1;
+        block.err        = Z_OK;
+    }
+
+    if (threadCount > job.blocks.size())
+        threadCount = (u32)job.blocks.size();
+
+
+    // Deflate.
+    std::vector<std::thread> threads;
+    for (u32 t=1; t<threadCount; t++)
+    {
+        threads.push_back(std::thread(DeflateThread, &job));
+    }
+
+    DeflateThread(&job);
+
+    for (size_t t=0; t<threads.size(); t++)
+    {
+        threads[t].join();
+    }
+
+
+    // Join the blocks between the header and trailer.
+    uLong size  = 2;
+    uLong adler = adler32(0, NULL, 0);
+
+    for (size_t i=0; i<job.blocks.size(); i++)
+    {
+        if (job.blocks[i].err != Z_OK)
+        {
+            return job.blocks[i].err;
+        }
+
+        size += job.blocks[i].out.size();
+    }
+
+    if (size + 4 > *destLen)
+    {
+        return Z_BUF_ERROR;
+    }
+
+    u32 header = ZlibHeader(level);
+    dest[0]    = (Bytef)(header >> 8);
+    dest[1]    = (Bytef)(header);
+
+    size = 2;
+    for (size_t i=0; i<job.blocks.size(); i++)
+    {
+        const DeflateBlock &block = job.blocks[i];
+
+        memcpy(dest + size, &block.out[0], block.out.size());
+        size += block.out.size();
+
+        adler = adler32_combine(adler, block.adler, block.size);
+    }
+
+    dest[size++] = (Bytef)(adler >> 24);
+    dest[size++] = (Bytef)(adler >> 16);
+    dest[size++] = (Bytef)(adler >> 8);
+    dest[size++] = (Bytef)(adler);
+
+    *destLen = size;
+    return Z_OK;
+}
+
+
+// ----------------------------------------------------------------------------
+// Compresses a buffer into one zlib stream, reusing this thread's stream.
+//
+// deflateInit() allocates about 256KB of window and hash tables, which is
+// more than most files being compressed. deflateReset() keeps them.
+// ----------------------------------------------------------------------------
+int DeflateReuse(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level)
+{
+    DeflateContext &context = deflateContext;
+
+    if (context.ready && context.level != level)
+    {
+        deflateEnd(&context.stream);
+        context.ready = false;
+    }
+
+    if (!context.ready)
+    {
+        memset(&context.stream, 0, sizeof(context.stream));
+
+        int err = deflateInit(&context.stream, level);
+        if (err != Z_OK)
+            return err;
+
+        context.level = level;
+        context.ready = true;
+    }
+    else
+    {
+        deflateReset(&context.stream);
+    }
+
+    z_stream &stream = context.stream;
+    stream.next_in   = (Bytef*)source;
+    stream.avail_in  = (uInt)sourceLen;
+    stream.next_out  = dest;
+    stream.avail_out = (uInt)*destLen;
+
+    int err = deflate(&stream, Z_FINISH);
+    if (err != Z_STREAM_END)
+        return (err == Z_OK) ? Z_BUF_ERROR : err;
+
+    *destLen = stream.total_out;
+    return Z_OK;
+}
@@ -0,0 +1,40 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+
+#include "ArcEntry.h"
+#include "zlib/zlib.h"
+
+
+// Inputs at least this big are split across threads.
+#define PARALLEL_DEFLATE_MIN        (4 * 1024 * 1024)
+
+
+// Compresses a buffer into one zlib stream using every core, like
+// compress2(). The input is split into blocks that are deflated side by
+// side, each primed with the end of the block before it, and joined with
+// sync flushes. Any zlib inflate can read the result.
+int DeflateParallel(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level);
+
+// Gets the largest output DeflateParallel() can make.
+uLong DeflateParallelBound(uLong sourceLen);
+
+// Compresses a buffer into one zlib stream like compress2(), with a deflate
+// stream kept for the calling thread. The stream is reset between calls
+// rather than set up and freed for each buffer.
+int DeflateReuse(Bytef *dest, uLongf *destLen, const Bytef *source, uLong sourceLen, int level);
@@ -0,0 +1,291 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include "Extract.h"
+#include "ArcReader.h"
+#include "ArcUnicode.h"
+#include "Glob.h"
+#include "Path.h"
+
+
+namespace
+{
+    // Shared state for the extraction threads.
+    typedef struct ExtractJob
+    {
+        const ArcArchive       *archive;            // The archive
+        const _TCHAR           *arcFilename;        // The archive data file
+        const _TCHAR           *outputDirectory;    // Where to extract to
+        std::vector<u32>        entries;            // Entry indexes to extract, in data order
+        std::atomic<u32>        next;               // The next entry to take
+        std::atomic<u32>        failed;             // The number of failed entries
+        std::atomic<u64>        bytes;              // Uncompressed bytes written
+        bool                    verbose;            // Show each file?
+
+    } ExtractJob;
+
+
+    // ------------------------------------------------------------------------
+    // Orders entry indexes by their position in the archive data.
+    // ------------------------------------------------------------------------
+    struct OffsetLess
+    {
+        const ArcArchive *archive;
+
+        OffsetLess(const ArcArchive *pArchive) : archive(pArchive) {}
+
+        bool operator () (u32 lhs, u32 rhs) const
+        {
+            return archive->entries[lhs].offset < archive->entries[rhs].offset;
+        }
+    };
+
+
+    // ------------------------------------------------------------------------
+    // Checks a stored name can't write outside the output directory.
+    // ------------------------------------------------------------------------
+    bool SafeName(const char *name)
+    {
+        if (name[0] == '\0' || name[0] == '/' || name[0] == '\\' || strchr(name, ':'))
+            return false;
+
+        for (const char *part = name; part; )
+        {
+            if (part[0] == '.' && part[1] == '.' && (part[2] == '/' || part[2] == '\\' || part[2] == '\0'))
+                return false;
+
+            const char *slash = strpbrk(part, "/\\");
+            part = slash ? slash + 1 : NULL;
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Creates every directory above the file.
+    // ------------------------------------------------------------------------
+    void CreateParentDirectories(std::wstring path)
+    {
+        for (size_t i=path.find(L'\\', 3); i != std::wstring::npos; i=path.find(L'\\', i + 1))
+        {
+            path[i] = L'\0';
+            CreateDirectory(path.c_str(), NULL);
+            path[i] = L'\\';
+        }
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Writes a file in one go, after sizing it so the file system can
+    // allocate it contiguously.
+    // ------------------------------------------------------------------------
+    bool WriteOutputFile(const std::wstring &path, const u8 *data, u32 size)
+    {
+        HANDLE file = CreateFile(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            CreateParentDirectories(path);
+            file = CreateFile(path.c_str(), GENERIC_WRITE, 0, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+            if (file == INVALID_HANDLE_VALUE)
+            {
+                return false;
+            }
+        }
+
+        // Preallocate.
+        LARGE_INTEGER position;
+        position.QuadPart = size;
+        bool result = SetFilePointerEx(file, position, NULL, FILE_BEGIN) && SetEndOfFile(file);
+
+        position.QuadPart = 0;
+        result = result && SetFilePointerEx(file, position, NULL, FILE_BEGIN);
+
+        DWORD written = 0;
+        result = result && WriteFile(file, data, size, &written, NULL) && written == size;
+
+        CloseHandle(file);
+        return result;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Extraction thread. Takes entries in data order until none are left.
+    // ------------------------------------------------------------------------
+    void ExtractThread(ExtractJob *job)
+    {
+        FILE *fp = NULL;
+        _tfopen_s(&fp, job->arcFilename, L"rb");
+        if (fp == NULL)
+        {
+            job->failed++;
+            return;
+        }
+
+        std::vector<u8> stored;
+        std::vector<u8> data;
+        std::wstring    path;
+
+        for (u32 i=job->next++; i<job->entries.size(); i=job->next++)
+        {
+            const ArcEntry *pEntry   = job->archive->entries + job->entries[i];
+            const char     *filename = ArcEntryName(*job->archive, pEntry);
+            u32             size     = ArcStoredSize(pEntry);
+
+            stored.resize(size + 1);
+            data.resize(pEntry->filesize + 1);
+
+            // Make the output path.
+            int length = MultiByteToWideChar(CP_UTF8, 0, filename, -1, NULL, 0);
+            std::wstring name(length, L'\0');
+            MultiByteToWideChar(CP_UTF8, 0, filename, -1, &name[0], length);
+            name.resize(length - 1);
+            std::replace(name.begin(), name.end(), L'/', L'\\');
+
+            path  = job->outputDirectory;
+            path += L"\\";
+            path += name;
+            PathLong(path);
+
+            if (_fseeki64(fp, pEntry->offset, SEEK_SET) != 0 ||
+                fread(&stored[0], 1, size, fp) != size ||
+                !ArcDecode(pEntry, &stored[0], &data[0]) ||
+                !ArcVerify(*job->archive, pEntry, &data[0]))
+            {
+                printf("Failed to read or verify: %s\n", filename);
+                job->failed++;
+                continue;
+            }
+
+            if (!WriteOutputFile(path, &data[0], pEntry->filesize))
+            {
+                printf("Failed to write:\n%ls\n", path.c_str());
+                job->failed++;
+                continue;
+            }
+
+            job->bytes += pEntry->filesize;
+
+            if (job->verbose)
+            {
+                printf("%*i : %s\n", 10, pEntry->filesize, filename);
+            }
+        }
+
+        fclose(fp);
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Extracts an archive into a directory.
+//
+// The entries are handed out in data order, so reads stay close to
+// sequential, and each thread reads and inflates its own entries.
+// ----------------------------------------------------------------------------
+bool ExtractArchive(const _TCHAR *archiveName, const _TCHAR *outputDirectory, const std::vector<std::string> &patterns, bool verbose)
+{
+    std::wstring fatFilename = std::wstring(archiveName) + L".fat";
+    std::wstring arcFilename = std::wstring(archiveName) + L".arc";
+    PathLong(fatFilename);
+    PathLong(arcFilename);
+
+    ArcArchive archive;
+    if (!PathOpenArchive(archive, fatFilename))
+    {
+        printf("Failed to open archive:\n%ls\n", fatFilename.c_str());
+        return false;
+    }
+
+    ExtractJob job;
+    job.archive         = &archive;
+    job.arcFilename     = arcFilename.c_str();
+    job.outputDirectory = outputDirectory;
+    job.next            = 0;
+    job.failed          = 0;
+    job.bytes           = 0;
+    job.verbose         = verbose;
+
+    // Patterns are matched in the form the names are stored in.
+    std::vector<std::string> formPatterns(patterns);
+    for (size_t i=0; i<formPatterns.size() && archive.nameForm; i++)
+    {
+        const char *pattern = patterns[i].c_str();
+
+        formPatterns[i].resize(ArcNormaliseName(pattern, archive.nameForm, NULL, 0));
+        ArcNormaliseName(pattern, archive.nameForm, &formPatterns[i][0], formPatterns[i].size() + 1);
+    }
+
+    for (u32 i=0; i<archive.count; i++)
+    {
+        const ArcEntry *pEntry   = archive.entries + i;
+        const char     *filename = ArcEntryName(archive, pEntry);
+
+        if ((pEntry->flags & ENTRY_FLAG_TOMBSTONE) || !GlobMatchAny(formPatterns, filename))
+            continue;
+
+        if (!SafeName(filename))
+        {
+            printf("Skipping unsafe name: %s\n", filename);
+            continue;
+        }
+
+        job.entries.push_back(i);
+    }
+
+    std::sort(job.entries.begin(), job.entries.end(), OffsetLess(&archive));
+
+
+    // Run the threads.
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    u32 threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0)
+        threadCount = 1;
+    if (threadCount > job.entries.size())
+        threadCount = job.entries.size() > 0 ? (u32)job.entries.size() : 1;
+
+    std::vector<std::thread> threads;
+    for (u32 t=1; t<threadCount; t++)
+    {
+        threads.push_back(std::thread(ExtractThread, &job));
+    }
+
+    ExtractThread(&job);
+
+    for (size_t t=0; t<threads.size(); t++)
+    {
+        threads[t].join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Extracted %i files, %llu bytes in %.2f seconds (%.1f MB/s)\n", (int)job.entries.size() - (int)job.failed,
+                                                                            (u64)job.bytes,
+                                                                            seconds,
+                                                                            seconds > 0 ? job.bytes / seconds / (1024 * 1024) : 0.0);
+
+    ArcClose(archive);
+    return job.failed == 0;
+}
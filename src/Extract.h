@@ -0,0 +1,31 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <tchar.h>
+#include <string>
+#include <vector>
+
+
+// Extracts an archive into a directory. Only entries matching one of the
+// patterns are extracted, or every entry if there are no patterns.
+//
+// archiveName     == The archive name, without extension
+// outputDirectory == The full path of the directory to extract to
+bool ExtractArchive(const _TCHAR *archiveName, const _TCHAR *outputDirectory, const std::vector<std::string> &patterns, bool verbose);
@@ -0,0 +1,240 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "Glob.h"
+#include "Path.h"
+
+
+namespace
+{
+    // ------------------------------------------------------------------------
+    // Adds a line from a pattern list, trimmed, unless it's blank or a
+    // comment.
+    // ------------------------------------------------------------------------
+    void AddPattern(const std::string &line, std::vector<std::string> &patterns)
+    {
+        size_t start = line.find_first_not_of(" \t\r\n");
+        size_t end   = line.find_last_not_of(" \t\r\n");
+
+        if (start != std::string::npos && line[start] != '#')
+        {
+            patterns.push_back(line.substr(start, end - start + 1));
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Matches an archive name against a glob pattern.
+// ----------------------------------------------------------------------------
+bool GlobMatch(const char *pattern, const char *name)
+{
+    while (*pattern)
+    {
+        if (pattern[0] == '*' && pattern[1] == '*')
+        {
+            // Skip the stars, and a following slash so "a/**/b" matches "a/b".
+            pattern += 2;
+            if (*pattern == '/')
+            {
+                if (GlobMatch(pattern + 1, name))
+                    return true;
+            }
+
+            for (;; name++)
+            {
+                if (GlobMatch(pattern, name))
+                    return true;
+
+                if (*name == '\0')
+                    return false;
+            }
+        }
+        else if (*pattern == '*')
+        {
+            pattern++;
+
+            for (;; name++)
+            {
+                if (GlobMatch(pattern, name))
+                    return true;
+
+                if (*name == '\0' || *name == '/')
+                    return false;
+            }
+        }
+        else if (*pattern == '?')
+        {
+            if (*name == '\0' || *name == '/')
+                return false;
+        }
+        else if (*pattern != *name)
+        {
+            return false;
+        }
+
+        pattern++;
+        name++;
+    }
+
+    return *name == '\0';
+}
+
+
+// ----------------------------------------------------------------------------
+// Matches a name against a list of patterns.
+// ----------------------------------------------------------------------------
+bool GlobMatchAny(const std::vector<std::string> &patterns, const char *name)
+{
+    if (patterns.empty())
+    {
+        return true;
+    }
+
+    for (size_t i=0; i<patterns.size(); i++)
+    {
+        if (GlobMatch(patterns[i].c_str(), name))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+// ----------------------------------------------------------------------------
+// Loads patterns from a text file.
+// ----------------------------------------------------------------------------
+bool GlobLoadList(const _TCHAR *filename, std::vector<std::string> &patterns)
+{
+    FILE *fp = NULL;
+    _tfopen_s(&fp, filename, L"r");
+    if (fp == NULL)
+    {
+        printf("Failed to open pattern list:\n%ls\n", filename);
+        return false;
+    }
+
+    std::string line;
+    bool        first = true;
+
+    while (PathReadLine(fp, line, first))
+    {
+        AddPattern(line, patterns);
+        first = false;
+    }
+
+    fclose(fp);
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Prepares patterns for matching paths.
+// ----------------------------------------------------------------------------
+void GlobCompile(const std::vector<std::string> &patterns, std::vector<GlobPattern> &compiled)
+{
+    compiled.clear();
+
+    for (size_t i=0; i<patterns.size(); i++)
+    {
+        GlobPattern glob;
+        glob.pattern   = patterns[i];
+        glob.directory = !glob.pattern.empty() && glob.pattern[glob.pattern.size() - 1] == '/';
+
+        if (glob.directory)
+        {
+            glob.pattern.erase(glob.pattern.size() - 1);
+        }
+
+        glob.baseName = glob.pattern.find('/') == std::string::npos;
+
+        if (!glob.pattern.empty() && glob.pattern[0] == '/')
+        {
+            glob.pattern.erase(0, 1);
+        }
+
+        if (glob.pattern.empty())
+            continue;
+
+        size_t first = glob.pattern.find_first_of("*?");
+        size_t last  = glob.pattern.find_last_of("*?");
+
+        glob.literal = first == std::string::npos;
+        glob.prefix  = glob.pattern.substr(0, first);
+        glob.suffix  = glob.literal ? std::string() : glob.pattern.substr(last + 1);
+
+        // "**/" can match nothing, slash included, so "**/foo" matches "foo".
+        if (!glob.literal && last > 0 && glob.pattern[last - 1] == '*' && glob.pattern[last] == '*' &&
+            !glob.suffix.empty() && glob.suffix[0] == '/')
+        {
+            glob.suffix.erase(0, 1);
+        }
+
+        compiled.push_back(glob);
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Matches a path against compiled patterns.
+// ----------------------------------------------------------------------------
+bool GlobMatchPath(const std::vector<GlobPattern> &patterns, const char *path, bool directory)
+{
+    const char *slash = strrchr(path, '/');
+    const char *base  = slash ? slash + 1 : path;
+
+    size_t pathLength = strlen(path);
+    size_t baseLength = strlen(base);
+
+    for (size_t i=0; i<patterns.size(); i++)
+    {
+        const GlobPattern &glob = patterns[i];
+
+        if (glob.directory && !directory)
+            continue;
+
+        const char *subject = glob.baseName ? base : path;
+        size_t      length  = glob.baseName ? baseLength : pathLength;
+
+        if (glob.literal)
+        {
+            if (length == glob.pattern.size() && memcmp(subject, glob.pattern.c_str(), length) == 0)
+                return true;
+
+            continue;
+        }
+
+        // There's a wildcard between the prefix and suffix, so they can't
+        // overlap in a match. The suffix leaves out the '/' after a "**",
+        // which may match nothing.
+        if (length < glob.prefix.size() + glob.suffix.size() ||
+            memcmp(subject, glob.prefix.c_str(), glob.prefix.size()) != 0 ||
+            memcmp(subject + length - glob.suffix.size(), glob.suffix.c_str(), glob.suffix.size()) != 0)
+        {
+            continue;
+        }
+
+        if (GlobMatch(glob.pattern.c_str(), subject))
+            return true;
+    }
+
+    return false;
+}
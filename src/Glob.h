@@ -0,0 +1,62 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <tchar.h>
+#include <string>
+#include <vector>
+
+
+// Matches an archive name against a glob pattern.
+//
+//  *   Matches any run of characters except '/'
+//  **  Matches any run of characters, including '/'
+//  ?   Matches any one character except '/'
+bool GlobMatch(const char *pattern, const char *name);
+
+// Matches a name against a list of patterns. An empty list matches anything.
+bool GlobMatchAny(const std::vector<std::string> &patterns, const char *name);
+
+// A pattern prepared for matching many paths, as the scanner does. The text
+// a match must start and end with is found once, so most paths are turned
+// down without running the matcher.
+typedef struct GlobPattern
+{
+    std::string pattern;                    // The pattern, without a leading or trailing '/'
+    std::string prefix;                     // Literal text every match starts with
+    std::string suffix;                     // Literal text every match ends with
+    bool        literal;                    // No wildcards, so only the pattern itself matches
+    bool        baseName;                   // Matches the last part of a path, at any depth
+    bool        directory;                  // Only matches directories
+
+} GlobPattern;
+
+
+// Loads patterns from a text file, one per line. Blank lines and lines
+// starting with '#' are skipped.
+bool GlobLoadList(const _TCHAR *filename, std::vector<std::string> &patterns);
+
+// Prepares patterns for GlobMatchPath(). As in .gitignore, a pattern with no
+// '/' matches the last part of a path at any depth, a leading '/' ties a
+// pattern to the top directory, and a trailing '/' only matches directories.
+void GlobCompile(const std::vector<std::string> &patterns, std::vector<GlobPattern> &compiled);
+
+// Matches a path relative to the top directory, such as "textures/ui", against
+// compiled patterns. Returns false for an empty list.
+bool GlobMatchPath(const std::vector<GlobPattern> &patterns, const char *path, bool directory);
@@ -0,0 +1,157 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include "Path.h"
+
+
+// Paths this long get the prefix. CreateDirectory() keeps room for an 8.3
+// filename, so its limit is 12 chars under MAX_PATH.
+#define PATH_LONG_MIN       (MAX_PATH - 12)
+
+
+// ----------------------------------------------------------------------------
+// Gets the full path of a file or directory.
+// ----------------------------------------------------------------------------
+bool PathFull(const _TCHAR *path, std::wstring &full)
+{
+    DWORD size = GetFullPathName(path, 0, NULL, NULL);
+    if (size == 0)
+    {
+        return false;
+    }
+
+    full.resize(size);
+    size = GetFullPathName(path, size, &full[0], NULL);
+    if (size == 0 || size >= full.size())
+    {
+        return false;
+    }
+
+    full.resize(size);
+    return true;
+}
+
+
+// ----------------------------------------------------------------------------
+// Adds the \\?\ prefix to a long full path. Network paths become
+// \\?\UNC\server\share.
+// ----------------------------------------------------------------------------
+void PathLong(std::wstring &path)
+{
+    if (path.size() < PATH_LONG_MIN || path.compare(0, 4, L"\\\\?\\") == 0)
+    {
+        return;
+    }
+
+    if (path.compare(0, 2, L"\\\\") == 0)
+    {
+        path.replace(0, 2, L"\\\\?\\UNC\\");
+    }
+    else
+    {
+        path.insert(0, L"\\\\?\\");
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Opens an archive's files by their wide paths, and loads it.
+// ----------------------------------------------------------------------------
+bool PathOpenArchive(ArcArchive &archive, const std::wstring &fatFilename, const std::wstring *arcFilename)
+{
+    FILE *fat = NULL;
+    FILE *arc = NULL;
+
+    memset(&archive, 0, sizeof(ArcArchive));
+
+    _tfopen_s(&fat, fatFilename.c_str(), L"rb");
+    if (fat == NULL)
+    {
+        return false;
+    }
+
+    if (arcFilename)
+    {
+        _tfopen_s(&arc, arcFilename->c_str(), L"rb");
+        if (arc == NULL)
+        {
+            fclose(fat);
+            return false;
+        }
+    }
+
+    return ArcOpenFiles(archive, fat, arc);
+}
+
+
+// ----------------------------------------------------------------------------
+// Converts a path or name to UTF-8. Unpaired surrogates become U+FFFD.
+// ----------------------------------------------------------------------------
+void PathUtf8(const WCHAR *path, std::string &utf8)
+{
+    int length = WideCharToMultiByte(CP_UTF8, 0, path, -1, NULL, 0, NULL, NULL);
+    if (length <= 1)
+    {
+        utf8.clear();
+        return;
+    }
+
+    utf8.resize(length);
+    WideCharToMultiByte(CP_UTF8, 0, path, -1, &utf8[0], length, NULL, NULL);
+    utf8.resize(length - 1);
+}
+
+
+// ----------------------------------------------------------------------------
+// Reads a line of a text file. Lists saved by Notepad start with a byte
+// order mark, which would otherwise end up in the first name or pattern.
+// ----------------------------------------------------------------------------
+bool PathReadLine(FILE *fp, std::string &line, bool firstLine)
+{
+    char buffer[1024];
+
+    line.clear();
+
+    while (fgets(buffer, sizeof(buffer), fp))
+    {
+        line += buffer;
+
+        if (line[line.size() - 1] == '\n')
+        {
+            break;
+        }
+    }
+
+    if (line.empty())
+    {
+        return false;
+    }
+
+    while (!line.empty() && (line[line.size() - 1] == '\n' || line[line.size() - 1] == '\r'))
+    {
+        line.resize(line.size() - 1);
+    }
+
+    if (firstLine && line.compare(0, 3, "\xef\xbb\xbf") == 0)
+    {
+        line.erase(0, 3);
+    }
+
+    return true;
+}
@@ -0,0 +1,49 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+
+#pragma once
+
+
+#include <stdio.h>
+#include <windows.h>
+#include <tchar.h>
+#include <string>
+#include "ArcReader.h"
+
+
+// Gets the full path of a file or directory, however long. Returns false on
+// failure.
+bool        PathFull(const _TCHAR *path, std::wstring &full);
+
+// Adds the \\?\ prefix to a full path that's too long for the plain file
+// functions. The prefix turns off '/', '.' and '..' handling, so the path
+// must already be full and use '\'.
+void        PathLong(std::wstring &path);
+
+// Opens an archive by its wide paths, which the reader's narrow ArcOpen()
+// can't take without losing characters outside the ANSI code page. The data
+// file is optional.
+bool        PathOpenArchive(ArcArchive &archive, const std::wstring &fatFilename, const std::wstring *arcFilename = NULL);
+
+// Converts a path or name to UTF-8, as archive names are stored. The string
+// is reused, so scanning doesn't allocate for every file.
+void        PathUtf8(const WCHAR *path, std::string &utf8);
+
+// Reads a line of a text file, of any length, without its line end. A UTF-8
+// byte order mark is dropped from the first line. Returns false at the end
+// of the file.
+bool        PathReadLine(FILE *fp, std::string &line, bool firstLine);
@@ -39,7 +39,7 @@ void ShowUsage()
     "                                                                               \n"
     "Arguments:                                                                     \n"
     "                                                                               \n"
-    "    -i      The path of the directory to add to the archive.                   \n"
+    "    -i      The path of the directory to add to the archive, or -list.         \n"
     "    -o      The name of the two files to create. This name should not include  \n"
     "            an extension. Extensions will be added by the tool.                \n"
     "                                                                               \n"
@@ -51,10 +51,51 @@ void ShowUsage()
     "    -v     Show the version number.                                            \n"
     "    -verb  Enable verbose output.                                              \n"
     "    -c     Enable file compression.                                            \n"
+    "    -mph   Write a minimal perfect hash index to the FAT. Gives constant time  \n"
+    "           lookups in the reader library.                                      \n"
+    "    -eytz  Write the hash keys in Eytzinger (cache friendly) search order.     \n"
+    "    -bloom Write a bloom filter to the FAT. Lets the reader reject names that  \n"
+    "           are not in the archive by reading one cache line.                   \n"
+    "    -crc   Write a CRC-32C checksum of each entry to the FAT. The reader and   \n"
+    "           extraction check entries against them.                              \n"
+    "    -paths Write the entry indexes in name order to the FAT. Lets the reader   \n"
+    "           list a directory or prefix without reading every name.              \n"
+    "    -include Only add files matching this pattern. Can be given more than once.\n"
+    "    -exclude Skip files and directories matching this pattern. Can be given    \n"
+    "            more than once. A .patignore file at the top of the input          \n"
+    "            directory adds more, one per line. Patterns without a '/' match at \n"
+    "            any depth, and a trailing '/' only matches directories.            \n"
+    "    -list   A file listing the files to add, or - for stdin, instead of -i.    \n"
+    "            One per line: the file, then optionally a tab and its archive name,\n"
+    "            then a tab and none, zlib or zlib:0-9. Relative files are from -i  \n"
+    "            if given, with no scan.                                            \n"
+    "    -base  The name of an existing archive, without extension. Writes a patch  \n"
+    "           archive holding only new or changed files, plus tombstones for      \n"
+    "           files that were deleted.                                            \n"
+    "    -append Add the directory to the existing archive named by -o. New and     \n"
+    "            changed files go on the end of the archive data, and only the FAT  \n"
+    "            is rewritten.                                                      \n"
+    "    -compact Rewrite the archive named by -o without dead data. Compressed     \n"
+    "            data is copied as is.                                              \n"
+    "    -layout The data order for -compact: offset (default), hash or name.       \n"
+    "    -x      The name of an archive to extract, without extension. -o names the \n"
+    "            directory to extract to.                                           \n"
+    "    -match  Only extract names matching this pattern. * and ? don't match '/', \n"
+    "            ** does. Can be given more than once.                              \n"
+    "    -verify The name of an archive to check, without extension. Checks the FAT \n"
+    "            and decodes every entry, on all cores.                             \n"
+    "    -header Write a C++ header naming each asset, with its hash and FAT entry  \n"
+    "            index. Rewritten whenever the FAT is, by appends and -compact.     \n"
+    "    -matchlist A file of -match patterns, one per line.                        \n"
+    "    -v1     Write the old FAT format, with names of up to 259 chars, for older \n"
+    "            readers. Appends and compaction keep an archive's format.          \n"
     "                                                                               \n"
     "Usage example:                                                                 \n"
     "                                                                               \n"
     "    pat -i [directory] -o [output-name] -c                                     \n"
+    "    pat -list [list-file] -o [output-name]                                     \n"
+    "    pat -x [archive-name] -o [directory] -match \"textures/**\"                  \n"
+    "    pat -verify [archive-name]                                                 \n"
     "-------------------------------------------------------------------------------\n";
 
     printf(text);
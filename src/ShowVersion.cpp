@@ -24,12 +24,38 @@
 // 1.0.1 - Added zlib 1.2.8, Added icon
 // 1.1.0 - Changed copyright to Redcliffe Interactive from Paul Michael McNab.
 // 1.2.0 - Moved to github. Made code open source.
+// 1.3.0 - Added optional FAT sections and the minimal perfect hash index (-mph).
+//         Added the reader library.
+// 1.4.0 - Added the Eytzinger ordered search table (-eytz).
+// 1.5.0 - Added the bloom filter (-bloom).
+// 1.6.0 - Added patch archives (-base) and archive stacks to the reader library.
+// 1.7.0 - Added append mode (-append). The FAT is replaced via a temporary file.
+// 1.8.0 - Added archive compaction (-compact, -layout).
+// 1.9.0 - Added extraction (-x, -match, -matchlist).
+// 1.10.0 - Added CRC-32C entry checksums (-crc).
+// 1.11.0 - Added archive verification (-verify).
+// 1.12.0 - Files of 4MB and over are compressed on every core.
+// 1.13.0 - SIMD Adler-32 and CRC-32 in zlib.
+// 1.14.0 - Faster zlib inflate.
+// 1.15.0 - Faster zlib deflate match finder.
+// 1.16.0 - Compression streams and file buffers are reused.
+// 1.17.0 - Scanned names are kept in an arena.
+// 1.18.0 - No path length limit. Names are pooled in the FAT (-v1 for the old format).
+// 1.19.0 - UTF-8 names in NFC, with Unicode case conversion. Lookups use the same form.
+// 1.20.0 - Added compile time name hashing (ArcConstHash.h).
+// 1.21.0 - Added asset headers (-header).
+// 1.22.0 - Added asynchronous batched reads (ArcAsync.cpp).
+// 1.23.0 - Added a cache of decoded entries (ArcCache.cpp).
+// 1.24.0 - Added prefetching and sequential readahead (ArcPrefetch.cpp).
+// 1.25.0 - Added a path index for directory and prefix listing (-paths).
+// 1.26.0 - Added scan filters (-include, -exclude and .patignore).
+// 1.27.0 - Added file list input (-list). Per file codecs and levels.
 
 
 namespace
 {
     int versionMajor    = 1;
-    int versionMinor    = 2;
+    int versionMinor    = 27;
     int versionRevision = 0;
 }
 
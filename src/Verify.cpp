@@ -0,0 +1,386 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Verify.h"
+#include "ArcReader.h"
+#include "ArcUnicode.h"
+#include "ArcHash.h"
+#include "Path.h"
+#include "zlib/zlib.h"
+
+
+namespace
+{
+    // A read only view of a whole file.
+    typedef struct MappedFile
+    {
+        HANDLE      file;                   // The file
+        HANDLE      mapping;                // The file mapping, or NULL if the file is empty
+        const u8   *data;                   // The mapped data, or NULL if the file is empty
+        u64         size;                   // The file size
+
+    } MappedFile;
+
+
+    // Shared state for the verify threads.
+    typedef struct VerifyJob
+    {
+        const ArcArchive   *archive;        // The archive, for the checksums and names
+        const ArcEntry     *entries;        // The archive's entry table
+        u32                 count;          // The number of entries
+        const u8           *arc;            // The mapped archive data
+        std::atomic<u32>    next;           // The next entry to take
+        std::atomic<u32>    bad;            // The number of bad entries
+        std::atomic<u64>    storedBytes;    // Archive bytes read
+        std::atomic<u64>    bytes;          // Uncompressed bytes checked
+        bool                verbose;        // Show each entry?
+
+    } VerifyJob;
+
+
+    // ------------------------------------------------------------------------
+    // Maps a file for reading.
+    // ------------------------------------------------------------------------
+    bool MapFile(const std::wstring &filename, MappedFile &mapped)
+    {
+        memset(&mapped, 0, sizeof(MappedFile));
+
+        mapped.file = CreateFile(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+        if (mapped.file == INVALID_HANDLE_VALUE)
+        {
+            return false;
+        }
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(mapped.file, &size))
+        {
+            CloseHandle(mapped.file);
+            return false;
+        }
+
+        mapped.size = size.QuadPart;
+        if (mapped.size == 0)
+        {
+            return true;
+        }
+
+        mapped.mapping = CreateFileMapping(mapped.file, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (mapped.mapping)
+        {
+            mapped.data = (const u8*)MapViewOfFile(mapped.mapping, FILE_MAP_READ, 0, 0, 0);
+        }
+
+        if (mapped.data == NULL)
+        {
+            if (mapped.mapping)
+                CloseHandle(mapped.mapping);
+            CloseHandle(mapped.file);
+            return false;
+        }
+
+        return true;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Unmaps a file.
+    // ------------------------------------------------------------------------
+    void UnmapFile(MappedFile &mapped)
+    {
+        if (mapped.data)
+            UnmapViewOfFile(mapped.data);
+
+        if (mapped.mapping)
+            CloseHandle(mapped.mapping);
+
+        CloseHandle(mapped.file);
+        memset(&mapped, 0, sizeof(MappedFile));
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Checks the FAT header, and that old format names are terminated.
+    // ------------------------------------------------------------------------
+    bool VerifyHeader(const MappedFile &fat)
+    {
+        if (fat.size < sizeof(FatHeader))
+        {
+            printf("FAT is too small for a header\n");
+            return false;
+        }
+
+        const FatHeader *header = (const FatHeader*)fat.data;
+        if (header->magic1 != MAGIC1 || (header->magic2 != MAGIC2 && header->magic2 != MAGIC2_V2))
+        {
+            printf("FAT has the wrong magic numbers\n");
+            return false;
+        }
+
+        bool v1        = header->magic2 == MAGIC2;
+        u32  entrySize = v1 ? sizeof(ArcEntryV1) : sizeof(ArcEntry);
+
+        if (header->size > fat.size || (u64)header->entries * entrySize > header->size - sizeof(FatHeader))
+        {
+            printf("FAT sizes are inconsistent: %u entries, %u bytes, file is %llu bytes\n", header->entries, header->size, fat.size);
+            return false;
+        }
+
+        const ArcEntryV1 *entries = (const ArcEntryV1*)(header + 1);
+        bool              result  = true;
+
+        for (u32 i=0; i<header->entries && v1; i++)
+        {
+            if (memchr(entries[i].filename, 0, sizeof(entries[i].filename)) == NULL)
+            {
+                printf("Entry %u: Name is not terminated\n", i);
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Checks the entry table, once the reader has loaded it.
+    // ------------------------------------------------------------------------
+    bool VerifyEntries(const ArcArchive &archive, u64 arcSize)
+    {
+        bool        result = true;
+        std::string form;
+
+        for (u32 i=0; i<archive.count; i++)
+        {
+            const ArcEntry *pEntry   = archive.entries + i;
+            const char     *filename = ArcEntryName(archive, pEntry);
+
+            if (pEntry->hash != StringHash(filename))
+            {
+                printf("Entry %u: Hash doesn't match name: %s\n", i, filename);
+                result = false;
+            }
+
+            // A name out of its form can't be found by name.
+            if (archive.nameForm && !ArcNameIsNormal(filename, archive.nameForm))
+            {
+                form.resize(ArcNormaliseName(filename, archive.nameForm, NULL, 0));
+                ArcNormaliseName(filename, archive.nameForm, &form[0], form.size() + 1);
+
+                if (form != filename)
+                {
+                    printf("Entry %u: Name isn't in the archive's name form: %s\n", i, filename);
+                    result = false;
+                }
+            }
+
+            if (i > 0 && pEntry->hash < archive.entries[i - 1].hash)
+            {
+                printf("Entry %u: Not sorted by hash: %s\n", i, filename);
+                result = false;
+            }
+
+            if (pEntry->flags & ~ENTRY_FLAG_TOMBSTONE)
+            {
+                printf("Entry %u: Unknown flags %02x: %s\n", i, pEntry->flags, filename);
+                result = false;
+            }
+
+            if (pEntry->flags & ENTRY_FLAG_TOMBSTONE)
+                continue;
+
+            if (pEntry->compressed > 1 || (pEntry->compressed && pEntry->compressedSize == 0) || pEntry->filesize == 0)
+            {
+                printf("Entry %u: Bad sizes: %s\n", i, filename);
+                result = false;
+            }
+
+            if ((u64)pEntry->offset + ArcStoredSize(pEntry) > arcSize)
+            {
+                printf("Entry %u: Data is outside the archive: %s\n", i, filename);
+                result = false;
+            }
+        }
+
+        // Names are unique, so a path index in strictly rising name order
+        // also lists each entry once.
+        for (u32 i=1; archive.paths && i<archive.count; i++)
+        {
+            const char *previous = ArcEntryName(archive, ArcPathEntry(archive, i - 1));
+            const char *filename = ArcEntryName(archive, ArcPathEntry(archive, i));
+
+            if (strcmp(previous, filename) >= 0)
+            {
+                printf("Path index %u: Not in name order: %s\n", i, filename);
+                result = false;
+            }
+        }
+
+        return result;
+    }
+
+
+    // ------------------------------------------------------------------------
+    // Verify thread. Decodes entries until none are left.
+    // ------------------------------------------------------------------------
+    void VerifyThread(VerifyJob *job)
+    {
+        std::vector<u8> data;
+
+        for (u32 i=job->next++; i<job->count; i=job->next++)
+        {
+            const ArcEntry *pEntry = job->entries + i;
+
+            if (pEntry->flags & ENTRY_FLAG_TOMBSTONE)
+                continue;
+
+            const u8 *stored = job->arc + pEntry->offset;
+            bool      result = true;
+
+            if (pEntry->compressed)
+            {
+                data.resize(pEntry->filesize);
+                result = ArcDecode(pEntry, stored, &data[0]) && ArcVerify(*job->archive, pEntry, &data[0]);
+            }
+            else
+            {
+                result = ArcVerify(*job->archive, pEntry, stored);
+            }
+
+            job->storedBytes += ArcStoredSize(pEntry);
+            job->bytes       += pEntry->filesize;
+
+            if (!result)
+            {
+                printf("Entry %u: Data is corrupt: %s\n", i, ArcEntryName(*job->archive, pEntry));
+                job->bad++;
+            }
+            else if (job->verbose)
+            {
+                printf("%*i : %s\n", 10, pEntry->filesize, ArcEntryName(*job->archive, pEntry));
+            }
+        }
+    }
+}
+
+
+// ----------------------------------------------------------------------------
+// Checks an archive's FAT and data.
+//
+// Both files are mapped. The FAT is checked first, as the data checks rely
+// on the entries being in bounds. Then every entry is decoded, with one
+// thread per core.
+// ----------------------------------------------------------------------------
+bool VerifyArchive(const _TCHAR *archiveName, bool verbose)
+{
+    std::wstring fatFilename = std::wstring(archiveName) + L".fat";
+    std::wstring arcFilename = std::wstring(archiveName) + L".arc";
+    PathLong(fatFilename);
+    PathLong(arcFilename);
+
+    MappedFile fat;
+    MappedFile arc;
+
+    if (!MapFile(fatFilename, fat))
+    {
+        printf("Failed to open:\n%ls\n", fatFilename.c_str());
+        return false;
+    }
+
+    if (!MapFile(arcFilename, arc))
+    {
+        printf("Failed to open:\n%ls\n", arcFilename.c_str());
+        UnmapFile(fat);
+        return false;
+    }
+
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    // The names and sections are checked by the reader.
+    ArcArchive archive;
+
+    bool result = VerifyHeader(fat);
+    if (result && !PathOpenArchive(archive, fatFilename))
+    {
+        printf("FAT names or sections are corrupt\n");
+        result = false;
+    }
+
+    if (result && !VerifyEntries(archive, arc.size))
+    {
+        ArcClose(archive);
+        result = false;
+    }
+
+    if (!result)
+    {
+        UnmapFile(arc);
+        UnmapFile(fat);
+        return false;
+    }
+
+
+    // Decode everything.
+    VerifyJob job;
+    job.archive     = &archive;
+    job.entries     = archive.entries;
+    job.count       = archive.count;
+    job.arc         = arc.data;
+    job.next        = 0;
+    job.bad         = 0;
+    job.storedBytes = 0;
+    job.bytes       = 0;
+    job.verbose     = verbose;
+
+    u32 threadCount = std::thread::hardware_concurrency();
+    if (threadCount == 0)
+        threadCount = 1;
+
+    std::vector<std::thread> threads;
+    for (u32 t=1; t<threadCount; t++)
+    {
+        threads.push_back(std::thread(VerifyThread, &job));
+    }
+
+    VerifyThread(&job);
+
+    for (size_t t=0; t<threads.size(); t++)
+    {
+        threads[t].join();
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    printf("Verified %u entries%s: %u bad\n", job.count, archive.crcs ? " with checksums" : "", (u32)job.bad);
+    printf("Read %llu bytes, decoded %llu bytes in %.2f seconds (%.1f MB/s)\n", (u64)job.storedBytes,
+                                                                               (u64)job.bytes,
+                                                                               seconds,
+                                                                               seconds > 0 ? job.bytes / seconds / (1024 * 1024) : 0.0);
+
+    ArcClose(archive);
+    UnmapFile(arc);
+    UnmapFile(fat);
+
+    return job.bad == 0;
+}
@@ -0,0 +1,27 @@
+/**
+ *  Copyright 2016 Redcliffe Interactive
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#pragma once
+
+
+#include <tchar.h>
+
+
+// Checks an archive's FAT and data. Every entry is bounds checked and
+// decoded, and checked against its checksum if the archive has them.
+//
+// archiveName == The archive name, without extension
+bool VerifyArchive(const _TCHAR *archiveName, bool verbose);
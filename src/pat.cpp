@@ -20,10 +20,26 @@
 #include <tchar.h>
 #include <stdlib.h>
 #include <string.h>
-#include <list>
+#include <vector>
+#include <set>
+#include <string>
+#include <algorithm>
+#include <map>
 #include "ShowUsage.h"
 #include "ShowVersion.h"
 #include "ArcEntry.h"
+#include "ArcHash.h"
+#include "ArcCrc.h"
+#include "ArcIndex.h"
+#include "ArcReader.h"
+#include "ArcUnicode.h"
+#include "Extract.h"
+#include "Verify.h"
+#include "AssetHeader.h"
+#include "Deflate.h"
+#include "Glob.h"
+#include "Arena.h"
+#include "Path.h"
 #include "zlib/zlib.h"
 
 
@@ -55,6 +71,67 @@ void Find();
 // Rounds a number up by the specified amount.
 #define ROUND_UP(number, amount)      (((u32)(number) + (amount) - 1)  &  ~((amount) - 1))
 
+// The last archive offset an entry's data can start at.
+#define ARC_OFFSET_MAX          0xffffffff
+
+
+// Data orders for compaction.
+enum
+{
+    LAYOUT_OFFSET,                          // Keep the existing order
+    LAYOUT_HASH,                            // FAT order, as a fresh archive
+    LAYOUT_NAME,                            // Filename order, keeping directories together
+};
+
+
+// How a file is stored. Files from a -list can choose, and others follow -c.
+enum
+{
+    CODEC_DEFAULT,                          // Compressed with -c
+    CODEC_NONE,                             // Stored as is
+    CODEC_ZLIB,                             // Compressed with zlib
+};
+
+
+// Size of the buffer data is copied through when compacting.
+#define COMPACT_BUFFER_SIZE     (1024 * 1024)
+
+
+// A scanned directory. The path is relative to the input directory, with a
+// '/' after each directory name, so the input directory itself is "".
+typedef struct ScanDir
+{
+    const char     *path;                   // The path, in the scan arena
+    u32             length;                 // The path length
+
+} ScanDir;
+
+
+// A file to add. Each directory's path is stored once and shared by its
+// files. Tombstones name a deleted base entry and use the root directory, as
+// do files from a -list, whose name is their whole archive name.
+typedef struct ScanFile
+{
+    const ScanDir  *dir;                    // The directory holding the file
+    const char     *name;                   // The filename within the directory
+    const char     *source;                 // The full path to read, for -list files, or NULL
+    u32             filesize;               // The uncompressed filesize
+    u32             hash;                   // The archive name hash
+    u8              flags;                  // ENTRY_FLAG_xxx
+    u8              codec;                  // CODEC_xxx
+    s8              level;                  // The zlib level, or Z_DEFAULT_COMPRESSION
+
+} ScanFile;
+
+
+// A FAT being written. Each entry's name is an offset into the name pool.
+typedef struct FatData
+{
+    std::vector<ArcEntry>   entries;        // The entries
+    std::vector<u8>         names;          // The NUL terminated names
+
+} FatData;
+
 
 // Local data
 namespace
@@ -66,34 +143,102 @@ namespace
     bool     gotOutput   = false;
     bool     verbose     = false;
     bool     crushData   = false;
-
-    _TCHAR   inputDirectory      [MAX_PATH];
-    _TCHAR   outputFilename      [MAX_PATH];
-    _TCHAR   inputDirectory_Full [MAX_PATH];
-    _TCHAR   outputFilename_Full [MAX_PATH];
-    _TCHAR   outputFilename_Fat  [MAX_PATH];
-    _TCHAR   outputFilename_Arc  [MAX_PATH];
-
-    std::list<ArcEntry>  filesToAdd;
+    bool     buildMph    = false;
+    bool     eytzinger   = false;
+    bool     bloom       = false;
+    bool     checksums   = false;
+    bool     pathIndex   = false;
+    bool     gotBase     = false;
+    bool     appendMode  = false;
+    bool     compactMode = false;
+    bool     extractMode = false;
+    bool     verifyMode  = false;
+    bool     formatV1    = false;
+    bool     gotList     = false;
+    int      layout      = LAYOUT_OFFSET;
+    u32      nameForm    = 0;
+
+    std::wstring inputDirectory;
+    std::wstring outputFilename;
+    std::wstring inputDirectory_Full;
+    std::wstring outputFilename_Full;
+    std::wstring outputFilename_Fat;
+    std::wstring outputFilename_Arc;
+    std::wstring baseFilename;
+    std::wstring extractFilename;
+    std::wstring extractFilename_Full;
+    std::wstring verifyFilename;
+    std::wstring verifyFilename_Full;
+    std::wstring listFilename;
+    std::wstring headerFilename;
+    std::wstring headerFilename_Full;
+
+    std::vector<ScanFile> filesToAdd;
+    Arena                scanArena;
+    ScanDir              rootDir     = { "", 0 };
+    std::vector<std::string> matchPatterns;
+    std::vector<std::string> includePatterns;
+    std::vector<std::string> excludePatterns;
+    std::vector<GlobPattern> includeFilter;
+    std::vector<GlobPattern> excludeFilter;
+    std::map<std::string, u32> entryCrcs;
+    std::map<std::string, u32> listNames;   // Names from the -list, and the lines giving them
+    ArcArchive           baseArchive;
+    ArcArchive           outputArchive;
+
+    // Buffers kept from file to file, grown to the largest seen.
+    std::vector<u8>      fileBuffer;
+    std::vector<u8>      compressBuffer;
+    std::vector<u8>      archiveBuffer;
 }
 
 
 // Local functions
 void UnknownCommand(const _TCHAR* argv);
-bool GetArgument(const _TCHAR** argv, int index, int total, _TCHAR *data);
+bool GetArgument(const _TCHAR** argv, int index, int total, std::wstring &data);
 bool CheckArguments();
 bool ValidateDirectory(const _TCHAR *filename);
 bool FileExist(const _TCHAR *filename);
 bool ValidateFile(const _TCHAR *filename);
 bool ValidateNotDirectory(const _TCHAR *filename);
-void ScanDirectory(const _TCHAR *filename);
-void AddFile(WIN32_FIND_DATAW &fd, const _TCHAR *parentDirectory);
+void ScanDirectory(const std::wstring &directory, const ScanDir *dir);
+void AddFile(WIN32_FIND_DATAW &fd, const std::wstring &parentDirectory, const ScanDir *dir);
+const ScanDir *CreateScanDir(const ScanDir *parent, const WCHAR *name);
 void DebugShowLastError();
-void CreateEntry(WIN32_FIND_DATAW &fd, const _TCHAR *filename);
+void CreateEntry(WIN32_FIND_DATAW &fd, const ScanDir *dir);
 bool WriteArchive();
-u32  StringHash(const char* string);
-int  CompressData(const Bytef *data, uLong dataSize, uLong &dataOutSize, u8 **dataOut);
-void StringReplaceChar(char *string, char search, char replace);
+bool WriteEntryData(FILE *fp_arc, const ScanFile &source, u64 &offset, FatData &fat, bool &skipped);
+bool WriteFat(const std::wstring &filename, const FatData &fat);
+bool WriteFatFile(const std::wstring &filename, const FatData &fat);
+bool UpdateAssetHeader(const FatData &fat);
+bool WriteEntries(FILE *fp_fat, const FatData &fat);
+bool EntryHashLess(const ArcEntry &lhs, const ArcEntry &rhs);
+bool ScanFileHashLess(const ScanFile &lhs, const ScanFile &rhs);
+bool WriteSections(FILE *fp_fat, const std::vector<u32> &hashes, const std::vector<u32> &crcs, const std::vector<u32> &paths, u32 &size);
+bool WriteSection(FILE *fp_fat, u32 type, const std::vector<u8> &data, u32 &size, const char *description);
+bool CheckCollisions(const FatData &fat);
+bool CheckDuplicateNames(const std::vector<ScanFile> &files);
+u32  AddName(FatData &fat, const char *name);
+const char *FatName(const FatData &fat, const ArcEntry &entry);
+int  CompressData(const Bytef *data, uLong dataSize, uLong &dataOutSize, u8 **dataOut, int level);
+u8  *PoolBuffer(std::vector<u8> &pool, size_t size);
+void MakeArchiveName(const ScanFile &file, std::string &name);
+void FormName(std::string &name);
+bool LoadFilters();
+bool NameFiltered(const std::string &name, bool directory);
+bool BaseNameFiltered(const char *name);
+bool MakeSourcePath(const ScanFile &file, std::wstring &path);
+bool LoadList();
+bool AddListFile(const std::string &line, u32 lineNumber);
+bool ParseCodec(const std::string &text, u8 &codec, s8 &level);
+bool PathRelative(const char *path);
+bool OpenBase();
+void AddTombstones(std::vector<ScanFile> &files);
+bool OpenOutput();
+bool CompactArchive();
+bool CopyData(FILE *fp_in, FILE *fp_out, u64 offset, u32 size, u8 *buffer);
+void RestoreBackup(const std::wstring &backup, const std::wstring &filename);
+bool UnchangedInArchive(const ArcArchive &archive, const char *name, const u8 *data, u32 filesize, u32 crc);
 
 
 // ----------------------------------------------------------------------------
@@ -110,18 +255,20 @@ void fnExit(void)
             printf("Files in archive\n");
             printf("-------------------------------------------------------------------------------\n");
 
-            std::list<ArcEntry>::iterator it  = filesToAdd.begin();
-            std::list<ArcEntry>::iterator end = filesToAdd.end();
-            for(;it != end; ++it)
+            for (size_t i=0; i<filesToAdd.size(); i++)
             {
                 // Display entries on exit.
-                printf("Size: %*i : %s\n", 10, (*it).filesize, (*it).filename);
+                const ScanFile &file = filesToAdd[i];
+                printf("Size: %*i : %s%s\n", 10, file.filesize, file.dir->path, file.name);
             }
         }
     }
 #endif
 
     filesToAdd.clear();
+    ArenaFree(scanArena);
+    ArcClose(baseArchive);
+    ArcClose(outputArchive);
 }
 
 
@@ -146,6 +293,9 @@ int _tmain(int argc, _TCHAR* argv[])
         SetConsoleTitle(TEXT("Proteus Archive Tool"));
     }
 
+    // Archive names are printed as UTF-8.
+    SetConsoleOutputCP(CP_UTF8);
+
     // No args?
     if (argc == 1)
     {
@@ -173,6 +323,24 @@ int _tmain(int argc, _TCHAR* argv[])
                 {
                     verbose = true;
                 }
+                else if (_tcsicmp(L"-v1", argv[i]) == 0)
+                {
+                    formatV1 = true;
+                }
+                else if (_tcsicmp(L"-verify", argv[i]) == 0)
+                {
+                    if (GetArgument((const _TCHAR **)argv, i, count, verifyFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        verifyMode = true;
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
                 else
                 {
                     UnknownCommand(argv[i]);
@@ -180,13 +348,25 @@ int _tmain(int argc, _TCHAR* argv[])
                 }
                 break;
 
-            // Show help?
+            // Show help? Write an asset header?
             case L'h':
                 if (_tcsicmp(L"-h", argv[i]) == 0)
                 {
                     ShowUsage();
                     return 0;
                 }
+                else if (_tcsicmp(L"-header", argv[i]) == 0)
+                {
+                    if (GetArgument((const _TCHAR **)argv, i, count, headerFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
                 else
                 {
                     UnknownCommand(argv[i]);
@@ -194,12 +374,53 @@ int _tmain(int argc, _TCHAR* argv[])
                 }
                 break;
 
-            // Lower case file names.
+            // Lower case file names. Compaction layout. File list.
             case L'l':
                 if (_tcsicmp(L"-lc", argv[i]) == 0)
                 {
                     lowerCase = true;
                 }
+                else if (_tcsicmp(L"-list", argv[i]) == 0)
+                {
+                    if (GetArgument((const _TCHAR **)argv, i, count, listFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        gotList = true;
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
+                else if (_tcsicmp(L"-layout", argv[i]) == 0)
+                {
+                    if (i + 1 > count)
+                    {
+                        printf("No data for argument: %ls\n", argv[i]);
+                        return 1;
+                    }
+
+                    i++;
+                    if (_tcsicmp(L"offset", argv[i]) == 0)
+                    {
+                        layout = LAYOUT_OFFSET;
+                    }
+                    else if (_tcsicmp(L"hash", argv[i]) == 0)
+                    {
+                        layout = LAYOUT_HASH;
+                    }
+                    else if (_tcsicmp(L"name", argv[i]) == 0)
+                    {
+                        layout = LAYOUT_NAME;
+                    }
+                    else
+                    {
+                        printf("Unknown layout: %ls\n", argv[i]);
+                        return 1;
+                    }
+                }
                 else
                 {
                     UnknownCommand(argv[i]);
@@ -220,12 +441,174 @@ int _tmain(int argc, _TCHAR* argv[])
                 }
                 break;
 
-            // Compress?
+            // Compress? Compact? Checksums?
             case L'c':
                 if (_tcsicmp(L"-c", argv[i]) == 0)
                 {
                     crushData = true;
                 }
+                else if (_tcsicmp(L"-crc", argv[i]) == 0)
+                {
+                    checksums = true;
+                }
+                else if (_tcsicmp(L"-compact", argv[i]) == 0)
+                {
+                    compactMode = true;
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Append to an existing archive?
+            case L'a':
+                if (_tcsicmp(L"-append", argv[i]) == 0)
+                {
+                    appendMode = true;
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Build a bloom filter? Build a patch?
+            case L'b':
+                if (_tcsicmp(L"-bloom", argv[i]) == 0)
+                {
+                    bloom = true;
+                }
+                else if (_tcsicmp(L"-base", argv[i]) == 0)
+                {
+                    if (GetArgument((const _TCHAR **)argv, i, count, baseFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        gotBase = true;
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Build an Eytzinger search table?
+            case L'e':
+                if (_tcsicmp(L"-eytz", argv[i]) == 0)
+                {
+                    eytzinger = true;
+                }
+                else if (_tcsicmp(L"-exclude", argv[i]) == 0)
+                {
+                    std::wstring pattern;
+                    if (GetArgument((const _TCHAR **)argv, i, count, pattern) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        std::string utf8;
+                        PathUtf8(pattern.c_str(), utf8);
+                        excludePatterns.push_back(utf8);
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Write a path index?
+            case L'p':
+                if (_tcsicmp(L"-paths", argv[i]) == 0)
+                {
+                    pathIndex = true;
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Build a minimal perfect hash index? Extraction patterns?
+            case L'm':
+                if (_tcsicmp(L"-mph", argv[i]) == 0)
+                {
+                    buildMph = true;
+                }
+                else if (_tcsicmp(L"-match", argv[i]) == 0)
+                {
+                    std::wstring pattern;
+                    if (GetArgument((const _TCHAR **)argv, i, count, pattern) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        std::string utf8;
+                        PathUtf8(pattern.c_str(), utf8);
+                        matchPatterns.push_back(utf8);
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
+                else if (_tcsicmp(L"-matchlist", argv[i]) == 0)
+                {
+                    std::wstring listFilename;
+                    if (GetArgument((const _TCHAR **)argv, i, count, listFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else if (!GlobLoadList(listFilename.c_str(), matchPatterns))
+                    {
+                        printf("Failed to load pattern list:\n%ls\n", listFilename.c_str());
+                        return 1;
+                    }
+                    else
+                    {
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
+                else
+                {
+                    UnknownCommand(argv[i]);
+                    return 1;
+                }
+                break;
+
+            // Extract an archive?
+            case L'x':
+                if (_tcsicmp(L"-x", argv[i]) == 0)
+                {
+                    if (GetArgument((const _TCHAR **)argv, i, count, extractFilename) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        extractMode = true;
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
                 else
                 {
                     UnknownCommand(argv[i]);
@@ -249,6 +632,23 @@ int _tmain(int argc, _TCHAR* argv[])
                         i++;
                     }
                 }
+                else if (_tcsicmp(L"-include", argv[i]) == 0)
+                {
+                    std::wstring pattern;
+                    if (GetArgument((const _TCHAR **)argv, i, count, pattern) == false)
+                    {
+                        return 1;
+                    }
+                    else
+                    {
+                        std::string utf8;
+                        PathUtf8(pattern.c_str(), utf8);
+                        includePatterns.push_back(utf8);
+
+                        // Bypass arguments value.
+                        i++;
+                    }
+                }
                 else
                 {
                     UnknownCommand(argv[i]);
@@ -296,70 +696,167 @@ int _tmain(int argc, _TCHAR* argv[])
     {
         return 1;
     }
+
+    // Names are stored as NFC UTF-8, with the case converted if asked.
+    nameForm = NAME_FORM_NFC | (lowerCase ? NAME_FORM_LOWER : 0) | (upperCase ? NAME_FORM_UPPER : 0);
+
+    // Verification only reads the archive.
+    if (verifyMode)
+    {
+        if (!PathFull(verifyFilename.c_str(), verifyFilename_Full))
+        {
+            printf("Failed to get full path name for:\n%ls\n", verifyFilename.c_str());
+            return 1;
+        }
+
+        return VerifyArchive(verifyFilename_Full.c_str(), verbose) ? 0 : 1;
+    }
+
+    // Extraction writes to the output directory instead of an archive.
+    if (extractMode)
+    {
+        if (!PathFull(extractFilename.c_str(), extractFilename_Full) ||
+            !PathFull(outputFilename.c_str(),  outputFilename_Full))
+        {
+            printf("Failed to get full path names for extraction\n");
+            return 1;
+        }
+
+        PathLong(outputFilename_Full);
+        CreateDirectory(outputFilename_Full.c_str(), NULL);
+        if (!ValidateDirectory(outputFilename_Full.c_str()))
+        {
+            return 1;
+        }
+
+        return ExtractArchive(extractFilename_Full.c_str(), outputFilename_Full.c_str(), matchPatterns, verbose) ? 0 : 1;
+    }
        
     // Get full paths
-    if (GetFullPathName(outputFilename, MAX_PATH, outputFilename_Full, NULL) == 0)
+    if (!PathFull(outputFilename.c_str(), outputFilename_Full))
     {
-        printf("Failed to get full path name for:\n%ls\n", outputFilename);
+        printf("Failed to get full path name for:\n%ls\n", outputFilename.c_str());
         return 1;
     }
 
-    if (GetFullPathName(inputDirectory, MAX_PATH, inputDirectory_Full, NULL) == 0)
+    // Make output filenames
+    outputFilename_Fat = outputFilename_Full + L".fat";
+    outputFilename_Arc = outputFilename_Full + L".arc";
+    PathLong(outputFilename_Full);
+    PathLong(outputFilename_Fat);
+    PathLong(outputFilename_Arc);
+
+    // The asset header is written along with the FAT.
+    if (!headerFilename.empty())
     {
-        printf("Failed to get full path name for:\n%ls\n", inputDirectory);
-        return 1;
+        if (!PathFull(headerFilename.c_str(), headerFilename_Full))
+        {
+            printf("Failed to get full path name for:\n%ls\n", headerFilename.c_str());
+            return 1;
+        }
+
+        PathLong(headerFilename_Full);
     }
 
-    // Validate input/output sources.
-    if (!ValidateDirectory(inputDirectory_Full))
+    // Check the output name is not a directory
+    if (!ValidateNotDirectory(outputFilename_Full.c_str()))
     {
         return 1;
     }
 
-    // Copy to make output filenames
-    _tcscpy_s(outputFilename_Fat, MAX_PATH, outputFilename_Full);
-    _tcscpy_s(outputFilename_Arc, MAX_PATH, outputFilename_Full);
+    // Appending and compacting need the archive to exist.
+    if ((appendMode || compactMode) && (!FileExist(outputFilename_Fat.c_str()) || !FileExist(outputFilename_Arc.c_str())))
+    {
+        printf("No archive found:\n%ls\n", outputFilename_Fat.c_str());
+        return 1;
+    }
 
-    // Check output names are not directories
-    if (!ValidateNotDirectory(outputFilename_Fat))
+    // Validate.
+    if (!ValidateFile(outputFilename_Fat.c_str()))
     {
         return 1;
     }
 
-    if (!ValidateNotDirectory(outputFilename_Arc))
+    if (!ValidateFile(outputFilename_Arc.c_str()))
     {
         return 1;
     }
 
-    // Add extensions
-    _tcscat_s(outputFilename_Fat, MAX_PATH, L".fat");
-    _tcscat_s(outputFilename_Arc, MAX_PATH, L".arc");
+    // Compaction only works on the existing archive.
+    if (compactMode)
+    {
+        if (!OpenOutput() || !CompactArchive())
+        {
+            return 1;
+        }
 
-    // Validate.
-    if (!ValidateFile(outputFilename_Fat))
+        return 0;
+    }
+
+    // Validate input/output sources.
+    if (gotInput)
     {
-        return 1;
+        if (!PathFull(inputDirectory.c_str(), inputDirectory_Full))
+        {
+            printf("Failed to get full path name for:\n%ls\n", inputDirectory.c_str());
+            return 1;
+        }
+
+        PathLong(inputDirectory_Full);
+        if (!ValidateDirectory(inputDirectory_Full.c_str()))
+        {
+            return 1;
+        }
     }
 
-    if (!ValidateFile(outputFilename_Arc))
+    // Load the archive a patch is made against.
+    if (gotBase && !OpenBase())
     {
         return 1;
     }
 
-    // Scan
-    ScanDirectory(inputDirectory_Full);
-
-    // Got files to add?
-    if (filesToAdd.size() == 0)
+    // Load the archive being appended to.
+    if (appendMode && !OpenOutput())
     {
-        printf("Didn't find any files to add to archive\n");
         return 1;
     }
 
-    if (!WriteArchive())
+    // Filters are compiled once the name form is known.
+    if (!LoadFilters())
+    {
         return 1;
+    }
 
-    // Test example code
+    // Add the listed files, or scan. With a list, -i only roots its
+    // relative paths.
+    if (gotList)
+    {
+        if (!LoadList())
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        ScanDirectory(inputDirectory_Full, &rootDir);
+    }
+
+    // Got files to add?
+    if (filesToAdd.size() == 0)
+    {
+        printf("Didn't find any files to add to archive\n");
+        return 1;
+    }
+
+    if (verbose)
+    {
+        printf("Found %u files, using %u KB for their names\n", (u32)filesToAdd.size(), (u32)(scanArena.total / 1024));
+    }
+
+    if (!WriteArchive())
+        return 1;
+
+    // Test example code
 #ifdef EXAMPLE_CODE
     Find();
 #endif
@@ -385,7 +882,7 @@ void UnknownCommand(const _TCHAR* argv)
 // total == The total number of argument values
 // data  == The storage string
 // ------------------------------------------------------------------------
-bool GetArgument(const _TCHAR** argv, int index, int total, _TCHAR *data)
+bool GetArgument(const _TCHAR** argv, int index, int total, std::wstring &data)
 {
     // Do we have enough command line arguments?
     if (index + 1 > total)
@@ -402,16 +899,8 @@ bool GetArgument(const _TCHAR** argv, int index, int total, _TCHAR *data)
         return false;
     }
 
-    // Is the argument too long?
-    size_t size = _tcslen(pArg);
-    if (size >= MAX_PATH)
-    {
-        printf("The data is too long for argument : %ls\n", argv[index]);
-        return false;
-    }
-
     // Store the argument
-    _tcscpy_s(data, MAX_PATH, pArg);
+    data = pArg;
     return true;
 }
 
@@ -427,9 +916,44 @@ bool CheckArguments()
         return false;
     }
 
-    if (!gotInput)
+    if (!gotInput && !gotList && (!includePatterns.empty() || !excludePatterns.empty()))
+    {
+        printf("Filters can only be used when adding files\n");
+        return false;
+    }
+
+    if (verifyMode)
     {
-        printf("No input directory specified\n");
+        if (gotInput || gotList || gotOutput || gotBase || appendMode || compactMode || extractMode || !matchPatterns.empty() || !headerFilename.empty())
+        {
+            printf("Verification only takes the archive name\n");
+            return false;
+        }
+
+        return true;
+    }
+
+    if (extractMode && (gotInput || gotList || gotBase || appendMode || compactMode || !headerFilename.empty()))
+    {
+        printf("Extraction only takes the archive, output directory and patterns\n");
+        return false;
+    }
+
+    if (!extractMode && !matchPatterns.empty())
+    {
+        printf("Patterns can only be used when extracting\n");
+        return false;
+    }
+
+    if (!gotInput && !gotList && !compactMode && !extractMode)
+    {
+        printf("No input directory or file list specified\n");
+        return false;
+    }
+
+    if (compactMode && (gotInput || gotList || gotBase || appendMode))
+    {
+        printf("Compaction only takes the archive name and layout\n");
         return false;
     }
 
@@ -439,6 +963,12 @@ bool CheckArguments()
         return false;
     }
 
+    if (gotBase && appendMode)
+    {
+        printf("You can't append to a patch archive while creating it\n");
+        return false;
+    }
+
     return true;
 }
 
@@ -577,20 +1107,16 @@ bool ValidateNotDirectory(const _TCHAR *filename)
 // ------------------------------------------------------------------------
 // Scans the directory.
 // ------------------------------------------------------------------------
-void ScanDirectory(const _TCHAR *filename)
+void ScanDirectory(const std::wstring &directory, const ScanDir *dir)
 {
-    // Create search path and base path.
-    _TCHAR  filenameParent  [MAX_PATH];
-    _TCHAR  filenameDir     [MAX_PATH];
-
-    _tcscpy_s(filenameParent, MAX_PATH, filename);
-    _tcscpy_s(filenameDir,    MAX_PATH, filename);
-    _tcscat_s(filenameDir,    MAX_PATH, L"\\*.*");
+    // Create search path.
+    std::wstring search = directory + L"\\*.*";
+    PathLong(search);
 
 
     // Find first file.
     WIN32_FIND_DATAW fd;
-    HANDLE handle = FindFirstFile(filenameDir, &fd);
+    HANDLE handle = FindFirstFile(search.c_str(), &fd);
 
     if (handle == INVALID_HANDLE_VALUE)
     {
@@ -601,7 +1127,7 @@ void ScanDirectory(const _TCHAR *filename)
     else
     {
         // Add the first file?
-        AddFile(fd, filenameParent);
+        AddFile(fd, directory, dir);
 
         // Add next
         BOOL result = FALSE;
@@ -611,7 +1137,7 @@ void ScanDirectory(const _TCHAR *filename)
 
             if (result == TRUE)
             {
-                AddFile(fd, filenameParent);
+                AddFile(fd, directory, dir);
             }
         }
         while(result == TRUE);
@@ -624,7 +1150,7 @@ void ScanDirectory(const _TCHAR *filename)
 // ------------------------------------------------------------------------
 // Checks for a file we can use.
 // ------------------------------------------------------------------------
-void AddFile(WIN32_FIND_DATAW &fd, const _TCHAR *parentDirectory)
+void AddFile(WIN32_FIND_DATAW &fd, const std::wstring &parentDirectory, const ScanDir *dir)
 {
     static const DWORD flags[] =
     {
@@ -646,15 +1172,30 @@ void AddFile(WIN32_FIND_DATAW &fd, const _TCHAR *parentDirectory)
             return;
         }
 
+        // Excluded directories aren't entered.
+        if (!excludeFilter.empty())
+        {
+            static std::string path;
+            PathUtf8(fd.cFileName, path);
+            path.insert(0, dir->path, dir->length);
+            FormName(path);
 
-        // Create the complete path
-        _TCHAR  directory[MAX_PATH];
+            if (NameFiltered(path, true))
+            {
+                if (verbose)
+                {
+                    printf("Excluding directory: %s\n", path.c_str());
+                }
+                return;
+            }
+        }
 
-        _tcscpy_s(directory, MAX_PATH, parentDirectory);
-        _tcscat_s(directory, MAX_PATH, L"\\");
-        _tcscat_s(directory, MAX_PATH, fd.cFileName);
 
-        ScanDirectory(directory);
+        // Create the complete path
+        std::wstring directory = parentDirectory + L"\\" + fd.cFileName;
+        PathLong(directory);
+
+        ScanDirectory(directory, CreateScanDir(dir, fd.cFileName));
         return;
     }
 
@@ -674,6 +1215,24 @@ void AddFile(WIN32_FIND_DATAW &fd, const _TCHAR *parentDirectory)
         return;
     }
 
+    // Filtered out?
+    if (!includeFilter.empty() || !excludeFilter.empty())
+    {
+        static std::string path;
+        PathUtf8(fd.cFileName, path);
+        path.insert(0, dir->path, dir->length);
+        FormName(path);
+
+        if (NameFiltered(path, false))
+        {
+            if (verbose)
+            {
+                printf("Excluding file: %s\n", path.c_str());
+            }
+            return;
+        }
+    }
+
     // File too large.
     if (fd.nFileSizeHigh != 0)
     {
@@ -681,17 +1240,38 @@ void AddFile(WIN32_FIND_DATAW &fd, const _TCHAR *parentDirectory)
         return;
     }
 
-    // Create the complete path
-    {
-        _TCHAR  filename[MAX_PATH];
+    // Store file.
+    CreateEntry(fd, dir);
+}
+
+
+// ------------------------------------------------------------------------
+// Stores a directory's path in the scan arena, once for all its files.
+// ------------------------------------------------------------------------
+const ScanDir *CreateScanDir(const ScanDir *parent, const WCHAR *name)
+{
+    // Save name as UTF-8, like the filenames.
+    static std::string utf8;
+    PathUtf8(name, utf8);
 
-        _tcscpy_s(filename, MAX_PATH, parentDirectory);
-        _tcscat_s(filename, MAX_PATH, L"\\");
-        _tcscat_s(filename, MAX_PATH, fd.cFileName);
+    size_t   nameLength = utf8.size();
+    ScanDir *dir        = (ScanDir*)ArenaAlloc(scanArena, sizeof(ScanDir), sizeof(void*));
+    char    *path       = (char*)ArenaAlloc(scanArena, parent->length + nameLength + 2);
 
-        // Store file.
-        CreateEntry(fd, filename);
+    if (dir == NULL || path == NULL)
+    {
+        printf("Memory alloc failed.");
+        exit(1);
     }
+
+    memcpy(path, parent->path, parent->length);
+    memcpy(path + parent->length, utf8.c_str(), nameLength);
+    path[parent->length + nameLength]     = '/';
+    path[parent->length + nameLength + 1] = 0;
+
+    dir->path   = path;
+    dir->length = (u32)(parent->length + nameLength + 1);
+    return dir;
 }
 
 
@@ -730,51 +1310,32 @@ void DebugShowLastError()
 }
 
 
-// ----------------------------------------------------------------------------
-// Turns a string into a number.
-// ----------------------------------------------------------------------------
-u32 StringHash(const char* string)
-{
-    u32 hash = 0;
-
-    while(*string)
-    {
-        hash += *string;
-        hash *= *string++;
-    }
-
-    return hash;
-}
-
-
 // ------------------------------------------------------------------------
 // Creates an archive entry.
 // ------------------------------------------------------------------------
-void CreateEntry(WIN32_FIND_DATAW &fd, const _TCHAR *filename)
+void CreateEntry(WIN32_FIND_DATAW &fd, const ScanDir *dir)
 {
     try
     {
-        // Create entry.
-        ArcEntry entry;
-
-        // No compression
-        entry.compressed       = false;
-        entry.compressionType  = COMPRESSION_TYPE_NONE;
-        entry.compressedSize   = 0;
-        entry.exp0             = 0;
-        entry.exp1             = 0;
-        entry.filesize         = fd.nFileSizeLow;
-        entry.hash             = 0;
-        entry.offset           = 0;
-
-        // Save filename as ansi. The simple way, no complex conversion functions here.
-        #ifdef  _UNICODE
-            sprintf_s(entry.filename, MAX_PATH, "%ls", filename);
-        #else
-            sprintf_s(entry.filename, MAX_PATH, "%s", filename);
-        #endif
-
-        filesToAdd.push_back(entry);
+        // Save filename as UTF-8, as it's given. It's put in the name form
+        // when the archive name is made, and reopened from this.
+        static std::string utf8;
+        PathUtf8(fd.cFileName, utf8);
+
+        ScanFile file;
+        file.dir      = dir;
+        file.name     = ArenaString(scanArena, utf8.c_str(), utf8.size());
+        file.source   = NULL;
+        file.filesize = fd.nFileSizeLow;
+        file.hash     = 0;
+        file.flags    = 0;
+        file.codec    = CODEC_DEFAULT;
+        file.level    = Z_DEFAULT_COMPRESSION;
+
+        if (file.name == NULL)
+            throw 0;
+
+        filesToAdd.push_back(file);
     }
     catch(...)
     {
@@ -785,430 +1346,1627 @@ void CreateEntry(WIN32_FIND_DATAW &fd, const _TCHAR *filename)
 
 
 // ------------------------------------------------------------------------
-// Create the fat
+// Create the archive
 // ------------------------------------------------------------------------
 bool WriteArchive()
 {
-    // Create the header
-    FatHeader   header;
-    header.magic1   = MAGIC1;
-    header.magic2   = MAGIC2;
-    header.size     = sizeof(FatHeader) + (sizeof(ArcEntry) * filesToAdd.size());
-    header.entries  = filesToAdd.size();
+    // Hash the archive names.
+    std::string name;
 
+    for (size_t i=0; i<filesToAdd.size(); i++)
+    {
+        MakeArchiveName(filesToAdd[i], name);
+        filesToAdd[i].hash = StringHash(name.c_str());
+    }
 
-    // Open the files
-    FILE *fp_fat = NULL;  
-    FILE *fp_arc = NULL;      
-    _tfopen_s(&fp_fat, outputFilename_Fat, L"wb");
-    _tfopen_s(&fp_arc, outputFilename_Arc, L"wb");  
-    if (fp_fat && fp_arc)
+    // Patches delete what's no longer in the directory.
+    if (gotBase)
     {
-        // Write the FAT header.
-        size_t bytes = fwrite(&header, 1, sizeof(FatHeader), fp_fat);
+        AddTombstones(filesToAdd);
+    }
 
 
-        // Create a copy of the files to add.
-        std::list<ArcEntry>entries;
+    // Sort for faster searching.
+    std::stable_sort(filesToAdd.begin(), filesToAdd.end(), ScanFileHashLess);
+
+    // Names that only became the same in the name form would make two
+    // entries for one name.
+    if (!CheckDuplicateNames(filesToAdd))
+    {
+        return false;
+    }
 
-        char work[MAX_PATH];
-        char temp[MAX_PATH];
-        int  len = _tcslen(inputDirectory_Full);
 
+    // Open the archive data. Appends go on the end of the existing data,
+    // which may be past where a 32 bit ftell can report.
+    FILE *fp_arc = NULL;
+    u64   offset = 0;
 
-        std::list<ArcEntry>::iterator it  = filesToAdd.begin();
-        std::list<ArcEntry>::iterator end = filesToAdd.end();
-        for(;it != end; ++it)
+    if (appendMode)
+    {
+        _tfopen_s(&fp_arc, outputFilename_Arc.c_str(), L"r+b");
+        if (fp_arc)
         {
-            ArcEntry entry;
+            s64 end = (_fseeki64(fp_arc, 0, SEEK_END) == 0) ? _ftelli64(fp_arc) : -1;
 
-            // Make copy of filename and remove input path.
-            sprintf_s(work, MAX_PATH, "%s", (*it).filename);
-            strcpy_s(temp, MAX_PATH, &work[len + 1]);
+            offset = ((u64)end + 3) & ~(u64)3;
 
-            if (upperCase)
+            if (end < 0 || _fseeki64(fp_arc, offset, SEEK_SET) != 0)
             {
-                _strupr_s(temp, MAX_PATH);
-            }
-            else if (lowerCase)
-            {
-                _strlwr_s(temp, MAX_PATH);
+                printf("Failed to find the end of the archive data\n");
+                fclose(fp_arc);
+                return false;
             }
+        }
+    }
+    else
+    {
+        _tfopen_s(&fp_arc, outputFilename_Arc.c_str(), L"wb");
+    }
 
-            // Ensure same slashes.
-            StringReplaceChar(temp, '\\', '/');
+    if (fp_arc == NULL)
+    {
+        printf("Failed to create archive files\n");
+        return false;
+    }
+
+
+    if (verbose)
+    {
+        printf("-------------------------------------------------------------------------------\n");
+        printf("    Offset Compressed     Actual       Hash\n");
+        printf("in archive       size   Filesize     Number : File\n");
+        printf("-------------------------------------------------------------------------------\n");
+    }
 
-            // Create entry
-            sprintf_s(entry.filename, MAX_PATH, "%s", (*it).filename);
+    // Write the data.
+    FatData fat;
 
-            entry.hash              = StringHash(temp);                     // Hash using stripped path!
-            entry.offset            = 0;
-            entry.filesize          = (*it).filesize;
-            entry.compressed        = (*it).compressed;
-            entry.compressedSize    = (*it).compressedSize;
-            entry.compressionType   = (*it).compressionType;
+    for (size_t i=0; i<filesToAdd.size(); i++)
+    {
+        bool skipped = false;
 
-            entries.push_back(entry);
+        if (!WriteEntryData(fp_arc, filesToAdd[i], offset, fat, skipped))
+        {
+            fclose(fp_arc);
+            return false;
         }
+    }
 
+    fclose(fp_arc);
 
-        // Sort for faster searching.
-        entries.sort();
 
-        if (verbose)
+    // Keep the existing entries that weren't replaced.
+    if (appendMode)
+    {
+        std::set<std::string> replaced;
+        for (size_t i=0; i<fat.entries.size(); i++)
         {
-            printf("-------------------------------------------------------------------------------\n");
-            printf("    Offset Compressed     Actual       Hash\n");
-            printf("in archive       size   Filesize     Number : File\n");
-            printf("-------------------------------------------------------------------------------\n");
+            replaced.insert(FatName(fat, fat.entries[i]));
         }
 
-        // Write the data.
+        for (u32 i=0; i<outputArchive.count; i++)
         {
-            u32 offset   = 0;
-            u32 filesize = 0;
+            const char *existing = ArcEntryName(outputArchive, outputArchive.entries + i);
 
-            std::list<ArcEntry>::iterator it1  = entries.begin();
-            std::list<ArcEntry>::iterator end1 = entries.end();
-            for(;it1 != end1; ++it1)
+            if (replaced.count(existing) == 0)
             {
-                // Open file to archive.
-                FILE *fp = NULL;
-                fopen_s(&fp, (*it1).filename, "rb");
-                if (fp)
-                {
-                    // Get file size
-                    if (fseek(fp, 0, SEEK_END) == 0)
-                    {
-                        filesize = ftell(fp);
-                        rewind(fp);       
-                    }
-
-
-                    // Sanity check - though should not happen as files are filtered.
-                    if (filesize == 0)
-                    {
-                        printf("Empty file found. Cannot complete process.\n");
-                        fclose(fp);
-                        goto Error;
-                    }
-
+                ArcEntry entry = outputArchive.entries[i];
+                entry.name     = AddName(fat, existing);
 
-                    // Read the data
-                    u8 *data = (u8*)malloc(filesize + 4);// + 4 for rounding
-                    if (data)
-                    {
-                        // Read the data
-                        size_t bytes = fread(data, 1, filesize, fp);
-                        fclose(fp);
-
-                        if (bytes != filesize || bytes != (*it1).filesize)
-                        {
-                            printf("File has changed size. Cannot complete process.\n");
-                            free(data);
-                            goto Error;
-                        }
-
-
-                        // Write to the archive
-                        if (crushData)
-                        {
-                            uLong  dataOutSize = 0;
-                            u8    *dataOut = NULL;
-
-                            if (CompressData(data, filesize, dataOutSize, &dataOut) == COMPRESS_SUCCESS)
-                            {
-                                fwrite(dataOut, 1, ROUND_UP(dataOutSize, 4), fp_arc);
-
-                                (*it1).compressed     = true;
-                                (*it1).compressedSize = dataOutSize;
-
-                                free(dataOut);
-                                dataOut = NULL;
-                            }
-                            else
-                            {
-                                //printf("File didn't compress %s > Normal: %i, Compressed: %i\n", (*it1).filename, filesize, dataOutSize);
-                                (*it1).compressed     = false;
-                                (*it1).compressedSize = 0;
-                                fwrite(data, 1, ROUND_UP(filesize, 4), fp_arc);
-                            }
-                        }
-                        else
-                        {
-                            fwrite(data, 1, ROUND_UP(filesize, 4), fp_arc);
-                        }
-
-                        free(data);
-
-
-                        // Write the entry.
-                        ArcEntry entry;
-
-
-                        // Make copy of filename and remove input path.
-                        sprintf_s(work, MAX_PATH, "%s", (*it1).filename);
-                        strcpy_s(entry.filename, MAX_PATH, &work[len + 1]);
-
-
-                        if (upperCase)
-                        {
-                            _strupr_s(entry.filename, MAX_PATH);
-                        }
-                        else if (lowerCase)
-                        {
-                            _strlwr_s(entry.filename, MAX_PATH);
-                        }
-
-
-                        // Ensure same slashes.
-                        StringReplaceChar(entry.filename, '\\', '/');
-
-
-                        // Create entry
-                        entry.hash              = StringHash(entry.filename);
-                        entry.offset            = offset;
-                        entry.filesize          = (*it1).filesize;
-                        entry.compressed        = (*it1).compressed;
-                        entry.compressedSize    = (*it1).compressedSize;
-                        entry.compressionType   = (*it1).compressionType;
-
-
-                        // Write entry.
-                        bytes = fwrite(&entry, 1, sizeof(entry), fp_fat);
-
-                        if (bytes != sizeof(entry))
-                        {
-                            printf("Failed to write archive entry correctly\n");
-                            free(data);
-                            goto Error;
-                        }
-
-
-                        if (crushData)
-                        {
-                            u32 size = 0;
-
-                            if ((*it1).compressed)
-                            {
-                                size = (*it1).compressedSize;
-                            }
-                            else
-                            {
-                                size = (*it1).filesize;
-                            }
-
-                            offset += ROUND_UP(size, 4);
-                        }
-                        else
-                        {
-                            u32 size = (*it1).filesize;
-
-                            offset += ROUND_UP(size, 4);
-                        }
-
-                        if (verbose)
-                        {
-                           printf("%*i %*i %*i %*x : %s\n", 10, entry.offset,
-                                                            10, entry.compressedSize,
-                                                            10, entry.filesize,
-                                                            10, entry.hash,
-                                                            entry.filename);
-                        }
-                    }
-                }
-                else
-                {
-                    printf("Failed to read file into archive.\n%s\n", (*it1).filename);
-                    continue;
-                }
+                fat.entries.push_back(entry);
             }
         }
 
-Error:
-        fclose(fp_fat);
-        fclose(fp_arc);
-    }
-    else
-    {
-        if (fp_fat)
-            fclose(fp_fat);
-
-        if (fp_arc)
-            fclose(fp_arc);
-
-        printf("Failed to create archive files\n");
-        return false;
+        std::stable_sort(fat.entries.begin(), fat.entries.end(), EntryHashLess);
     }
 
-
-    return true;
+    return WriteFat(outputFilename_Fat, fat);
 }
 
 
 // ------------------------------------------------------------------------
-// Compress file data.
+// Writes one file's data to the archive.
+//
+// source  == The file to write, or a tombstone
+// offset  == The archive offset to write at, advanced past the data
+// fat     == Receives the FAT entry
+// skipped == Set if the file didn't need writing
 // ------------------------------------------------------------------------
-int CompressData(const Bytef *data, uLong dataSize, uLong &dataOutSize, u8 **dataOut)
+bool WriteEntryData(FILE *fp_arc, const ScanFile &source, u64 &offset, FatData &fat, bool &skipped)
 {
-    if (dataOut == NULL)
-        return COMPRESS_FAILED;
+    // Kept from file to file, so their memory is reused.
+    static std::wstring path;
+    static std::string  name;
 
-    // Generate buffer size and the output buffer.
-    dataOutSize = compressBound(dataSize);
-    *dataOut    = (u8*)malloc(dataOutSize);
+    ArcEntry entry;
+    memset(&entry, 0, sizeof(ArcEntry));
 
-    // Alloc succeeded?
-    if (!*dataOut)
+    // Deleted entries only go in the FAT.
+    if (source.flags & ENTRY_FLAG_TOMBSTONE)
     {
-        return COMPRESS_FAILED;
-    }
+        entry.hash  = source.hash;
+        entry.flags = ENTRY_FLAG_TOMBSTONE;
+        entry.name  = AddName(fat, source.name);
+        fat.entries.push_back(entry);
 
-    // Compress
-    memset(*dataOut, 0, dataOutSize);
-    int err = compress(*dataOut, &dataOutSize, data, dataSize);
-    if (err == Z_OK)
-    {
-        if (dataOutSize >= dataSize)
+        if (verbose)
         {
-            free(*dataOut);
-            *dataOut = NULL;
-            return COMPRESS_LARGER;
+            printf("%*s : %s\n", 43, "Deleted", source.name);
         }
+        return true;
+    }
 
-        return COMPRESS_SUCCESS;
+    // Open file to archive.
+    FILE *fp = NULL;
+
+    if (MakeSourcePath(source, path))
+    {
+        _tfopen_s(&fp, path.c_str(), L"rb");
     }
-    else
+
+    if (fp == NULL)
     {
-        free(*dataOut);
-        *dataOut = NULL;
+        printf("Failed to read file into archive.\n%ls\n", path.c_str());
+        skipped = true;
+        return true;
+    }
 
-        if (err == Z_MEM_ERROR)
-        {
-            printf("Compression failed: Z_MEM_ERROR\n");
-        }
-        else if (err == Z_BUF_ERROR)
-        {
-            printf("Compression failed: Z_BUF_ERROR\n");
-        }
-        else
-        {
-            printf("Compression failed: Unknown error\n");
-        }
+    // Get file size
+    u32 filesize = 0;
+    if (fseek(fp, 0, SEEK_END) == 0)
+    {
+        filesize = ftell(fp);
+        rewind(fp);       
     }
 
-    return COMPRESS_FAILED;
-}
 
+    // Sanity check - though should not happen as files are filtered.
+    if (filesize == 0)
+    {
+        printf("Empty file found. Cannot complete process.\n");
+        fclose(fp);
+        return false;
+    }
 
-// ------------------------------------------------------------------------
-// Changes every occurrence of the search character with the replacement
-// character.
-// ------------------------------------------------------------------------
-void StringReplaceChar(char *string, char search, char replace)
-{
-    if (string && *string)
+
+    // Read the data
+    u8 *data = PoolBuffer(fileBuffer, filesize + 4);// + 4 for rounding
+    if (data == NULL)
     {
-        while(*string)
-        {
-            if (*string == search)
-                *string = replace;
+        printf("Memory alloc failed.");
+        fclose(fp);
+        return false;
+    }
 
-            string++;
-        }
+    size_t bytes = fread(data, 1, filesize, fp);
+    fclose(fp);
+
+    if (bytes != filesize || bytes != source.filesize)
+    {
+        printf("File has changed size. Cannot complete process.\n");
+        return false;
     }
-}
 
+    memset(data + filesize, 0, 4);
 
-#ifdef EXAMPLE_CODE
-ArcEntry * Locate(u32 hash, u32 entryCount, ArcEntry *pEntries);
 
-// ------------------------------------------------------------------------
-// Looks for some test files
-// ------------------------------------------------------------------------
-void Find()
-{
-    FILE *fp = fopen("arc_00.fat", "rb");
-    if (fp)
+    // Create the entry.
+    MakeArchiveName(source, name);
+
+
+    // Checksum the data while it's in the cache.
+    u32 crc = Crc32c(0, data, filesize);
+
+
+    // Patches only carry new or changed files, and appends only add them.
+    if ((gotBase    && UnchangedInArchive(baseArchive,   name.c_str(), data, filesize, crc)) ||
+        (appendMode && UnchangedInArchive(outputArchive, name.c_str(), data, filesize, crc)))
     {
-        // Get file size
-        fseek(fp, 0, SEEK_END);
-        s32 filesize = (s32)ftell(fp);
-        rewind(fp);       
+        skipped = true;
+        return true;
+    }
 
-        // Read data
-        u8 *buffer = (u8*)malloc(filesize);
-        fread(buffer, 1, filesize, fp);                        
-        fclose(fp);
+    entryCrcs[name] = crc;
 
-        // Point to data
-        FatHeader *pHeader     = (FatHeader*)(buffer);
-        ArcEntry  *pArcEntries = (ArcEntry*)(buffer + sizeof(FatHeader));
 
-        u32 count = pHeader->entries;
-        printf("Entries: %i\n", count);
+    // Write to the archive
+    const u8 *stored     = data;
+    u32       storedSize = filesize;
+    u8       *dataOut    = NULL;
 
-        ArcEntry *pEntry1 = Locate(StringHash("abc/a.txt"), count, pArcEntries);
-        ArcEntry *pEntry2 = Locate(StringHash("textures/dialog.png"), count, pArcEntries);
-        ArcEntry *pEntry3 = Locate(StringHash("textures/logo.png"), count, pArcEntries);
+    bool compress = (source.codec == CODEC_DEFAULT) ? crushData : (source.codec == CODEC_ZLIB);
 
-        if (pEntry1)
-        {
-            printf("Found '%s'\n", pEntry1->filename);
-        }
-        if (pEntry2)
-        {
-            printf("Found '%s'\n", pEntry2->filename);
-        }
-        if (pEntry3)
+    if (compress)
+    {
+        uLong dataOutSize = 0;
+
+        if (CompressData(data, filesize, dataOutSize, &dataOut, source.level) == COMPRESS_SUCCESS)
         {
-            printf("Found '%s'\n", pEntry3->filename);
-        }
+            stored     = dataOut;
+            storedSize = dataOutSize;
 
-        free(buffer);
+            entry.compressed     = true;
+            entry.compressedSize = dataOutSize;
+        }
     }
-}
 
+    if (offset > ARC_OFFSET_MAX)
+    {
+        printf("Archive data is past the 4GB entry offsets can reach: %s\n", name.c_str());
+        return false;
+    }
 
-// ------------------------------------------------------------------------
-// This function looks in an archive for a file.
-// ------------------------------------------------------------------------
-ArcEntry *Locate(u32 hash, u32 entryCount, ArcEntry *pEntries)
-{
-    ArcEntry *result = nullptr;
+    bytes = fwrite(stored, 1, ROUND_UP(storedSize, 4), fp_arc);
 
-    for (u32 i=0; i<entryCount; i++)
+    if (bytes != ROUND_UP(storedSize, 4))
     {
-        s32  lower = 0;
-        s32  upper = entryCount;
+        printf("Failed to write archive data correctly\n");
+        return false;
+    }
 
-        // Get table start
-        ArcEntry *pStart = pEntries;
 
-        while(lower <= upper)
-        {
-            s32 mid = (lower + upper) / 2;
+    // Create entry
+    entry.hash              = source.hash;
+    entry.offset            = (u32)offset;
+    entry.filesize          = source.filesize;
+    entry.compressionType   = entry.compressed ? COMPRESSION_TYPE_ZLIB : COMPRESSION_TYPE_NONE;
+    entry.name              = AddName(fat, name.c_str());
 
-            // Get mid entry
-            ArcEntry *pEntry = pStart;
-            pEntry += mid;
+    fat.entries.push_back(entry);
 
-            if (hash > pEntry->hash)
-            {
-                lower = mid + 1;
-            }
-            else if (hash < pEntry->hash)
+    offset += ROUND_UP(storedSize, 4);
+
+    if (verbose)
+    {
+       printf("%*u %*i %*i %*x : %s\n", 10, entry.offset,
+                                        10, entry.compressedSize,
+                                        10, entry.filesize,
+                                        10, entry.hash,
+                                        name.c_str());
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Orders entry indexes by name, for the path index.
+// ------------------------------------------------------------------------
+struct PathLess
+{
+    const FatData &fat;
+
+    PathLess(const FatData &data) : fat(data) {}
+
+    bool operator () (u32 lhs, u32 rhs) const
+    {
+        return strcmp(FatName(fat, fat.entries[lhs]), FatName(fat, fat.entries[rhs])) < 0;
+    }
+};
+
+
+// ------------------------------------------------------------------------
+// Writes the FAT. The entries must be sorted by hash.
+//
+// The FAT is written to a temporary file first and then moved over the
+// old one, so a failed write never leaves a damaged archive behind.
+// ------------------------------------------------------------------------
+bool WriteFat(const std::wstring &filename, const FatData &fat)
+{
+    std::wstring temp = filename + L".tmp";
+
+    if (!WriteFatFile(temp, fat))
+    {
+        return false;
+    }
+
+    if (!MoveFileEx(temp.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING))
+    {
+        printf("Failed to replace:\n%ls\n", filename.c_str());
+        DeleteFile(temp.c_str());
+        return false;
+    }
+
+    return UpdateAssetHeader(fat);
+}
+
+
+// ------------------------------------------------------------------------
+// Writes a FAT file. The file is deleted if the write fails.
+// ------------------------------------------------------------------------
+bool WriteFatFile(const std::wstring &filename, const FatData &fat)
+{
+    // Entries sharing a hash can only be told apart by name, so report them.
+    CheckCollisions(fat);
+
+    // Create the header
+    FatHeader   header;
+    header.magic1   = MAGIC1;
+    header.magic2   = formatV1 ? MAGIC2 : MAGIC2_V2;
+    header.size     = sizeof(FatHeader) + ((formatV1 ? sizeof(ArcEntryV1) : sizeof(ArcEntry)) * fat.entries.size());
+    header.entries  = fat.entries.size();
+
+    FILE *fp_fat = NULL;
+    _tfopen_s(&fp_fat, filename.c_str(), L"wb");
+    if (fp_fat == NULL)
+    {
+        printf("Failed to create archive files\n");
+        return false;
+    }
+
+    std::vector<u32> hashes;
+    std::vector<u32> crcs;
+    std::vector<u32> paths;
+    hashes.reserve(fat.entries.size());
+    crcs.reserve(fat.entries.size());
+    paths.reserve(fat.entries.size());
+
+    for (size_t i=0; i<fat.entries.size(); i++)
+    {
+        const ArcEntry &entry = fat.entries[i];
+
+        hashes.push_back(entry.hash);
+        crcs.push_back((entry.flags & ENTRY_FLAG_TOMBSTONE) ? 0 : entryCrcs[FatName(fat, entry)]);
+        paths.push_back((u32)i);
+    }
+
+    if (pathIndex)
+    {
+        std::sort(paths.begin(), paths.end(), PathLess(fat));
+    }
+
+    bool result = fwrite(&header, 1, sizeof(FatHeader), fp_fat) == sizeof(FatHeader) &&
+                  WriteEntries(fp_fat, fat);
+
+    // The names go first, next to the entries.
+    if (result && !formatV1 && !fat.names.empty())
+    {
+        result = WriteSection(fp_fat, FAT_SECTION_NAMES, fat.names, header.size, "Entry names");
+    }
+
+    // Say how the names were put in their form, so readers can do the same.
+    if (result && nameForm != 0)
+    {
+        std::vector<u8> data((const u8*)&nameForm, (const u8*)(&nameForm + 1));
+        result = WriteSection(fp_fat, FAT_SECTION_NAME_FORM, data, header.size, "Name form");
+    }
+
+    // Write the optional sections, then the final size.
+    result = result && WriteSections(fp_fat, hashes, crcs, paths, header.size);
+
+    if (result && (fseek(fp_fat, 0, SEEK_SET) != 0 || fwrite(&header, 1, sizeof(FatHeader), fp_fat) != sizeof(FatHeader)))
+    {
+        printf("Failed to write archive header correctly\n");
+        result = false;
+    }
+
+    if (fclose(fp_fat) != 0)
+    {
+        result = false;
+    }
+
+    if (!result)
+    {
+        DeleteFile(filename.c_str());
+    }
+
+    return result;
+}
+
+
+// ------------------------------------------------------------------------
+// Rewrites the asset header, if there is one. The header's indexes are only
+// right for one FAT, so it's written whenever the FAT is.
+// ------------------------------------------------------------------------
+bool UpdateAssetHeader(const FatData &fat)
+{
+    if (headerFilename_Full.empty())
+    {
+        return true;
+    }
+
+    std::vector<AssetName> assets;
+    for (size_t i=0; i<fat.entries.size(); i++)
+    {
+        if (fat.entries[i].flags & ENTRY_FLAG_TOMBSTONE)
+            continue;
+
+        AssetName asset;
+        asset.name  = FatName(fat, fat.entries[i]);
+        asset.hash  = fat.entries[i].hash;
+        asset.index = (u32)i;
+
+        assets.push_back(asset);
+    }
+
+    return WriteAssetHeader(headerFilename_Full.c_str(), assets);
+}
+
+
+// ------------------------------------------------------------------------
+// Writes the entry table. -v1 writes the old entries, with the names in
+// fixed buffers, which older readers expect.
+// ------------------------------------------------------------------------
+bool WriteEntries(FILE *fp_fat, const FatData &fat)
+{
+    for (size_t i=0; i<fat.entries.size(); i++)
+    {
+        const ArcEntry &entry = fat.entries[i];
+
+        if (!formatV1)
+        {
+            if (fwrite(&entry, 1, sizeof(ArcEntry), fp_fat) != sizeof(ArcEntry))
             {
-                upper = mid - 1;
+                printf("Failed to write archive entry correctly\n");
+                return false;
             }
-            else
+            continue;
+        }
+
+        const char *name   = FatName(fat, entry);
+        size_t      length = strlen(name);
+
+        ArcEntryV1 old;
+        memset(&old, 0, sizeof(ArcEntryV1));
+
+        if (length >= sizeof(old.filename))
+        {
+            printf("Name too long for -v1: %s\n", name);
+            return false;
+        }
+
+        old.hash            = entry.hash;
+        old.offset          = entry.offset;
+        old.filesize        = entry.filesize;
+        old.compressedSize  = entry.compressedSize;
+        old.compressed      = entry.compressed;
+        old.compressionType = entry.compressionType;
+        old.flags           = entry.flags;
+        old.exp1            = entry.exp1;
+        memcpy(old.filename, name, length + 1);
+
+        if (fwrite(&old, 1, sizeof(ArcEntryV1), fp_fat) != sizeof(ArcEntryV1))
+        {
+            printf("Failed to write archive entry correctly\n");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Writes the optional FAT sections after the entry table.
+//
+// hashes == The entry hashes in FAT order
+// crcs   == The entry checksums in FAT order
+// paths  == The entry indexes in name order
+// size   == The FAT size, updated with the sections written
+// ------------------------------------------------------------------------
+bool WriteSections(FILE *fp_fat, const std::vector<u32> &hashes, const std::vector<u32> &crcs, const std::vector<u32> &paths, u32 &size)
+{
+    std::vector<u8> data;
+
+    if (hashes.empty())
+    {
+        return true;
+    }
+
+    // The index only speeds lookups up, so the FAT is still written
+    // without it.
+    if (buildMph)
+    {
+        if (!MphBuild(&hashes[0], hashes.size(), data))
+        {
+            printf("Failed to build perfect hash index, writing the FAT without it\n");
+        }
+        else if (!WriteSection(fp_fat, FAT_SECTION_MPH_V2, data, size, "Perfect hash index"))
+        {
+            return false;
+        }
+    }
+
+    if (eytzinger)
+    {
+        // The key array is cache line aligned relative to the FAT start.
+        EytzingerBuild(&hashes[0], hashes.size(), size + sizeof(FatSection), data);
+
+        if (!WriteSection(fp_fat, FAT_SECTION_EYTZINGER, data, size, "Eytzinger search table"))
+        {
+            return false;
+        }
+    }
+
+    if (bloom)
+    {
+        BloomBuild(&hashes[0], hashes.size(), size + sizeof(FatSection), data);
+
+        if (!WriteSection(fp_fat, FAT_SECTION_BLOOM, data, size, "Bloom filter"))
+        {
+            return false;
+        }
+    }
+
+    if (checksums)
+    {
+        data.assign((const u8*)&crcs[0], (const u8*)&crcs[0] + crcs.size() * sizeof(u32));
+
+        if (!WriteSection(fp_fat, FAT_SECTION_CRC, data, size, "Entry checksums"))
+        {
+            return false;
+        }
+    }
+
+    if (pathIndex)
+    {
+        data.assign((const u8*)&paths[0], (const u8*)&paths[0] + paths.size() * sizeof(u32));
+
+        if (!WriteSection(fp_fat, FAT_SECTION_PATHS, data, size, "Path index"))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Writes one FAT section, padded to 8 bytes.
+// ------------------------------------------------------------------------
+bool WriteSection(FILE *fp_fat, u32 type, const std::vector<u8> &data, u32 &size, const char *description)
+{
+    static const u8 padding[8] = { 0 };
+
+    FatSection section;
+    section.type = type;
+    section.size = data.size();
+
+    u32 pad = ROUND_UP(section.size, 8) - section.size;
+    if (fwrite(&section, 1, sizeof(section), fp_fat) != sizeof(section) ||
+        fwrite(&data[0], 1, data.size(), fp_fat) != data.size() ||
+        fwrite(padding, 1, pad, fp_fat) != pad)
+    {
+        printf("Failed to write %s\n", description);
+        return false;
+    }
+
+    size += sizeof(section) + section.size + pad;
+
+    if (verbose)
+    {
+        printf("%s: %i bytes\n", description, section.size);
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Reports entries that share a hash. The entries must be sorted.
+// ------------------------------------------------------------------------
+bool CheckCollisions(const FatData &fat)
+{
+    const std::vector<ArcEntry> &entries = fat.entries;
+    bool                         unique  = true;
+
+    for (size_t i=1; i<entries.size(); i++)
+    {
+        if (entries[i].hash == entries[i - 1].hash)
+        {
+            printf("Hash collision: %s\n             : %s\n", FatName(fat, entries[i - 1]), FatName(fat, entries[i]));
+            unique = false;
+        }
+    }
+
+    return unique;
+}
+
+
+// ------------------------------------------------------------------------
+// Reports files that make the same archive name, with both their paths.
+// The files must be sorted by hash, so only those sharing a hash are
+// compared.
+// ------------------------------------------------------------------------
+bool CheckDuplicateNames(const std::vector<ScanFile> &files)
+{
+    std::string  name;
+    std::string  other;
+    std::wstring path;
+    std::wstring otherPath;
+    bool         unique = true;
+
+    for (size_t first=0; first<files.size(); )
+    {
+        size_t last = first + 1;
+        while (last < files.size() && files[last].hash == files[first].hash)
+        {
+            last++;
+        }
+
+        // Tombstones are only added for names no file makes.
+        for (size_t i=first; i+1<last; i++)
+        {
+            if (files[i].flags & ENTRY_FLAG_TOMBSTONE)
+                continue;
+
+            MakeArchiveName(files[i], name);
+
+            for (size_t j=i+1; j<last; j++)
             {
-                result = pEntry;
-                break;
+                if (files[j].flags & ENTRY_FLAG_TOMBSTONE)
+                    continue;
+
+                MakeArchiveName(files[j], other);
+                if (name == other)
+                {
+                    MakeSourcePath(files[i], path);
+                    MakeSourcePath(files[j], otherPath);
+
+                    printf("Files make the same archive name: %s\n%ls\n%ls\n", name.c_str(), path.c_str(), otherPath.c_str());
+                    unique = false;
+                }
             }
         }
+
+        first = last;
     }
 
-    return result;
+    return unique;
+}
+
+
+// ------------------------------------------------------------------------
+// Adds a name to the FAT's name pool. Returns its offset.
+// ------------------------------------------------------------------------
+u32 AddName(FatData &fat, const char *name)
+{
+    u32 offset = (u32)fat.names.size();
+
+    fat.names.insert(fat.names.end(), (const u8*)name, (const u8*)name + strlen(name) + 1);
+    return offset;
 }
-#endif
\ No newline at end of file
+
+
+// ------------------------------------------------------------------------
+// Gets the name of an entry in a FAT being written.
+// ------------------------------------------------------------------------
+const char *FatName(const FatData &fat, const ArcEntry &entry)
+{
+    return (const char*)&fat.names[entry.name];
+}
+
+
+// ------------------------------------------------------------------------
+// Orders entries by hash.
+// ------------------------------------------------------------------------
+bool EntryHashLess(const ArcEntry &lhs, const ArcEntry &rhs)
+{
+    return lhs.hash < rhs.hash;
+}
+
+
+// ------------------------------------------------------------------------
+// Orders scanned files by hash.
+// ------------------------------------------------------------------------
+bool ScanFileHashLess(const ScanFile &lhs, const ScanFile &rhs)
+{
+    return lhs.hash < rhs.hash;
+}
+
+
+// ------------------------------------------------------------------------
+// Gets a buffer of at least size bytes from a pool. The pool grows to the
+// largest size asked for and is reused, so most files allocate nothing.
+// Returns NULL if the pool can't grow.
+// ------------------------------------------------------------------------
+u8 *PoolBuffer(std::vector<u8> &pool, size_t size)
+{
+    if (pool.size() < size)
+    {
+        try
+        {
+            pool.resize(size);
+        }
+        catch(...)
+        {
+            return NULL;
+        }
+    }
+
+    return pool.data();
+}
+
+
+// ------------------------------------------------------------------------
+// Compress file data. dataOut is set to a pooled buffer, which is only good
+// until the next call.
+// ------------------------------------------------------------------------
+int CompressData(const Bytef *data, uLong dataSize, uLong &dataOutSize, u8 **dataOut, int level)
+{
+    if (dataOut == NULL)
+        return COMPRESS_FAILED;
+
+    // Generate buffer size and the output buffer, + 4 for rounding.
+    dataOutSize = DeflateParallelBound(dataSize);
+    *dataOut    = PoolBuffer(compressBuffer, dataOutSize + 4);
+
+    // Alloc succeeded?
+    if (!*dataOut)
+    {
+        return COMPRESS_FAILED;
+    }
+
+    // Compress. Big files are split across threads.
+    int err = (dataSize >= PARALLEL_DEFLATE_MIN) ? DeflateParallel(*dataOut, &dataOutSize, data, dataSize, level)
+                                                 : DeflateReuse(*dataOut, &dataOutSize, data, dataSize, level);
+    if (err == Z_OK)
+    {
+        if (dataOutSize >= dataSize)
+        {
+            *dataOut = NULL;
+            return COMPRESS_LARGER;
+        }
+
+        memset(*dataOut + dataOutSize, 0, 4);
+        return COMPRESS_SUCCESS;
+    }
+    else
+    {
+        *dataOut = NULL;
+
+        if (err == Z_MEM_ERROR)
+        {
+            printf("Compression failed: Z_MEM_ERROR\n");
+        }
+        else if (err == Z_BUF_ERROR)
+        {
+            printf("Compression failed: Z_BUF_ERROR\n");
+        }
+        else
+        {
+            printf("Compression failed: Unknown error\n");
+        }
+    }
+
+    return COMPRESS_FAILED;
+}
+
+
+// ------------------------------------------------------------------------
+// Makes the name stored in the archive from a scanned file's directory and
+// filename, in the name form. So names that only differ by composition, or
+// by case with -lc or -uc, hash the same.
+// ------------------------------------------------------------------------
+void MakeArchiveName(const ScanFile &file, std::string &name)
+{
+    name.assign(file.dir->path, file.dir->length);
+    name += file.name;
+
+    FormName(name);
+}
+
+
+// ------------------------------------------------------------------------
+// Puts a name in the archive's name form.
+// ------------------------------------------------------------------------
+void FormName(std::string &name)
+{
+    static std::string given;
+
+    if (nameForm == 0 || ArcNameIsNormal(name.c_str(), nameForm))
+    {
+        return;
+    }
+
+    given.swap(name);
+    name.resize(ArcNormaliseName(given.c_str(), nameForm, NULL, 0));
+    ArcNormaliseName(given.c_str(), nameForm, &name[0], name.size() + 1);
+}
+
+
+// ------------------------------------------------------------------------
+// Loads the .patignore file at the top of the directory being scanned, if
+// there is one, and compiles the filters. Patterns are put in the name form,
+// so they are matched against names as they will be stored.
+// ------------------------------------------------------------------------
+bool LoadFilters()
+{
+    std::wstring ignoreFilename = inputDirectory_Full + L"\\.patignore";
+
+    if (gotInput && !gotList && FileExist(ignoreFilename.c_str()))
+    {
+        if (!GlobLoadList(ignoreFilename.c_str(), excludePatterns))
+        {
+            return false;
+        }
+
+        // The ignore file isn't archived itself.
+        excludePatterns.push_back("/.patignore");
+    }
+
+    for (size_t i=0; i<includePatterns.size(); i++)
+    {
+        FormName(includePatterns[i]);
+    }
+
+    for (size_t i=0; i<excludePatterns.size(); i++)
+    {
+        FormName(excludePatterns[i]);
+    }
+
+    GlobCompile(includePatterns, includeFilter);
+    GlobCompile(excludePatterns, excludeFilter);
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Tests whether a scanned name, in the name form, is filtered out. Excludes
+// apply to files and directories, and includes only to files.
+// ------------------------------------------------------------------------
+bool NameFiltered(const std::string &name, bool directory)
+{
+    if (GlobMatchPath(excludeFilter, name.c_str(), directory))
+        return true;
+
+    return !directory && !includeFilter.empty() && !GlobMatchPath(includeFilter, name.c_str(), false);
+}
+
+
+// ------------------------------------------------------------------------
+// Tests whether a base archive name would have been filtered out of the
+// scan, either itself or by one of its directories.
+// ------------------------------------------------------------------------
+bool BaseNameFiltered(const char *name)
+{
+    std::string path;
+
+    for (const char *slash = strchr(name, '/'); slash; slash = strchr(slash + 1, '/'))
+    {
+        path.assign(name, slash - name);
+
+        if (GlobMatchPath(excludeFilter, path.c_str(), true))
+            return true;
+    }
+
+    return NameFiltered(name, false);
+}
+
+
+// ------------------------------------------------------------------------
+// Adds the files named by a -list file, or by stdin for "-". Each line is
+// tab separated: the file to read, then optionally its archive name and its
+// codec. Blank lines and lines starting with '#' are skipped.
+// ------------------------------------------------------------------------
+bool LoadList()
+{
+    FILE *fp = stdin;
+
+    if (listFilename != L"-")
+    {
+        fp = NULL;
+        _tfopen_s(&fp, listFilename.c_str(), L"r");
+        if (fp == NULL)
+        {
+            printf("Failed to open file list:\n%ls\n", listFilename.c_str());
+            return false;
+        }
+    }
+
+    std::string line;
+    u32         lineNumber = 0;
+    bool        result     = true;
+
+    while (result && PathReadLine(fp, line, lineNumber == 0))
+    {
+        lineNumber++;
+
+        if (!line.empty() && line[0] != '#')
+        {
+            result = AddListFile(line, lineNumber);
+        }
+    }
+
+    if (fp != stdin)
+    {
+        fclose(fp);
+    }
+
+    return result;
+}
+
+
+// ------------------------------------------------------------------------
+// Adds one file from a -list. Relative paths are from the -i directory if
+// there is one, otherwise the working directory. Without an archive name
+// the path must be relative, and is used as the name.
+// ------------------------------------------------------------------------
+bool AddListFile(const std::string &line, u32 lineNumber)
+{
+    // Split the fields.
+    std::string fields[3];
+    size_t      fieldCount = 0;
+    size_t      start      = 0;
+
+    for (;;)
+    {
+        size_t tab = line.find('\t', start);
+
+        if (fieldCount == ARRAY_SIZE(fields))
+        {
+            printf("Too many fields on line %u of the file list\n", lineNumber);
+            return false;
+        }
+
+        fields[fieldCount++] = line.substr(start, tab - start);
+
+        if (tab == std::string::npos)
+            break;
+
+        start = tab + 1;
+    }
+
+    const std::string &source = fields[0];
+    std::string        name   = fields[1];
+
+    if (source.empty())
+    {
+        printf("No file on line %u of the file list\n", lineNumber);
+        return false;
+    }
+
+    ScanFile file;
+    file.dir      = &rootDir;
+    file.source   = NULL;
+    file.hash     = 0;
+    file.flags    = 0;
+    file.codec    = CODEC_DEFAULT;
+    file.level    = Z_DEFAULT_COMPRESSION;
+
+    if (!ParseCodec(fields[2], file.codec, file.level))
+    {
+        printf("Unknown codec on line %u of the file list: %s\n", lineNumber, fields[2].c_str());
+        return false;
+    }
+
+    // Name the file after its relative path, unless it's given a name.
+    bool relative = PathRelative(source.c_str());
+
+    if (name.empty() || name == "-")
+    {
+        if (!relative)
+        {
+            printf("No archive name for a full path on line %u of the file list\n", lineNumber);
+            return false;
+        }
+
+        name = source;
+    }
+
+    std::replace(name.begin(), name.end(), '\\', '/');
+
+    while (name.compare(0, 2, "./") == 0)
+    {
+        name.erase(0, 2);
+    }
+
+    if (name.empty() || name[0] == '/' || name[name.size() - 1] == '/')
+    {
+        printf("Bad archive name on line %u of the file list: %s\n", lineNumber, name.c_str());
+        return false;
+    }
+
+    // Find the file.
+    std::wstring path;
+    std::wstring full;
+
+    int length = MultiByteToWideChar(CP_UTF8, 0, source.c_str(), -1, NULL, 0);
+    if (length == 0)
+    {
+        printf("Bad file name on line %u of the file list\n", lineNumber);
+        return false;
+    }
+
+    path.resize(length);
+    MultiByteToWideChar(CP_UTF8, 0, source.c_str(), -1, &path[0], length);
+    path.resize(length - 1);
+
+    if (relative && gotInput)
+    {
+        path.insert(0, inputDirectory + L"\\");
+    }
+
+    if (!PathFull(path.c_str(), full))
+    {
+        printf("Failed to get full path name for:\n%ls\n", path.c_str());
+        return false;
+    }
+
+    path = full;
+    PathLong(path);
+
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesEx(path.c_str(), GetFileExInfoStandard, &attributes))
+    {
+        printf("Failed to find file on line %u of the file list:\n%ls\n", lineNumber, full.c_str());
+        return false;
+    }
+
+    if (attributes.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY)
+    {
+        printf("Not a file on line %u of the file list:\n%ls\n", lineNumber, full.c_str());
+        return false;
+    }
+
+    // Skipped as the scan skips them.
+    if (attributes.nFileSizeLow == 0 && attributes.nFileSizeHigh == 0)
+    {
+        return true;
+    }
+
+    if (attributes.nFileSizeHigh != 0)
+    {
+        printf("Files larger than %lu bytes are not supported: %ls\n", 0xffffffff, full.c_str());
+        return true;
+    }
+
+    // Filtered out?
+    FormName(name);
+
+    if (NameFiltered(name, false))
+    {
+        if (verbose)
+        {
+            printf("Excluding file: %s\n", name.c_str());
+        }
+        return true;
+    }
+
+    // A name given twice would make two entries for it.
+    std::map<std::string, u32>::iterator given = listNames.find(name);
+    if (given != listNames.end())
+    {
+        printf("Archive name on line %u of the file list is already on line %u: %s\n", lineNumber, given->second, name.c_str());
+        return false;
+    }
+
+    listNames[name] = lineNumber;
+
+    // Store file.
+    std::string utf8;
+    PathUtf8(full.c_str(), utf8);
+
+    try
+    {
+        file.name     = ArenaString(scanArena, name.c_str(), name.size());
+        file.source   = ArenaString(scanArena, utf8.c_str(), utf8.size());
+        file.filesize = attributes.nFileSizeLow;
+
+        if (file.name == NULL || file.source == NULL)
+            throw 0;
+
+        filesToAdd.push_back(file);
+    }
+    catch(...)
+    {
+        printf("Memory alloc failed.");
+        exit(1);
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Reads a -list codec: none, zlib or zlib:level, with a level from 0 to 9.
+// Empty or "-" leaves the file to -c.
+// ------------------------------------------------------------------------
+bool ParseCodec(const std::string &text, u8 &codec, s8 &level)
+{
+    if (text.empty() || text == "-")
+    {
+        codec = CODEC_DEFAULT;
+        return true;
+    }
+
+    if (_stricmp(text.c_str(), "none") == 0)
+    {
+        codec = CODEC_NONE;
+        return true;
+    }
+
+    if (_strnicmp(text.c_str(), "zlib", 4) != 0)
+    {
+        return false;
+    }
+
+    codec = CODEC_ZLIB;
+
+    if (text.size() == 4)
+    {
+        level = Z_DEFAULT_COMPRESSION;
+        return true;
+    }
+
+    if (text.size() == 6 && text[4] == ':' && text[5] >= '0' && text[5] <= '9')
+    {
+        level = (s8)(text[5] - '0');
+        return true;
+    }
+
+    return false;
+}
+
+
+// ------------------------------------------------------------------------
+// Tests whether a path is relative, with no drive or leading separator.
+// ------------------------------------------------------------------------
+bool PathRelative(const char *path)
+{
+    if (path[0] == '\\' || path[0] == '/')
+        return false;
+
+    return !(isalpha((unsigned char)path[0]) && path[1] == ':');
+}
+
+
+// ------------------------------------------------------------------------
+// Makes the full path of a scanned file, to open it. Long paths get the
+// \\?\ prefix, so every separator must be a '\\'. Returns false if the
+// name can't be converted.
+// ------------------------------------------------------------------------
+bool MakeSourcePath(const ScanFile &file, std::wstring &path)
+{
+    static std::string relative;
+
+    // Listed files have their full path already.
+    if (file.source)
+    {
+        int length = MultiByteToWideChar(CP_UTF8, 0, file.source, -1, NULL, 0);
+        if (length == 0)
+        {
+            return false;
+        }
+
+        path.resize(length);
+        MultiByteToWideChar(CP_UTF8, 0, file.source, -1, &path[0], length);
+        path.resize(length - 1);
+
+        PathLong(path);
+        return true;
+    }
+
+    relative.assign(file.dir->path, file.dir->length);
+    relative += file.name;
+
+    int length = MultiByteToWideChar(CP_UTF8, 0, relative.c_str(), -1, NULL, 0);
+    if (length == 0)
+    {
+        return false;
+    }
+
+    path  = inputDirectory_Full;
+    path += L'\\';
+
+    size_t start = path.size();
+    path.resize(start + length);
+    MultiByteToWideChar(CP_UTF8, 0, relative.c_str(), -1, &path[start], length);
+    path.resize(start + length - 1);
+
+    std::replace(path.begin() + start, path.end(), L'/', L'\\');
+    PathLong(path);
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Opens the archive a patch is made against.
+// ------------------------------------------------------------------------
+bool OpenBase()
+{
+    std::wstring baseFilename_Full;
+
+    if (!PathFull(baseFilename.c_str(), baseFilename_Full))
+    {
+        printf("Failed to get full path name for:\n%ls\n", baseFilename.c_str());
+        return false;
+    }
+
+    std::wstring fat = baseFilename_Full + L".fat";
+    std::wstring arc = baseFilename_Full + L".arc";
+    PathLong(fat);
+    PathLong(arc);
+
+    if (!PathOpenArchive(baseArchive, fat, &arc))
+    {
+        printf("Failed to open base archive:\n%ls\n", fat.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Adds a tombstone for every base entry that's no longer in the directory.
+// ------------------------------------------------------------------------
+void AddTombstones(std::vector<ScanFile> &files)
+{
+    std::set<std::string> names;
+    std::string           name;
+
+    for (size_t i=0; i<files.size(); i++)
+    {
+        MakeArchiveName(files[i], name);
+        names.insert(name);
+    }
+
+    // The base archive stays open while writing, so its names can be used.
+    for (u32 i=0; i<baseArchive.count; i++)
+    {
+        const ArcEntry &base     = baseArchive.entries[i];
+        const char     *baseName = ArcEntryName(baseArchive, &base);
+
+        // Filtered names weren't looked for, so they aren't deleted.
+        if ((base.flags & ENTRY_FLAG_TOMBSTONE) == 0 && names.count(baseName) == 0 && !BaseNameFiltered(baseName))
+        {
+            ScanFile file;
+            file.dir      = &rootDir;
+            file.name     = baseName;
+            file.source   = NULL;
+            file.filesize = 0;
+            file.hash     = base.hash;
+            file.flags    = ENTRY_FLAG_TOMBSTONE;
+            file.codec    = CODEC_DEFAULT;
+            file.level    = Z_DEFAULT_COMPRESSION;
+
+            files.push_back(file);
+        }
+    }
+}
+
+
+// ------------------------------------------------------------------------
+// Opens the existing archive named by -o, to append to or compact.
+// ------------------------------------------------------------------------
+bool OpenOutput()
+{
+    if (!PathOpenArchive(outputArchive, outputFilename_Fat, &outputFilename_Arc))
+    {
+        printf("Failed to open archive:\n%ls\n", outputFilename_Fat.c_str());
+        return false;
+    }
+
+    // Keep the indexes the archive already has, and its format.
+    buildMph  = buildMph  || outputArchive.mph       != NULL;
+    eytzinger = eytzinger || outputArchive.eytzinger != NULL;
+    bloom     = bloom     || outputArchive.bloom     != NULL;
+    checksums = checksums || outputArchive.crcs      != NULL;
+    pathIndex = pathIndex || outputArchive.paths     != NULL;
+    formatV1  = formatV1  || outputArchive.convertBlock != NULL;
+
+    // Compaction keeps the names as they are. Appended names must be in the
+    // form the archive's names are in.
+    if (compactMode)
+    {
+        nameForm = outputArchive.nameForm;
+    }
+    else if (outputArchive.nameForm != 0 && outputArchive.nameForm != nameForm)
+    {
+        printf("The archive's names use a different case conversion (-lc or -uc)\n");
+        return false;
+    }
+
+    // Keep the existing checksums, or make them if they're being added.
+    for (u32 i=0; i<outputArchive.count && checksums; i++)
+    {
+        const ArcEntry *pEntry = outputArchive.entries + i;
+
+        if (pEntry->flags & ENTRY_FLAG_TOMBSTONE)
+            continue;
+
+        const char *name = ArcEntryName(outputArchive, pEntry);
+
+        if (outputArchive.crcs)
+        {
+            entryCrcs[name] = outputArchive.crcs[i];
+            continue;
+        }
+
+        u8 *data = PoolBuffer(archiveBuffer, pEntry->filesize);
+        if (data == NULL || !ArcRead(outputArchive, pEntry, data))
+        {
+            printf("Failed to read entry: %s\n", name);
+            return false;
+        }
+
+        entryCrcs[name] = Crc32c(0, data, pEntry->filesize);
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Checks if a file is the same as an archive's copy. If the archive has
+// checksums, most changed files are caught without reading the copy.
+// ------------------------------------------------------------------------
+bool UnchangedInArchive(const ArcArchive &archive, const char *name, const u8 *data, u32 filesize, u32 crc)
+{
+    ArcEntry *pEntry = ArcFindName(archive, name);
+    if (pEntry == NULL || (pEntry->flags & ENTRY_FLAG_TOMBSTONE) || pEntry->filesize != filesize)
+    {
+        return false;
+    }
+
+    if (archive.crcs && archive.crcs[pEntry - archive.entries] != crc)
+    {
+        return false;
+    }
+
+    u8 *baseData = PoolBuffer(archiveBuffer, filesize);
+    if (baseData == NULL)
+    {
+        return false;
+    }
+
+    bool same = ArcRead(archive, pEntry, baseData) && memcmp(baseData, data, filesize) == 0;
+
+    if (same && verbose)
+    {
+        printf("%*s : %s\n", 43, "Unchanged", name);
+    }
+
+    return same;
+}
+
+
+// ------------------------------------------------------------------------
+// Orders entry indexes for the compaction layout.
+// ------------------------------------------------------------------------
+struct LayoutLess
+{
+    const FatData &fat;
+
+    LayoutLess(const FatData &data) : fat(data) {}
+
+    bool operator () (u32 lhs, u32 rhs) const
+    {
+        switch(layout)
+        {
+        case LAYOUT_HASH:
+            return lhs < rhs;
+
+        case LAYOUT_NAME:
+            return strcmp(FatName(fat, fat.entries[lhs]), FatName(fat, fat.entries[rhs])) < 0;
+
+        default:
+            return fat.entries[lhs].offset < fat.entries[rhs].offset;
+        }
+    }
+};
+
+
+// ------------------------------------------------------------------------
+// Rewrites the archive data without dead regions.
+//
+// Live data is streamed through a fixed buffer into a new archive file, in
+// the chosen layout order. Compressed data is copied as is. Entries that
+// share data keep sharing it.
+// ------------------------------------------------------------------------
+bool CompactArchive()
+{
+    FatData                 fat;
+    std::vector<u32>        order;
+    std::map<u32, u32>      moved;
+
+    // The name offsets stay valid with a copy of the pool.
+    fat.entries.assign(outputArchive.entries, outputArchive.entries + outputArchive.count);
+    fat.names.assign((const u8*)outputArchive.names, (const u8*)outputArchive.names + outputArchive.namesSize);
+
+    for (u32 i=0; i<fat.entries.size(); i++)
+    {
+        if ((fat.entries[i].flags & ENTRY_FLAG_TOMBSTONE) == 0)
+        {
+            order.push_back(i);
+        }
+    }
+
+    std::stable_sort(order.begin(), order.end(), LayoutLess(fat));
+
+
+    // Get the old archive size.
+    u64 oldSize = 0;
+    if (_fseeki64(outputArchive.arc, 0, SEEK_END) == 0)
+    {
+        oldSize = _ftelli64(outputArchive.arc);
+    }
+
+
+    std::wstring temp = outputFilename_Arc + L".tmp";
+
+    FILE *fp_arc = NULL;
+    _tfopen_s(&fp_arc, temp.c_str(), L"wb");
+    u8   *buffer = (u8*)malloc(COMPACT_BUFFER_SIZE);
+    if (fp_arc == NULL || buffer == NULL)
+    {
+        printf("Failed to create archive files\n");
+        if (fp_arc)
+            fclose(fp_arc);
+        free(buffer);
+        return false;
+    }
+
+
+    // Copy the live data.
+    bool result = true;
+    u32  offset = 0;
+
+    for (size_t o=0; o<order.size() && result; o++)
+    {
+        ArcEntry &entry = fat.entries[order[o]];
+        u32       size  = ROUND_UP(entry.compressed ? entry.compressedSize : entry.filesize, 4);
+
+        std::map<u32, u32>::iterator it = moved.find(entry.offset);
+        if (it != moved.end())
+        {
+            entry.offset = it->second;
+            continue;
+        }
+
+        if ((u64)entry.offset + size > oldSize)
+        {
+            printf("Entry data is outside the archive: %s\n", FatName(fat, entry));
+            result = false;
+            break;
+        }
+
+        result = CopyData(outputArchive.arc, fp_arc, entry.offset, size, buffer);
+
+        moved[entry.offset] = offset;
+        entry.offset        = offset;
+        offset             += size;
+
+        if (verbose)
+        {
+            printf("%*i %*i : %s\n", 10, entry.offset, 10, size, FatName(fat, entry));
+        }
+    }
+
+    free(buffer);
+
+    if (fclose(fp_arc) != 0 || !result)
+    {
+        printf("Failed to write archive data correctly\n");
+        DeleteFile(temp.c_str());
+        return false;
+    }
+
+
+    // Write the FAT pointing at the new data before touching either file.
+    // The old data is then moved aside rather than replaced, so if the FAT
+    // can't be swapped in the old data goes back and still matches the old
+    // FAT.
+    std::wstring fatTemp = outputFilename_Fat + L".tmp";
+    std::wstring backup  = outputFilename_Arc + L".bak";
+
+    if (!WriteFatFile(fatTemp, fat))
+    {
+        DeleteFile(temp.c_str());
+        return false;
+    }
+
+    ArcClose(outputArchive);
+
+    if (!MoveFileEx(outputFilename_Arc.c_str(), backup.c_str(), MOVEFILE_REPLACE_EXISTING))
+    {
+        printf("Failed to replace:\n%ls\n", outputFilename_Arc.c_str());
+        DeleteFile(temp.c_str());
+        DeleteFile(fatTemp.c_str());
+        return false;
+    }
+
+    if (!MoveFileEx(temp.c_str(), outputFilename_Arc.c_str(), 0))
+    {
+        printf("Failed to replace:\n%ls\n", outputFilename_Arc.c_str());
+        RestoreBackup(backup, outputFilename_Arc);
+        DeleteFile(temp.c_str());
+        DeleteFile(fatTemp.c_str());
+        return false;
+    }
+
+    if (!MoveFileEx(fatTemp.c_str(), outputFilename_Fat.c_str(), MOVEFILE_REPLACE_EXISTING))
+    {
+        printf("Failed to replace:\n%ls\n", outputFilename_Fat.c_str());
+        RestoreBackup(backup, outputFilename_Arc);
+        DeleteFile(fatTemp.c_str());
+        return false;
+    }
+
+    DeleteFile(backup.c_str());
+
+    if (!UpdateAssetHeader(fat))
+    {
+        return false;
+    }
+
+    printf("Compacted %llu bytes to %u bytes\n", oldSize, offset);
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Copies a block of data between files through the buffer.
+// ------------------------------------------------------------------------
+bool CopyData(FILE *fp_in, FILE *fp_out, u64 offset, u32 size, u8 *buffer)
+{
+    if (_fseeki64(fp_in, offset, SEEK_SET) != 0)
+    {
+        return false;
+    }
+
+    while (size > 0)
+    {
+        u32 chunk = (size < COMPACT_BUFFER_SIZE) ? size : COMPACT_BUFFER_SIZE;
+
+        if (fread(buffer, 1, chunk, fp_in) != chunk || fwrite(buffer, 1, chunk, fp_out) != chunk)
+        {
+            return false;
+        }
+
+        size -= chunk;
+    }
+
+    return true;
+}
+
+
+// ------------------------------------------------------------------------
+// Moves the old archive data back after a failed swap. If that fails too
+// the backup is kept, and named so it can be restored by hand.
+// ------------------------------------------------------------------------
+void RestoreBackup(const std::wstring &backup, const std::wstring &filename)
+{
+    if (!MoveFileEx(backup.c_str(), filename.c_str(), MOVEFILE_REPLACE_EXISTING))
+    {
+        printf("Failed to restore the archive data. The old data is in:\n%ls\n", backup.c_str());
+    }
+}
+
+
+#ifdef EXAMPLE_CODE
+// ------------------------------------------------------------------------
+// Looks for some test files
+// ------------------------------------------------------------------------
+void Find()
+{
+    ArcArchive archive;
+    if (ArcOpen(archive, "arc_00.fat"))
+    {
+        printf("Entries: %i\n", archive.count);
+
+        ArcEntry *pEntry1 = ArcFindName(archive, "abc/a.txt");
+        ArcEntry *pEntry2 = ArcFindName(archive, "textures/dialog.png");
+        ArcEntry *pEntry3 = ArcFind(archive, StringHash("textures/logo.png"));
+
+        if (pEntry1)
+        {
+            printf("Found '%s'\n", ArcEntryName(archive, pEntry1));
+        }
+        if (pEntry2)
+        {
+            printf("Found '%s'\n", ArcEntryName(archive, pEntry2));
+        }
+        if (pEntry3)
+        {
+            printf("Found '%s'\n", ArcEntryName(archive, pEntry3));
+        }
+
+        ArcClose(archive);
+    }
+}
+#endif
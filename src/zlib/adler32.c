@@ -6,6 +6,7 @@
 /* @(#) $Id$ */
 
 #include "zutil.h"
+#include "adler32_simd.h"
 
 #define local static
 
@@ -101,6 +102,17 @@ uLong ZEXPORT adler32(adler, buf, len)
         return adler | (sum2 << 16);
     }
 
+#ifdef Z_X86_SIMD
+    /* use the widest SIMD the CPU has */
+    if (len >= 64) {
+        cpu_check_features();
+        if (x86_cpu_has_avx2)
+            return adler32_avx2(adler | (sum2 << 16), buf, len);
+        if (x86_cpu_has_ssse3)
+            return adler32_ssse3(adler | (sum2 << 16), buf, len);
+    }
+#endif
+
     /* do length NMAX blocks -- requires just one modulo operation */
     while (len >= NMAX) {
         len -= NMAX;
@@ -0,0 +1,162 @@
+/* adler32_simd.c -- SIMD Adler-32
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Each 32 byte block adds the byte sum to s1, and the bytes weighted 32..1
+ * to s2, plus 32 times s1 from before the block. The weights are applied
+ * with a multiply-add, and the per block s1 terms are summed in a vector
+ * and shifted left by 5 at the end of each run of NMAX bytes.
+ */
+
+#include "adler32_simd.h"
+
+#if defined(Z_X86_SIMD)
+
+#include <immintrin.h>
+
+#define BASE 65521      /* largest prime smaller than 65536 */
+#define NMAX 5552       /* see adler32.c */
+#define BLOCK_SIZE 32
+
+/* ========================================================================= */
+/* Finishes the bytes after the last whole block. */
+local uLong adler32_tail(s1, s2, buf, len)
+    unsigned long s1;
+    unsigned long s2;
+    const Bytef *buf;
+    uInt len;
+{
+    while (len--) {
+        s1 += *buf++;
+        s2 += s1;
+    }
+    s1 %= BASE;
+    s2 %= BASE;
+    return s1 | (s2 << 16);
+}
+
+/* ========================================================================= */
+Z_TARGET("ssse3")
+uLong ZLIB_INTERNAL adler32_ssse3(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long s1 = adler & 0xffff;
+    unsigned long s2 = (adler >> 16) & 0xffff;
+    uInt blocks = len / BLOCK_SIZE;
+    const __m128i tap1 = _mm_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,
+                                       24, 23, 22, 21, 20, 19, 18, 17);
+    const __m128i tap2 = _mm_setr_epi8(16, 15, 14, 13, 12, 11, 10, 9,
+                                       8, 7, 6, 5, 4, 3, 2, 1);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi16(1);
+
+    len -= blocks * BLOCK_SIZE;
+
+    while (blocks) {
+        uInt n = NMAX / BLOCK_SIZE;
+        __m128i v_ps, v_s1, v_s2;
+
+        if (n > blocks)
+            n = blocks;
+        blocks -= n;
+
+        v_ps = _mm_set_epi32(0, 0, 0, (int)(s1 * n));
+        v_s2 = _mm_set_epi32(0, 0, 0, (int)s2);
+        v_s1 = _mm_setzero_si128();
+
+        do {
+            const __m128i bytes1 = _mm_loadu_si128((const __m128i *)buf);
+            const __m128i bytes2 = _mm_loadu_si128((const __m128i *)(buf + 16));
+
+            /* s1 before this block, counted 32 times at the end */
+            v_ps = _mm_add_epi32(v_ps, v_s1);
+
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes1, zero));
+            v_s2 = _mm_add_epi32(v_s2,
+                       _mm_madd_epi16(_mm_maddubs_epi16(bytes1, tap1), ones));
+            v_s1 = _mm_add_epi32(v_s1, _mm_sad_epu8(bytes2, zero));
+            v_s2 = _mm_add_epi32(v_s2,
+                       _mm_madd_epi16(_mm_maddubs_epi16(bytes2, tap2), ones));
+
+            buf += BLOCK_SIZE;
+        } while (--n);
+
+        v_s2 = _mm_add_epi32(v_s2, _mm_slli_epi32(v_ps, 5));
+
+        /* horizontal sums */
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s1 = _mm_add_epi32(v_s1, _mm_shuffle_epi32(v_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+        v_s2 = _mm_add_epi32(v_s2, _mm_shuffle_epi32(v_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        s1 = (s1 + (unsigned)_mm_cvtsi128_si32(v_s1)) % BASE;
+        s2 = (unsigned)_mm_cvtsi128_si32(v_s2) % BASE;
+    }
+
+    return adler32_tail(s1, s2, buf, len);
+}
+
+/* ========================================================================= */
+Z_TARGET("avx2")
+uLong ZLIB_INTERNAL adler32_avx2(adler, buf, len)
+    uLong adler;
+    const Bytef *buf;
+    uInt len;
+{
+    unsigned long s1 = adler & 0xffff;
+    unsigned long s2 = (adler >> 16) & 0xffff;
+    uInt blocks = len / BLOCK_SIZE;
+    const __m256i tap = _mm256_setr_epi8(32, 31, 30, 29, 28, 27, 26, 25,
+                                         24, 23, 22, 21, 20, 19, 18, 17,
+                                         16, 15, 14, 13, 12, 11, 10, 9,
+                                         8, 7, 6, 5, 4, 3, 2, 1);
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i ones = _mm256_set1_epi16(1);
+
+    len -= blocks * BLOCK_SIZE;
+
+    while (blocks) {
+        uInt n = NMAX / BLOCK_SIZE;
+        __m256i v_ps, v_s1, v_s2;
+        __m128i h_s1, h_s2;
+
+        if (n > blocks)
+            n = blocks;
+        blocks -= n;
+
+        v_ps = _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, (int)(s1 * n));
+        v_s2 = _mm256_set_epi32(0, 0, 0, 0, 0, 0, 0, (int)s2);
+        v_s1 = _mm256_setzero_si256();
+
+        do {
+            const __m256i bytes = _mm256_loadu_si256((const __m256i *)buf);
+
+            /* s1 before this block, counted 32 times at the end */
+            v_ps = _mm256_add_epi32(v_ps, v_s1);
+
+            v_s1 = _mm256_add_epi32(v_s1, _mm256_sad_epu8(bytes, zero));
+            v_s2 = _mm256_add_epi32(v_s2,
+                       _mm256_madd_epi16(_mm256_maddubs_epi16(bytes, tap), ones));
+
+            buf += BLOCK_SIZE;
+        } while (--n);
+
+        v_s2 = _mm256_add_epi32(v_s2, _mm256_slli_epi32(v_ps, 5));
+
+        /* horizontal sums */
+        h_s1 = _mm_add_epi32(_mm256_castsi256_si128(v_s1), _mm256_extracti128_si256(v_s1, 1));
+        h_s2 = _mm_add_epi32(_mm256_castsi256_si128(v_s2), _mm256_extracti128_si256(v_s2, 1));
+        h_s1 = _mm_add_epi32(h_s1, _mm_shuffle_epi32(h_s1, _MM_SHUFFLE(2, 3, 0, 1)));
+        h_s1 = _mm_add_epi32(h_s1, _mm_shuffle_epi32(h_s1, _MM_SHUFFLE(1, 0, 3, 2)));
+        h_s2 = _mm_add_epi32(h_s2, _mm_shuffle_epi32(h_s2, _MM_SHUFFLE(2, 3, 0, 1)));
+        h_s2 = _mm_add_epi32(h_s2, _mm_shuffle_epi32(h_s2, _MM_SHUFFLE(1, 0, 3, 2)));
+
+        s1 = (s1 + (unsigned)_mm_cvtsi128_si32(h_s1)) % BASE;
+        s2 = (unsigned)_mm_cvtsi128_si32(h_s2) % BASE;
+    }
+
+    return adler32_tail(s1, s2, buf, len);
+}
+
+#endif /* Z_X86_SIMD */
@@ -0,0 +1,18 @@
+/* adler32_simd.h -- SIMD Adler-32
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef ADLER32_SIMD_H
+#define ADLER32_SIMD_H
+
+#include "cpu_features.h"
+
+#if defined(Z_X86_SIMD)
+/* Continue an Adler-32 over a buffer, 32 bytes a step. */
+uLong ZLIB_INTERNAL adler32_ssse3 OF((uLong adler, const Bytef *buf,
+                                      uInt len));
+uLong ZLIB_INTERNAL adler32_avx2 OF((uLong adler, const Bytef *buf,
+                                     uInt len));
+#endif
+
+#endif /* ADLER32_SIMD_H */
@@ -0,0 +1,79 @@
+/* cpu_features.c -- run time detection of x86 SIMD instruction sets
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#include "cpu_features.h"
+
+#if defined(Z_X86_SIMD)
+#  if defined(_MSC_VER)
+#    include <intrin.h>
+#  else
+#    include <cpuid.h>
+#  endif
+#endif
+
+#define local static
+
+int ZLIB_INTERNAL x86_cpu_has_ssse3;
+int ZLIB_INTERNAL x86_cpu_has_sse41;
+int ZLIB_INTERNAL x86_cpu_has_pclmul;
+int ZLIB_INTERNAL x86_cpu_has_avx2;
+
+local volatile int cpu_checked = 0;
+
+#if defined(Z_X86_SIMD)
+/* ========================================================================= */
+local void cpuid(leaf, regs)
+    unsigned leaf;
+    unsigned regs[4];
+{
+#if defined(_MSC_VER)
+    __cpuidex((int *)regs, (int)leaf, 0);
+#else
+    __cpuid_count(leaf, 0, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+/* ========================================================================= */
+/* Checks the OS saves the AVX registers on a context switch. */
+local int os_saves_ymm()
+{
+    unsigned lo;
+#if defined(_MSC_VER)
+    lo = (unsigned)_xgetbv(0);
+#else
+    unsigned hi;
+    __asm__ __volatile__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+#endif
+    return (lo & 6) == 6;
+}
+#endif
+
+/* ========================================================================= */
+void ZLIB_INTERNAL cpu_check_features()
+{
+#if defined(Z_X86_SIMD)
+    unsigned regs[4];
+    unsigned maxLeaf;
+
+    if (cpu_checked)
+        return;
+
+    cpuid(0, regs);
+    maxLeaf = regs[0];
+
+    cpuid(1, regs);
+    x86_cpu_has_ssse3  = (regs[2] & (1 << 9)) != 0;
+    x86_cpu_has_sse41  = (regs[2] & (1 << 19)) != 0;
+    x86_cpu_has_pclmul = (regs[2] & (1 << 1)) != 0;
+
+    /* AVX2 needs OSXSAVE and AVX, and the OS to save the registers. */
+    if ((regs[2] & (1 << 27)) && (regs[2] & (1 << 28)) && maxLeaf >= 7 &&
+        os_saves_ymm()) {
+        cpuid(7, regs);
+        x86_cpu_has_avx2 = (regs[1] & (1 << 5)) != 0;
+    }
+
+    cpu_checked = 1;
+#endif
+}
@@ -0,0 +1,32 @@
+/* cpu_features.h -- run time detection of x86 SIMD instruction sets
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef CPU_FEATURES_H
+#define CPU_FEATURES_H
+
+#include "zutil.h"
+
+/* SIMD kernels are built for x86 and x64, and picked at run time. */
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#  define Z_X86_SIMD
+#endif
+
+/* Lets a function use an instruction set the rest of the file isn't built
+   for. MSVC always allows the intrinsics. */
+#if defined(__GNUC__) || defined(__clang__)
+#  define Z_TARGET(x) __attribute__((target(x)))
+#else
+#  define Z_TARGET(x)
+#endif
+
+extern int ZLIB_INTERNAL x86_cpu_has_ssse3;
+extern int ZLIB_INTERNAL x86_cpu_has_sse41;
+extern int ZLIB_INTERNAL x86_cpu_has_pclmul;
+extern int ZLIB_INTERNAL x86_cpu_has_avx2;
+
+/* Fills in the x86_cpu_has flags. Cheap after the first call, and safe to
+   call from several threads as every caller writes the same values. */
+void ZLIB_INTERNAL cpu_check_features OF((void));
+
+#endif /* CPU_FEATURES_H */
@@ -29,6 +29,7 @@
 #endif /* MAKECRCH */
 
 #include "zutil.h"      /* for STDC and FAR definitions */
+#include "crc32_simd.h"
 
 #define local static
 
@@ -213,6 +214,24 @@ unsigned long ZEXPORT crc32(crc, buf, len)
         make_crc_table();
 #endif /* DYNAMIC_CRC_TABLE */
 
+#ifdef Z_X86_SIMD
+    /* fold whole 16 byte blocks with carry-less multiplies, then finish
+       the rest below */
+    if (len >= CRC32_PCLMUL_MINIMUM) {
+        cpu_check_features();
+        if (x86_cpu_has_pclmul && x86_cpu_has_sse41) {
+            uInt chunk = len & ~15U;
+
+            crc = crc32_pclmul((unsigned)crc ^ 0xffffffffU, buf, chunk) ^
+                  0xffffffffUL;
+            buf += chunk;
+            len -= chunk;
+            if (len == 0)
+                return crc;
+        }
+    }
+#endif
+
 #ifdef BYFOUR
     if (sizeof(void *) == sizeof(ptrdiff_t)) {
         z_crc_t endian;
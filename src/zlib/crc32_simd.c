@@ -0,0 +1,130 @@
+/* crc32_simd.c -- CRC-32 folded with carry-less multiplies
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ *
+ * Folds the buffer 64 bytes a step into four 128 bit lanes with PCLMULQDQ,
+ * then folds the lanes into one, and Barrett reduces it to 32 bits. This is
+ * the method from Intel's "Fast CRC Computation for Generic Polynomials Using
+ * PCLMULQDQ Instruction", with the constants for the bit reflected zlib
+ * polynomial.
+ */
+
+#include "crc32_simd.h"
+
+#if defined(Z_X86_SIMD)
+
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#  define Z_ALIGN16 __declspec(align(16))
+#else
+#  define Z_ALIGN16 __attribute__((aligned(16)))
+#endif
+
+/* ========================================================================= */
+Z_TARGET("sse4.1,pclmul")
+unsigned ZLIB_INTERNAL crc32_pclmul(crc, buf, len)
+    unsigned crc;
+    const Bytef *buf;
+    uInt len;
+{
+    /* x^(4*128+32), x^(4*128-32), x^(128+32), x^(128-32), x^64 mod P, and
+       the Barrett constants, all bit reflected */
+    static const Z_ALIGN16 unsigned long long k1k2[2] = { 0x0154442bd4ULL, 0x01c6e41596ULL };
+    static const Z_ALIGN16 unsigned long long k3k4[2] = { 0x01751997d0ULL, 0x00ccaa009eULL };
+    static const Z_ALIGN16 unsigned long long k5k0[2] = { 0x0163cd6124ULL, 0x0000000000ULL };
+    static const Z_ALIGN16 unsigned long long poly[2] = { 0x01db710641ULL, 0x01f7011641ULL };
+
+    __m128i x0, x1, x2, x3, x4, x5, x6, x7, x8, y5, y6, y7, y8;
+
+    /* the first 64 bytes, with the crc folded into the first lane */
+    x1 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+    x2 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+    x3 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+    x4 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128((int)crc));
+
+    x0 = _mm_load_si128((const __m128i *)k1k2);
+
+    buf += 64;
+    len -= 64;
+
+    /* fold 64 bytes a step */
+    while (len >= 64) {
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x6 = _mm_clmulepi64_si128(x2, x0, 0x00);
+        x7 = _mm_clmulepi64_si128(x3, x0, 0x00);
+        x8 = _mm_clmulepi64_si128(x4, x0, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, x0, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, x0, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, x0, 0x11);
+
+        y5 = _mm_loadu_si128((const __m128i *)(buf + 0x00));
+        y6 = _mm_loadu_si128((const __m128i *)(buf + 0x10));
+        y7 = _mm_loadu_si128((const __m128i *)(buf + 0x20));
+        y8 = _mm_loadu_si128((const __m128i *)(buf + 0x30));
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), y5);
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), y6);
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), y7);
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), y8);
+
+        buf += 64;
+        len -= 64;
+    }
+
+    /* fold the four lanes into one */
+    x0 = _mm_load_si128((const __m128i *)k3k4);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x3), x5);
+
+    x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+    x1 = _mm_xor_si128(_mm_xor_si128(x1, x4), x5);
+
+    /* fold 16 bytes a step */
+    while (len >= 16) {
+        x2 = _mm_loadu_si128((const __m128i *)buf);
+
+        x5 = _mm_clmulepi64_si128(x1, x0, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, x0, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x2), x5);
+
+        buf += 16;
+        len -= 16;
+    }
+
+    /* fold 128 bits to 64 */
+    x2 = _mm_clmulepi64_si128(x1, x0, 0x10);
+    x3 = _mm_setr_epi32(~0, 0, ~0, 0);
+    x1 = _mm_srli_si128(x1, 8);
+    x1 = _mm_xor_si128(x1, x2);
+
+    x0 = _mm_loadl_epi64((const __m128i *)k5k0);
+
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_and_si128(x1, x3);
+    x1 = _mm_clmulepi64_si128(x1, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    /* Barrett reduce to 32 bits */
+    x0 = _mm_load_si128((const __m128i *)poly);
+
+    x2 = _mm_and_si128(x1, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x10);
+    x2 = _mm_and_si128(x2, x3);
+    x2 = _mm_clmulepi64_si128(x2, x0, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+
+    return (unsigned)_mm_extract_epi32(x1, 1);
+}
+
+#endif /* Z_X86_SIMD */
@@ -0,0 +1,20 @@
+/* crc32_simd.h -- CRC-32 folded with carry-less multiplies
+ * For conditions of distribution and use, see copyright notice in zlib.h
+ */
+
+#ifndef CRC32_SIMD_H
+#define CRC32_SIMD_H
+
+#include "cpu_features.h"
+
+/* The shortest buffer crc32_pclmul() takes. */
+#define CRC32_PCLMUL_MINIMUM 64
+
+#if defined(Z_X86_SIMD)
+/* Continues an inverted CRC-32 register over len bytes. len must be at least
+   CRC32_PCLMUL_MINIMUM and a multiple of 16. */
+unsigned ZLIB_INTERNAL crc32_pclmul OF((unsigned crc, const Bytef *buf,
+                                        uInt len));
+#endif
+
+#endif /* CRC32_SIMD_H */
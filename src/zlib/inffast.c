@@ -10,24 +10,74 @@
 
 #ifndef ASMINF
 
-/* Allow machine dependent optimization for post-increment or pre-increment.
-   Based on testing to date,
-   Pre-increment preferred for:
-   - PowerPC G3 (Adler)
-   - MIPS R5000 (Randers-Pehrson)
-   Post-increment preferred for:
-   - none
-   No measurable difference:
-   - Pentium III (Anderson)
-   - M68060 (Nikl)
- */
-#ifdef POSTINC
-#  define OFF 0
-#  define PUP(a) *(a)++
+#include "cpu_features.h"
+
+/* The bit buffer. 64 bits holds a whole length/distance pair after one
+   refill. */
+typedef unsigned long long z_hold;
+
+/* inflate_fast() refills the bit buffer with an 8 byte load, and copies
+   matches in 8 or 16 byte chunks. */
+#define INFLATE_FAST_CHUNK 16
+
+/* ========================================================================= */
+/* Loads 8 bytes as a little endian number. */
+local z_hold load64(p)
+z_const unsigned char FAR *p;
+{
+#ifdef Z_X86_SIMD
+    z_hold value;
+    memcpy(&value, p, sizeof(value));
+    return value;
 #else
-#  define OFF 1
-#  define PUP(a) *++(a)
+    return (z_hold)p[0] | ((z_hold)p[1] << 8) | ((z_hold)p[2] << 16) |
+           ((z_hold)p[3] << 24) | ((z_hold)p[4] << 32) |
+           ((z_hold)p[5] << 40) | ((z_hold)p[6] << 48) | ((z_hold)p[7] << 56);
 #endif
+}
+
+/* ========================================================================= */
+/* Copies a match from earlier in the output, dist bytes back, and returns
+   the new output position. Distances of 8 or more are copied in whole
+   chunks, which can write up to INFLATE_FAST_CHUNK - 1 bytes past the
+   match. The caller leaves room for that, and the bytes are overwritten
+   by later output. */
+local unsigned char FAR *copy_match(out, dist, len)
+unsigned char FAR *out;
+unsigned dist;
+unsigned len;
+{
+    unsigned char FAR *from = out - dist;
+    unsigned char FAR *stop = out + len;
+
+    if (dist >= INFLATE_FAST_CHUNK) {           /* chunks don't overlap */
+        do {
+            memcpy(out, from, INFLATE_FAST_CHUNK);
+            out += INFLATE_FAST_CHUNK;
+            from += INFLATE_FAST_CHUNK;
+        } while (out < stop);
+    }
+    else if (dist >= 8) {
+        do {
+            memcpy(out, from, 8);
+            out += 8;
+            from += 8;
+        } while (out < stop);
+    }
+    else if (dist == 1) {                       /* run of one byte */
+        z_hold run = *from * 0x0101010101010101ULL;
+        do {
+            memcpy(out, &run, 8);
+            out += 8;
+        } while (out < stop);
+    }
+    else {                                      /* short repeating pattern */
+        do {
+            *out++ = *from++;
+        } while (out < stop);
+    }
+    return stop;
+}
 
 /*
    Decode literal, length, and distance codes and write out the resulting
@@ -40,8 +90,8 @@
    Entry assumptions:
 
         state->mode == LEN
-        strm->avail_in >= 6
-        strm->avail_out >= 258
+        strm->avail_in >= INFLATE_FAST_MIN_INPUT
+        strm->avail_out >= INFLATE_FAST_MIN_OUTPUT
         start >= strm->avail_out
         state->bits < 8
 
@@ -55,14 +105,17 @@
 
     - The maximum input bits used by a length/distance pair is 15 bits for the
       length code, 5 bits for the length extra, 15 bits for the distance code,
-      and 13 bits for the distance extra.  This totals 48 bits, or six bytes.
-      Therefore if strm->avail_in >= 6, then there is enough input to avoid
-      checking for available input while decoding.
+      and 13 bits for the distance extra.  This totals 48 bits.  Each loop
+      starts by loading 8 bytes into a 64 bit buffer, leaving at least 56 bits,
+      so no more input is read until the next loop.  The load advances past
+      whole bytes only, and the bits of a partly used byte are loaded again
+      at the same place next time, so it doesn't matter that they are there.
 
     - The maximum bytes that a single length/distance pair can output is 258
-      bytes, which is the maximum length that can be coded.  inflate_fast()
-      requires strm->avail_out >= 258 for each loop to avoid checking for
-      output space.
+      bytes, which is the maximum length that can be coded.  Matches within
+      the output are copied in chunks that can write up to 15 bytes further.
+      inflate_fast() requires strm->avail_out >= 273 for each loop to avoid
+      checking for output space.
  */
 void ZLIB_INTERNAL inflate_fast(strm, start)
 z_streamp strm;
@@ -81,7 +134,7 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
     unsigned whave;             /* valid bytes in the window */
     unsigned wnext;             /* window write index */
     unsigned char FAR *window;  /* allocated sliding window, if wsize != 0 */
-    unsigned long hold;         /* local strm->hold */
+    z_hold hold;                /* local strm->hold */
     unsigned bits;              /* local strm->bits */
     code const FAR *lcode;      /* local strm->lencode */
     code const FAR *dcode;      /* local strm->distcode */
@@ -96,11 +149,11 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
 
     /* copy state to local variables */
     state = (struct inflate_state FAR *)strm->state;
-    in = strm->next_in - OFF;
-    last = in + (strm->avail_in - 5);
-    out = strm->next_out - OFF;
+    in = strm->next_in;
+    last = in + (strm->avail_in - (INFLATE_FAST_MIN_INPUT - 1));
+    out = strm->next_out;
     beg = out - (start - strm->avail_out);
-    end = out + (strm->avail_out - 257);
+    end = out + (strm->avail_out - (INFLATE_FAST_MIN_OUTPUT - 1));
 #ifdef INFLATE_STRICT
     dmax = state->dmax;
 #endif
@@ -118,12 +171,9 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
     /* decode literals and length/distances until end-of-block or not enough
        input data or output space */
     do {
-        if (bits < 15) {
-            hold += (unsigned long)(PUP(in)) << bits;
-            bits += 8;
-            hold += (unsigned long)(PUP(in)) << bits;
-            bits += 8;
-        }
+        hold |= load64(in) << bits;             /* refill to 56..63 bits */
+        in += (63 - bits) >> 3;
+        bits |= 56;
         here = lcode[hold & lmask];
       dolen:
         op = (unsigned)(here.bits);
@@ -134,27 +184,17 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
             Tracevv((stderr, here.val >= 0x20 && here.val < 0x7f ?
                     "inflate:         literal '%c'\n" :
                     "inflate:         literal 0x%02x\n", here.val));
-            PUP(out) = (unsigned char)(here.val);
+            *out++ = (unsigned char)(here.val);
         }
         else if (op & 16) {                     /* length base */
             len = (unsigned)(here.val);
             op &= 15;                           /* number of extra bits */
             if (op) {
-                if (bits < op) {
-                    hold += (unsigned long)(PUP(in)) << bits;
-                    bits += 8;
-                }
                 len += (unsigned)hold & ((1U << op) - 1);
                 hold >>= op;
                 bits -= op;
             }
             Tracevv((stderr, "inflate:         length %u\n", len));
-            if (bits < 15) {
-                hold += (unsigned long)(PUP(in)) << bits;
-                bits += 8;
-                hold += (unsigned long)(PUP(in)) << bits;
-                bits += 8;
-            }
             here = dcode[hold & dmask];
           dodist:
             op = (unsigned)(here.bits);
@@ -164,14 +204,6 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
             if (op & 16) {                      /* distance base */
                 dist = (unsigned)(here.val);
                 op &= 15;                       /* number of extra bits */
-                if (bits < op) {
-                    hold += (unsigned long)(PUP(in)) << bits;
-                    bits += 8;
-                    if (bits < op) {
-                        hold += (unsigned long)(PUP(in)) << bits;
-                        bits += 8;
-                    }
-                }
                 dist += (unsigned)hold & ((1U << op) - 1);
 #ifdef INFLATE_STRICT
                 if (dist > dmax) {
@@ -196,30 +228,30 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
 #ifdef INFLATE_ALLOW_INVALID_DISTANCE_TOOFAR_ARRR
                         if (len <= op - whave) {
                             do {
-                                PUP(out) = 0;
+                                *out++ = 0;
                             } while (--len);
                             continue;
                         }
                         len -= op - whave;
                         do {
-                            PUP(out) = 0;
+                            *out++ = 0;
                         } while (--op > whave);
                         if (op == 0) {
                             from = out - dist;
                             do {
-                                PUP(out) = PUP(from);
+                                *out++ = *from++;
                             } while (--len);
                             continue;
                         }
 #endif
                     }
-                    from = window - OFF;
+                    from = window;
                     if (wnext == 0) {           /* very common case */
                         from += wsize - op;
                         if (op < len) {         /* some from window */
                             len -= op;
                             do {
-                                PUP(out) = PUP(from);
+                                *out++ = *from++;
                             } while (--op);
                             from = out - dist;  /* rest from output */
                         }
@@ -230,14 +262,14 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                         if (op < len) {         /* some from end of window */
                             len -= op;
                             do {
-                                PUP(out) = PUP(from);
+                                *out++ = *from++;
                             } while (--op);
-                            from = window - OFF;
+                            from = window;
                             if (wnext < len) {  /* some from start of window */
                                 op = wnext;
                                 len -= op;
                                 do {
-                                    PUP(out) = PUP(from);
+                                    *out++ = *from++;
                                 } while (--op);
                                 from = out - dist;      /* rest from output */
                             }
@@ -248,36 +280,25 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
                         if (op < len) {         /* some from window */
                             len -= op;
                             do {
-                                PUP(out) = PUP(from);
+                                *out++ = *from++;
                             } while (--op);
                             from = out - dist;  /* rest from output */
                         }
                     }
                     while (len > 2) {
-                        PUP(out) = PUP(from);
-                        PUP(out) = PUP(from);
-                        PUP(out) = PUP(from);
+                        *out++ = *from++;
+                        *out++ = *from++;
+                        *out++ = *from++;
                         len -= 3;
                     }
                     if (len) {
-                        PUP(out) = PUP(from);
+                        *out++ = *from++;
                         if (len > 1)
-                            PUP(out) = PUP(from);
+                            *out++ = *from++;
                     }
                 }
                 else {
-                    from = out - dist;          /* copy direct from output */
-                    do {                        /* minimum length is three */
-                        PUP(out) = PUP(from);
-                        PUP(out) = PUP(from);
-                        PUP(out) = PUP(from);
-                        len -= 3;
-                    } while (len > 2);
-                    if (len) {
-                        PUP(out) = PUP(from);
-                        if (len > 1)
-                            PUP(out) = PUP(from);
-                    }
+                    out = copy_match(out, dist, len);   /* copy from output */
                 }
             }
             else if ((op & 64) == 0) {          /* 2nd level distance code */
@@ -313,12 +334,15 @@ unsigned start;         /* inflate()'s starting value for strm->avail_out */
     hold &= (1U << bits) - 1;
 
     /* update state and return */
-    strm->next_in = in + OFF;
-    strm->next_out = out + OFF;
-    strm->avail_in = (unsigned)(in < last ? 5 + (last - in) : 5 - (in - last));
+    strm->next_in = in;
+    strm->next_out = out;
+    strm->avail_in = (unsigned)(in < last ?
+                                (INFLATE_FAST_MIN_INPUT - 1) + (last - in) :
+                                (INFLATE_FAST_MIN_INPUT - 1) - (in - last));
     strm->avail_out = (unsigned)(out < end ?
-                                 257 + (end - out) : 257 - (out - end));
-    state->hold = hold;
+                                 (INFLATE_FAST_MIN_OUTPUT - 1) + (end - out) :
+                                 (INFLATE_FAST_MIN_OUTPUT - 1) - (out - end));
+    state->hold = (unsigned long)hold;
     state->bits = bits;
     return;
 }
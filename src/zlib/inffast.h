@@ -8,4 +8,10 @@
    subject to change. Applications should only use zlib.h.
  */
 
+/* inflate_fast() needs this much input, as it refills its bit buffer 8
+   bytes at a time, and this much output: the longest match, plus the bytes
+   a chunked match copy can write past its end. */
+#define INFLATE_FAST_MIN_INPUT 8
+#define INFLATE_FAST_MIN_OUTPUT (258 + 15)
+
 void ZLIB_INTERNAL inflate_fast OF((z_streamp strm, unsigned start));
@@ -0,0 +1,196 @@
+#
+#  Copyright 2016 Redcliffe Interactive
+#
+#  Licensed under the Apache License, Version 2.0 (the "License");
+#  you may not use this file except in compliance with the License.
+#  You may obtain a copy of the License at
+#
+#      http://www.apache.org/licenses/LICENSE-2.0
+#
+#  Unless required by applicable law or agreed to in writing, software
+#  distributed under the License is distributed on an "AS IS" BASIS,
+#  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#  See the License for the specific language governing permissions and
+#  limitations under the License.
+#
+
+# Writes src/ArcUnicodeTables.h from Python's Unicode database.
+#
+#   python tools/MakeUnicodeTables.py > src/ArcUnicodeTables.h
+#
+# Each code point gets a record with its canonical combining class, its full
+# canonical decomposition, its simple case folding and upper case mapping, and
+# flags saying whether it is left alone by each name form. The records are
+# found through a two stage table, which stops after the last code point
+# that isn't left alone. ASCII has its flags in a table of its own, with NUL
+# having none. The composition pairs are listed sorted, for a
+# binary search. Hangul syllables are handled by the code.
+
+import sys
+import unicodedata
+
+
+SHIFT       = 6
+BLOCK       = 1 << SHIFT
+MAX_CODE    = 0x110000
+
+S_BASE, L_BASE, V_BASE, T_BASE = 0xAC00, 0x1100, 0x1161, 0x11A7
+L_COUNT, V_COUNT, T_COUNT      = 19, 21, 28
+S_COUNT                        = L_COUNT * V_COUNT * T_COUNT
+
+FLAG_KEEP   = 0x01      # Unchanged by NAME_FORM_NFC
+FLAG_LOWER  = 0x02      # Unchanged by NAME_FORM_NFC | NAME_FORM_LOWER
+FLAG_UPPER  = 0x04      # Unchanged by NAME_FORM_NFC | NAME_FORM_UPPER
+
+
+def is_surrogate(cp):
+    return 0xD800 <= cp <= 0xDFFF
+
+
+def canonical_decomposition(cp):
+    text = unicodedata.decomposition(chr(cp))
+    if not text or text.startswith('<'):
+        return None
+    return [int(part, 16) for part in text.split()]
+
+
+def full_decomposition(cp):
+    parts = canonical_decomposition(cp)
+    if parts is None:
+        return [cp]
+    result = []
+    for part in parts:
+        result += full_decomposition(part)
+    return result
+
+
+def simple_case(cp, upper):
+    """Simple upper casing, or simple case folding. Where the full mapping
+    is longer, the simple one is the lower case letter, or nothing."""
+    for mapped in ([chr(cp).upper()] if upper else [chr(cp).casefold(), chr(cp).lower()]):
+        if len(mapped) == 1:
+            return ord(mapped)
+    return cp
+
+
+def name_form(text, case):
+    """The reference form: NFC of the case mapped NFD."""
+    text = unicodedata.normalize('NFD', text)
+    if case:
+        text = ''.join(chr(simple_case(ord(c), case == 'upper')) for c in text)
+    return unicodedata.normalize('NFC', text)
+
+
+def main():
+    compositions = []
+    seconds      = set()
+
+    for cp in range(MAX_CODE):
+        if is_surrogate(cp) or S_BASE <= cp < S_BASE + S_COUNT:
+            continue
+        parts = canonical_decomposition(cp)
+        if parts and len(parts) == 2 and unicodedata.normalize('NFC', chr(cp)) == chr(cp):
+            compositions.append((parts[0], parts[1], cp))
+            seconds.add(parts[1])
+
+    seconds.update(range(V_BASE, V_BASE + V_COUNT))
+    seconds.update(range(T_BASE + 1, T_BASE + T_COUNT))
+    compositions.sort()
+
+    pool    = [0]
+    pooled  = {}
+    records = [(0, 0, 0, 0, 0, FLAG_KEEP | FLAG_LOWER | FLAG_UPPER)]
+    index   = {records[0]: 0}
+    codes   = []
+
+    for cp in range(MAX_CODE):
+        if is_surrogate(cp):
+            codes.append(0)
+            continue
+
+        c      = chr(cp)
+        ccc    = unicodedata.combining(c)
+        lower  = simple_case(cp, False) - cp
+        upper  = simple_case(cp, True) - cp
+        offset = 0
+        length = 0
+
+        if not (S_BASE <= cp < S_BASE + S_COUNT):
+            parts = full_decomposition(cp)
+            if parts != [cp]:
+                key = tuple(parts)
+                if key not in pooled:
+                    pooled[key] = len(pool)
+                    pool.extend(parts)
+                offset = pooled[key]
+                length = len(parts)
+
+        # Left alone in any string: a starter that nothing composes onto,
+        # which its form maps to itself.
+        first  = unicodedata.normalize('NFD', c)[0]
+        starts = ccc == 0 and unicodedata.combining(first) == 0 and ord(first) not in seconds and cp not in seconds
+        flags  = 0
+        if starts and name_form(c, None) == c:
+            flags |= FLAG_KEEP
+        if starts and name_form(c, 'lower') == c:
+            flags |= FLAG_LOWER
+        if starts and name_form(c, 'upper') == c:
+            flags |= FLAG_UPPER
+
+        record = (lower, upper, offset, length, ccc, flags)
+        if record not in index:
+            index[record] = len(records)
+            records.append(record)
+        codes.append(index[record])
+
+    limit = MAX_CODE
+    while all(code == 0 for code in codes[limit - BLOCK:limit]):
+        limit -= BLOCK
+
+    stage1 = []
+    stage2 = []
+    blocks = {}
+    for start in range(0, limit, BLOCK):
+        block = tuple(codes[start:start + BLOCK])
+        if block not in blocks:
+            blocks[block] = len(stage2) // BLOCK
+            stage2.extend(block)
+        stage1.append(blocks[block])
+
+    assert len(records) < 65536 and len(pool) < 65536 and len(stage2) // BLOCK < 65536
+
+    out = sys.stdout
+    out.write('// Generated by tools/MakeUnicodeTables.py from Unicode %s. Do not edit.\n\n\n' % unicodedata.unidata_version)
+    out.write('#pragma once\n\n\n')
+    out.write('#define UNICODE_SHIFT           %d\n' % SHIFT)
+    out.write('#define UNICODE_LIMIT           0x%05x\n' % limit)
+    out.write('#define UNICODE_FLAG_KEEP       0x%02x\n' % FLAG_KEEP)
+    out.write('#define UNICODE_FLAG_LOWER      0x%02x\n' % FLAG_LOWER)
+    out.write('#define UNICODE_FLAG_UPPER      0x%02x\n' % FLAG_UPPER)
+    out.write('#define UNICODE_COMPOSITIONS    %d\n\n\n' % len(compositions))
+
+    def table(kind, name, values, per_line, width):
+        out.write('static const %s %s[%d] =\n{\n' % (kind, name, len(values)))
+        for i in range(0, len(values), per_line):
+            out.write('    ' + ' '.join(('%d,' % v).rjust(width) for v in values[i:i + per_line]).rstrip() + '\n')
+        out.write('};\n\n\n')
+
+    ascii = [0] + [records[codes[cp]][5] for cp in range(1, 128)]
+    table('u8', 'unicodeAscii', ascii, 16, 4)
+    table('u16', 'unicodeStage1', stage1, 16, 5)
+    table('u16', 'unicodeStage2', stage2, 16, 5)
+
+    out.write('static const UnicodeRecord unicodeRecords[%d] =\n{\n' % len(records))
+    for record in records:
+        out.write('    { %d, %d, %d, %d, %d, %d },\n' % record)
+    out.write('};\n\n\n')
+
+    table('u32', 'unicodeDecompositions', pool, 8, 8)
+
+    out.write('static const UnicodeComposition unicodeCompositions[UNICODE_COMPOSITIONS] =\n{\n')
+    for first, second, composite in compositions:
+        out.write('    { 0x%05x, 0x%05x, 0x%05x },\n' % (first, second, composite))
+    out.write('};\n')
+
+
+main()